@@ -0,0 +1,16 @@
+#include "AnalyticsFactory.hpp"
+
+using namespace Pht;
+
+// Headless builds do not submit any analytics events.
+namespace {
+    class NullAnalytics: public IAnalytics {
+    public:
+        void InitAnalytics() override {}
+        void AddEvent(const AnalyticsEvent& event) override {}
+    };
+}
+
+std::unique_ptr<IAnalytics> Pht::CreateAnalyticsApi() {
+    return std::make_unique<NullAnalytics>();
+}
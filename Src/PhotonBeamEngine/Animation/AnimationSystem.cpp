@@ -1,6 +1,9 @@
 #include "AnimationSystem.hpp"
 
+#include <algorithm>
+
 #include "SceneObject.hpp"
+#include "Profiler.hpp"
 
 using namespace Pht;
 
@@ -29,6 +32,8 @@ Animation& AnimationSystem::CreateAnimation(SceneObject& sceneObject,
 }
 
 void AnimationSystem::Update(float dt) {
+    PHT_PROFILE_ZONE("AnimationSystem::Update");
+    
     for (auto* animation: mAnimations) {
         animation->Update(dt);
     }
@@ -0,0 +1,42 @@
+#include "IAudioEngine.hpp"
+
+using namespace Pht;
+
+// Headless builds have no audio device, so the sounds are loaded as silent sounds that the game
+// can play and query like the OpenAL sounds.
+namespace {
+    class NullSound: public ISound {
+    public:
+        void Play() override {}
+        void Stop() override {}
+        void SetGain(float gain) override {}
+        void SetPitch(float pitch) override {}
+        void SetLoop(bool loop) override {}
+        
+        bool IsPlaying() const override {
+            return false;
+        }
+    };
+    
+    class NullAudioEngine: public IAudioEngine {
+    public:
+        std::unique_ptr<ISound> LoadSound(const std::string& filename, int maxSources) override {
+            return std::make_unique<NullSound>();
+        }
+        
+        void SetIsSuspended(bool isSuspended) override {
+            mIsSuspended = isSuspended;
+        }
+        
+        bool IsSuspended() const override {
+            return mIsSuspended;
+        }
+    
+    private:
+        bool mIsSuspended {false};
+    };
+}
+
+std::unique_ptr<IAudioEngine> Pht::CreateAudioEngine() {
+    return std::make_unique<NullAudioEngine>();
+}
@@ -0,0 +1,18 @@
+#include "IMusicTrack.hpp"
+
+using namespace Pht;
+
+namespace {
+    class NullMusicTrack: public IMusicTrack {
+    public:
+        void Play() override {}
+        void Pause() override {}
+        void Stop() override {}
+        void SetVolume(float volume) override {}
+        void SetVolume(float volume, float fadeDuration) override {}
+    };
+}
+
+std::unique_ptr<IMusicTrack> Pht::LoadMusicTrack(const std::string& filename) {
+    return std::make_unique<NullMusicTrack>();
+}
@@ -0,0 +1,457 @@
+#include "ParticleBuffer.hpp"
+
+#include <assert.h>
+#include <cmath>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#elif defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#endif
+
+#include "MathUtils.hpp"
+#include "VertexBuffer.hpp"
+
+using namespace Pht;
+
+namespace {
+    constexpr auto laneWidth = 4;
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    using Float4 = float32x4_t;
+    using Mask4 = uint32x4_t;
+
+    Float4 Load(const float* values) {
+        return vld1q_f32(values);
+    }
+
+    void Store(float* values, Float4 v) {
+        vst1q_f32(values, v);
+    }
+
+    Float4 Splat(float value) {
+        return vdupq_n_f32(value);
+    }
+
+    Float4 Add(Float4 a, Float4 b) {
+        return vaddq_f32(a, b);
+    }
+
+    Float4 Sub(Float4 a, Float4 b) {
+        return vsubq_f32(a, b);
+    }
+
+    Float4 Mul(Float4 a, Float4 b) {
+        return vmulq_f32(a, b);
+    }
+
+    Float4 Min(Float4 a, Float4 b) {
+        return vminq_f32(a, b);
+    }
+
+    Float4 Max(Float4 a, Float4 b) {
+        return vmaxq_f32(a, b);
+    }
+
+    Mask4 LessThan(Float4 a, Float4 b) {
+        return vcltq_f32(a, b);
+    }
+
+    Mask4 GreaterThan(Float4 a, Float4 b) {
+        return vcgtq_f32(a, b);
+    }
+
+    Float4 Select(Mask4 mask, Float4 a, Float4 b) {
+        return vbslq_f32(mask, a, b);
+    }
+#elif defined(__SSE__) || defined(_M_X64)
+    using Float4 = __m128;
+    using Mask4 = __m128;
+
+    Float4 Load(const float* values) {
+        return _mm_loadu_ps(values);
+    }
+
+    void Store(float* values, Float4 v) {
+        _mm_storeu_ps(values, v);
+    }
+
+    Float4 Splat(float value) {
+        return _mm_set1_ps(value);
+    }
+
+    Float4 Add(Float4 a, Float4 b) {
+        return _mm_add_ps(a, b);
+    }
+
+    Float4 Sub(Float4 a, Float4 b) {
+        return _mm_sub_ps(a, b);
+    }
+
+    Float4 Mul(Float4 a, Float4 b) {
+        return _mm_mul_ps(a, b);
+    }
+
+    Float4 Min(Float4 a, Float4 b) {
+        return _mm_min_ps(a, b);
+    }
+
+    Float4 Max(Float4 a, Float4 b) {
+        return _mm_max_ps(a, b);
+    }
+
+    Mask4 LessThan(Float4 a, Float4 b) {
+        return _mm_cmplt_ps(a, b);
+    }
+
+    Mask4 GreaterThan(Float4 a, Float4 b) {
+        return _mm_cmpgt_ps(a, b);
+    }
+
+    Float4 Select(Mask4 mask, Float4 a, Float4 b) {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+#else
+    struct Float4 {
+        float mValues[laneWidth];
+    };
+
+    struct Mask4 {
+        bool mValues[laneWidth];
+    };
+
+    template<typename Operation>
+    Float4 Apply(Float4 a, Float4 b, Operation operation) {
+        Float4 result;
+        for (auto i = 0; i < laneWidth; ++i) {
+            result.mValues[i] = operation(a.mValues[i], b.mValues[i]);
+        }
+
+        return result;
+    }
+
+    Float4 Load(const float* values) {
+        return {{values[0], values[1], values[2], values[3]}};
+    }
+
+    void Store(float* values, Float4 v) {
+        for (auto i = 0; i < laneWidth; ++i) {
+            values[i] = v.mValues[i];
+        }
+    }
+
+    Float4 Splat(float value) {
+        return {{value, value, value, value}};
+    }
+
+    Float4 Add(Float4 a, Float4 b) {
+        return Apply(a, b, [] (float x, float y) { return x + y; });
+    }
+
+    Float4 Sub(Float4 a, Float4 b) {
+        return Apply(a, b, [] (float x, float y) { return x - y; });
+    }
+
+    Float4 Mul(Float4 a, Float4 b) {
+        return Apply(a, b, [] (float x, float y) { return x * y; });
+    }
+
+    Float4 Min(Float4 a, Float4 b) {
+        return Apply(a, b, [] (float x, float y) { return x < y ? x : y; });
+    }
+
+    Float4 Max(Float4 a, Float4 b) {
+        return Apply(a, b, [] (float x, float y) { return x > y ? x : y; });
+    }
+
+    Mask4 LessThan(Float4 a, Float4 b) {
+        Mask4 result;
+        for (auto i = 0; i < laneWidth; ++i) {
+            result.mValues[i] = a.mValues[i] < b.mValues[i];
+        }
+
+        return result;
+    }
+
+    Mask4 GreaterThan(Float4 a, Float4 b) {
+        return LessThan(b, a);
+    }
+
+    Float4 Select(Mask4 mask, Float4 a, Float4 b) {
+        Float4 result;
+        for (auto i = 0; i < laneWidth; ++i) {
+            result.mValues[i] = mask.mValues[i] ? a.mValues[i] : b.mValues[i];
+        }
+
+        return result;
+    }
+#endif
+
+    float SafeDivide(float numerator, float denominator) {
+        return denominator > 0.0f ? numerator / denominator : 0.0f;
+    }
+
+    float* WriteTriangleVertex(float* vertex,
+                               float x,
+                               float y,
+                               float z,
+                               float u,
+                               float v,
+                               const float* color) {
+        *vertex++ = x;
+        *vertex++ = y;
+        *vertex++ = z;
+        *vertex++ = u;
+        *vertex++ = v;
+        *vertex++ = color[0];
+        *vertex++ = color[1];
+        *vertex++ = color[2];
+        *vertex++ = color[3];
+        return vertex;
+    }
+}
+
+ParticleBuffer::ParticleBuffer(int capacity) :
+    mCapacity {capacity} {
+
+    // The arrays are padded to a whole number of lanes so that the last lane can be loaded and
+    // stored without a scalar tail loop.
+    auto paddedCapacity = (capacity + laneWidth - 1) / laneWidth * laneWidth;
+
+    for (auto* floats: GetArrays()) {
+        floats->resize(paddedCapacity, 0.0f);
+    }
+}
+
+std::array<ParticleBuffer::Floats*, ParticleBuffer::numArrays> ParticleBuffer::GetArrays() {
+    return {
+        {
+            &mPositionX, &mPositionY, &mPositionZ, &mVelocityX, &mVelocityY, &mVelocityZ,
+            &mColorR, &mColorG, &mColorB, &mColorA, &mSizeX, &mSizeY, &mFullSizeX, &mFullSizeY,
+            &mZAngle, &mZAngularVelocity, &mAge, &mTimeToLive
+        }
+    };
+}
+
+void ParticleBuffer::Clear() {
+    mNumParticles = 0;
+}
+
+void ParticleBuffer::AddParticle(const Particle& particle) {
+    assert(mNumParticles < mCapacity);
+
+    auto i = mNumParticles++;
+    mPositionX[i] = particle.mPosition.x;
+    mPositionY[i] = particle.mPosition.y;
+    mPositionZ[i] = particle.mPosition.z;
+    mVelocityX[i] = particle.mVelocity.x;
+    mVelocityY[i] = particle.mVelocity.y;
+    mVelocityZ[i] = particle.mVelocity.z;
+    mColorR[i] = particle.mColor.x;
+    mColorG[i] = particle.mColor.y;
+    mColorB[i] = particle.mColor.z;
+    mColorA[i] = particle.mColor.w;
+    mSizeX[i] = particle.mSize.x;
+    mSizeY[i] = particle.mSize.y;
+    mFullSizeX[i] = particle.mFullSize.x;
+    mFullSizeY[i] = particle.mFullSize.y;
+    mZAngle[i] = particle.mZAngle;
+    mZAngularVelocity[i] = particle.mZAngularVelocity;
+    mAge[i] = particle.mAge;
+    mTimeToLive[i] = particle.mTimeToLive;
+}
+
+void ParticleBuffer::Update(float dt, const ParticleSettings& particleSettings) {
+    Integrate(dt, particleSettings);
+    UpdateSizes(dt, particleSettings);
+    FadeOut(dt, particleSettings);
+    RemoveExpiredParticles();
+}
+
+int ParticleBuffer::GetNumLanes() const {
+    return (mNumParticles + laneWidth - 1) / laneWidth * laneWidth;
+}
+
+void ParticleBuffer::Integrate(float dt, const ParticleSettings& particleSettings) {
+    auto dtV = Splat(dt);
+    auto& acceleration = particleSettings.mAcceleration;
+    auto accelerationX = Splat(acceleration.x * dt);
+    auto accelerationY = Splat(acceleration.y * dt);
+    auto accelerationZ = Splat(acceleration.z * dt);
+    auto hasDrag = particleSettings.mDragCoefficient.HasValue();
+    auto drag = Splat(hasDrag ? particleSettings.mDragCoefficient.GetValue() * dt : 0.0f);
+    auto numLanes = GetNumLanes();
+
+    for (auto i = 0; i < numLanes; i += laneWidth) {
+        Store(&mAge[i], Add(Load(&mAge[i]), dtV));
+
+        auto velocityX = Add(Load(&mVelocityX[i]), accelerationX);
+        auto velocityY = Add(Load(&mVelocityY[i]), accelerationY);
+        auto velocityZ = Add(Load(&mVelocityZ[i]), accelerationZ);
+
+        if (hasDrag) {
+            velocityX = Sub(velocityX, Mul(velocityX, drag));
+            velocityY = Sub(velocityY, Mul(velocityY, drag));
+            velocityZ = Sub(velocityZ, Mul(velocityZ, drag));
+        }
+
+        Store(&mVelocityX[i], velocityX);
+        Store(&mVelocityY[i], velocityY);
+        Store(&mVelocityZ[i], velocityZ);
+        Store(&mPositionX[i], Add(Load(&mPositionX[i]), Mul(velocityX, dtV)));
+        Store(&mPositionY[i], Add(Load(&mPositionY[i]), Mul(velocityY, dtV)));
+        Store(&mPositionZ[i], Add(Load(&mPositionZ[i]), Mul(velocityZ, dtV)));
+
+        auto zAngle = Add(Load(&mZAngle[i]), Mul(Load(&mZAngularVelocity[i]), dtV));
+        Store(&mZAngle[i], zAngle);
+    }
+}
+
+void ParticleBuffer::UpdateSizes(float dt, const ParticleSettings& particleSettings) {
+    Vec2 initialSize {0.0f, 0.0f};
+    if (particleSettings.mInitialSize.HasValue()) {
+        initialSize = particleSettings.mInitialSize.GetValue();
+    } else if (particleSettings.mInitialPointSize.HasValue()) {
+        auto initialPointSize = static_cast<float>(particleSettings.mInitialPointSize.GetValue());
+        initialSize = {initialPointSize, initialPointSize};
+    }
+
+    auto initialSizeX = Splat(initialSize.x);
+    auto initialSizeY = Splat(initialSize.y);
+    auto growDuration = Splat(particleSettings.mGrowDuration);
+    auto growFactor = Splat(SafeDivide(dt, particleSettings.mGrowDuration));
+    auto shrinkDuration = Splat(particleSettings.mShrinkDuration);
+    auto shrinkFactor = SafeDivide(dt, particleSettings.mShrinkDuration);
+    auto shrinkFactorX = Splat(shrinkFactor * particleSettings.mShrinkScale.x);
+    auto shrinkFactorY = Splat(shrinkFactor * particleSettings.mShrinkScale.y);
+    auto zero = Splat(0.0f);
+    auto numLanes = GetNumLanes();
+
+    for (auto i = 0; i < numLanes; i += laneWidth) {
+        auto age = Load(&mAge[i]);
+        auto isGrowing = LessThan(age, growDuration);
+        auto isShrinking = GreaterThan(age, Sub(Load(&mTimeToLive[i]), shrinkDuration));
+
+        auto sizeX = Load(&mSizeX[i]);
+        auto sizeY = Load(&mSizeY[i]);
+        auto fullSizeX = Load(&mFullSizeX[i]);
+        auto fullSizeY = Load(&mFullSizeY[i]);
+
+        auto grownX = Min(Add(sizeX, Mul(Sub(fullSizeX, initialSizeX), growFactor)), fullSizeX);
+        auto grownY = Min(Add(sizeY, Mul(Sub(fullSizeY, initialSizeY), growFactor)), fullSizeY);
+        auto shrunkX = Max(Sub(sizeX, Mul(fullSizeX, shrinkFactorX)), zero);
+        auto shrunkY = Max(Sub(sizeY, Mul(fullSizeY, shrinkFactorY)), zero);
+
+        Store(&mSizeX[i], Select(isGrowing, grownX, Select(isShrinking, shrunkX, fullSizeX)));
+        Store(&mSizeY[i], Select(isGrowing, grownY, Select(isShrinking, shrunkY, fullSizeY)));
+    }
+}
+
+void ParticleBuffer::FadeOut(float dt, const ParticleSettings& particleSettings) {
+    auto fadeOutDuration = Splat(particleSettings.mFadeOutDuration);
+    auto fadeOutFactor = Splat(SafeDivide(dt, particleSettings.mFadeOutDuration));
+    auto zero = Splat(0.0f);
+    auto numLanes = GetNumLanes();
+
+    for (auto i = 0; i < numLanes; i += laneWidth) {
+        auto isFading = GreaterThan(Load(&mAge[i]), Sub(Load(&mTimeToLive[i]), fadeOutDuration));
+        auto alpha = Load(&mColorA[i]);
+        auto fadedAlpha = Max(Sub(alpha, fadeOutFactor), zero);
+        Store(&mColorA[i], Select(isFading, fadedAlpha, alpha));
+    }
+}
+
+void ParticleBuffer::RemoveExpiredParticles() {
+    for (auto i = mNumParticles - 1; i >= 0; --i) {
+        if (mAge[i] > mTimeToLive[i]) {
+            MoveParticle(mNumParticles - 1, i);
+            --mNumParticles;
+        }
+    }
+}
+
+void ParticleBuffer::MoveParticle(int fromIndex, int toIndex) {
+    for (auto* floats: GetArrays()) {
+        (*floats)[toIndex] = (*floats)[fromIndex];
+    }
+}
+
+void ParticleBuffer::WritePoints(VertexBuffer& vertexBuffer) const {
+    auto& flags = vertexBuffer.GetAttributeFlags();
+    assert(flags.mColors && flags.mPointSizes && !flags.mNormals && !flags.mTextureCoords);
+
+    auto* vertex = vertexBuffer.AppendVertices(mNumParticles);
+
+    for (auto i = 0; i < mNumParticles; ++i) {
+        *vertex++ = mPositionX[i];
+        *vertex++ = mPositionY[i];
+        *vertex++ = mPositionZ[i];
+        *vertex++ = mColorR[i];
+        *vertex++ = mColorG[i];
+        *vertex++ = mColorB[i];
+        *vertex++ = mColorA[i];
+        *vertex++ = mSizeX[i];
+    }
+}
+
+void ParticleBuffer::WriteTriangles(VertexBuffer& vertexBuffer) const {
+    auto& flags = vertexBuffer.GetAttributeFlags();
+    assert(flags.mTextureCoords && flags.mColors && !flags.mNormals && !flags.mPointSizes);
+
+    auto* vertex = vertexBuffer.AppendVertices(mNumParticles * 4);
+
+    for (auto i = 0; i < mNumParticles; ++i) {
+        auto halfSizeX = mSizeX[i] * 0.5f;
+        auto halfSizeY = mSizeY[i] * 0.5f;
+        auto sinTheta = 0.0f;
+        auto cosTheta = 1.0f;
+
+        if (mZAngle[i] != 0.0f) {
+            auto thetaRadians = ToRadians(mZAngle[i]);
+            sinTheta = std::sin(thetaRadians);
+            cosTheta = std::cos(thetaRadians);
+        }
+
+        // The rotated half axes of the quad.
+        auto xAxisX = halfSizeX * cosTheta;
+        auto xAxisY = halfSizeX * sinTheta;
+        auto yAxisX = -halfSizeY * sinTheta;
+        auto yAxisY = halfSizeY * cosTheta;
+
+        auto x = mPositionX[i];
+        auto y = mPositionY[i];
+        auto z = mPositionZ[i];
+        const float color[] {mColorR[i], mColorG[i], mColorB[i], mColorA[i]};
+
+        vertex = WriteTriangleVertex(vertex,
+                                     x - xAxisX - yAxisX,
+                                     y - xAxisY - yAxisY,
+                                     z,
+                                     0.0f,
+                                     1.0f,
+                                     color);
+        vertex = WriteTriangleVertex(vertex,
+                                     x + xAxisX - yAxisX,
+                                     y + xAxisY - yAxisY,
+                                     z,
+                                     1.0f,
+                                     1.0f,
+                                     color);
+        vertex = WriteTriangleVertex(vertex,
+                                     x + xAxisX + yAxisX,
+                                     y + xAxisY + yAxisY,
+                                     z,
+                                     1.0f,
+                                     0.0f,
+                                     color);
+        vertex = WriteTriangleVertex(vertex,
+                                     x - xAxisX + yAxisX,
+                                     y - xAxisY + yAxisY,
+                                     z,
+                                     0.0f,
+                                     0.0f,
+                                     color);
+    }
+
+    vertexBuffer.AppendQuadIndices(mNumParticles);
+}
@@ -0,0 +1,73 @@
+#ifndef ParticleBuffer_hpp
+#define ParticleBuffer_hpp
+
+#include <vector>
+#include <array>
+
+#include "ParticleEmitter.hpp"
+
+namespace Pht {
+    class VertexBuffer;
+
+    // Stores the particles of an effect as a structure of arrays. The live particles are kept
+    // packed at the front of the arrays, so the update and the vertex generation run over
+    // contiguous memory four particles at a time without checking for inactive particles.
+    class ParticleBuffer {
+    public:
+        explicit ParticleBuffer(int capacity);
+
+        void Clear();
+        void AddParticle(const Particle& particle);
+        void Update(float dt, const ParticleSettings& particleSettings);
+        void WritePoints(VertexBuffer& vertexBuffer) const;
+        void WriteTriangles(VertexBuffer& vertexBuffer) const;
+
+        int GetNumParticles() const {
+            return mNumParticles;
+        }
+
+        int GetCapacity() const {
+            return mCapacity;
+        }
+
+        bool IsFull() const {
+            return mNumParticles == mCapacity;
+        }
+
+    private:
+        using Floats = std::vector<float>;
+        
+        static constexpr int numArrays {18};
+
+        void Integrate(float dt, const ParticleSettings& particleSettings);
+        void UpdateSizes(float dt, const ParticleSettings& particleSettings);
+        void FadeOut(float dt, const ParticleSettings& particleSettings);
+        void RemoveExpiredParticles();
+        void MoveParticle(int fromIndex, int toIndex);
+        int GetNumLanes() const;
+        std::array<Floats*, numArrays> GetArrays();
+
+        int mCapacity {0};
+        int mNumParticles {0};
+        Floats mPositionX;
+        Floats mPositionY;
+        Floats mPositionZ;
+        Floats mVelocityX;
+        Floats mVelocityY;
+        Floats mVelocityZ;
+        Floats mColorR;
+        Floats mColorG;
+        Floats mColorB;
+        Floats mColorA;
+        Floats mSizeX;
+        Floats mSizeY;
+        Floats mFullSizeX;
+        Floats mFullSizeY;
+        Floats mZAngle;
+        Floats mZAngularVelocity;
+        Floats mAge;
+        Floats mTimeToLive;
+    };
+}
+
+#endif
@@ -1,11 +1,11 @@
 #ifndef ParticleEffect_hpp
 #define ParticleEffect_hpp
 
-#include <vector>
 #include <memory>
 
 #include "VertexBuffer.hpp"
 #include "ParticleEmitter.hpp"
+#include "ParticleBuffer.hpp"
 #include "RenderableObject.hpp"
 #include "ISceneObjectComponent.hpp"
 
@@ -27,6 +27,7 @@ namespace Pht {
         void Update(float dt);
         void Start();
         void Stop();
+        void UploadVertexBuffer();
         
         bool IsActive() const {
             return mIsActive;
@@ -44,22 +45,40 @@ namespace Pht {
             return mSceneObject;
         }
 
+        RenderableObject& GetRenderableObject() {
+            return *mRenderableObject;
+        }
+
+        const VertexBuffer& GetVertexBuffer() const {
+            return *mVertexBuffer;
+        }
+
+        RenderMode GetRenderMode() const {
+            return mRenderMode;
+        }
+
+        int GetNumParticles() const {
+            return mParticles.GetNumParticles();
+        }
+
+        void SetIsBatchable(bool isBatchable) {
+            mIsBatchable = isBatchable;
+        }
+
     private:
-        bool UpdateParticle(Particle& particle, float dt);
         void ResetParticles();
         void WriteVertexBuffer();
-        void WritePoints();
-        void WriteTriangles();
-        void WriteParticleTriangles(const Particle& particle);
         
         SceneObject& mSceneObject;
         IParticleSystem& mParticleSystem;
         ParticleEmitter mEmitter;
         RenderMode mRenderMode {RenderMode::Triangles};
-        std::vector<Particle> mParticles;
+        ParticleBuffer mParticles;
         VertexBuffer* mVertexBuffer {nullptr};
         std::unique_ptr<RenderableObject> mRenderableObject;
         bool mIsActive {false};
+        bool mIsBatchable {false};
+        bool mIsVertexBufferChanged {false};
     };
 }
 
@@ -1,6 +1,9 @@
 #include "ParticleEmitter.hpp"
 
+#include <limits>
+
 #include "MathUtils.hpp"
+#include "ParticleBuffer.hpp"
 
 using namespace Pht;
 
@@ -14,15 +17,12 @@ void ParticleEmitter::Start() {
     mTimeSinceLastSpawn = 0.0f;
 }
 
-void ParticleEmitter::Update(float dt, std::vector<Particle>& particles) {
+void ParticleEmitter::Update(float dt, ParticleBuffer& particles) {
     if (mAge == 0.0f) {
         if (mEmitterSettings.mBurst > 0) {
             EmitBurst(particles);
-        } else {
-            auto* particle = FindInactiveParticle(particles);
-            if (particle) {
-                EmitParticle(*particle);
-            }
+        } else if (!particles.IsFull()) {
+            EmitParticle(particles);
         }
     }
     
@@ -33,25 +33,14 @@ void ParticleEmitter::Update(float dt, std::vector<Particle>& particles) {
         return;
     }
     
-    if (mTimeSinceLastSpawn > 1.0f / mEmitterSettings.mFrequency) {
-        auto* particle = FindInactiveParticle(particles);
-        if (particle) {
-            EmitParticle(*particle);
-        }
+    if (mTimeSinceLastSpawn > 1.0f / mEmitterSettings.mFrequency && !particles.IsFull()) {
+        EmitParticle(particles);
     }
 }
 
-Particle* ParticleEmitter::FindInactiveParticle(std::vector<Particle>& particles) const {
-    for (auto& particle: particles) {
-        if (!particle.mIsActive) {
-            return &particle;
-        }
-    }
+void ParticleEmitter::EmitParticle(ParticleBuffer& particles) {
+    Particle particle;
     
-    return nullptr;
-}
-
-void ParticleEmitter::EmitParticle(Particle& particle) {
     const auto& emitterPos = mEmitterSettings.mPosition;
     const auto& emitterSize = mEmitterSettings.mSize;
     
@@ -135,17 +124,16 @@ void ParticleEmitter::EmitParticle(Particle& particle) {
         particle.mZAngularVelocity = 0.0f;
     }
 
-    particle.mIsActive = true;
+    particles.AddParticle(particle);
     
     mTimeSinceLastSpawn = 0.0f;
 }
 
-void ParticleEmitter::EmitBurst(std::vector<Particle>& particles) {
-    assert(mEmitterSettings.mBurst <= particles.size());
+void ParticleEmitter::EmitBurst(ParticleBuffer& particles) {
+    assert(mEmitterSettings.mBurst <= particles.GetCapacity() - particles.GetNumParticles());
     
     for (auto i = 0; i < mEmitterSettings.mBurst; ++i) {
-        auto& particle = particles[i];
-        EmitParticle(particle);
+        EmitParticle(particles);
     }
 }
 
@@ -1,7 +1,6 @@
 #ifndef ParticleEmitter_hpp
 #define ParticleEmitter_hpp
 
-#include <vector>
 #include <functional>
 
 #include "Vector.hpp"
@@ -51,16 +50,17 @@ namespace Pht {
         float mZAngularVelocity;
         float mAge;
         float mTimeToLive;
-        bool mIsActive {false};
     };
     
+    class ParticleBuffer;
+    
     class ParticleEmitter {
     public:
         ParticleEmitter(const ParticleSettings& particleSettings,
                         const EmitterSettings& emitterSettings);
         
         void Start();
-        void Update(float dt, std::vector<Particle>& particles);
+        void Update(float dt, ParticleBuffer& particles);
         bool IsActive() const;
         
         ParticleSettings& GetParticleSettings() {
@@ -68,9 +68,8 @@ namespace Pht {
         }
         
     private:
-        Particle* FindInactiveParticle(std::vector<Particle>& particles) const;
-        void EmitParticle(Particle& particle);
-        void EmitBurst(std::vector<Particle>& particles);
+        void EmitParticle(ParticleBuffer& particles);
+        void EmitBurst(ParticleBuffer& particles);
     
         ParticleSettings mParticleSettings;
         EmitterSettings mEmitterSettings;
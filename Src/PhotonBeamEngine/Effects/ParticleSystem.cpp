@@ -1,10 +1,66 @@
 #include "ParticleSystem.hpp"
 
+#include <algorithm>
+
 #include "ParticleEffect.hpp"
 #include "SceneObject.hpp"
+#include "Profiler.hpp"
 
 using namespace Pht;
 
+namespace {
+    const Vec3 defaultRotation {0.0f, 0.0f, 0.0f};
+    const int minBatchParticleCapacity {64};
+
+    // The triangle indices are 16 bits and each particle quad has four vertices.
+    const int maxNumBatchParticles {65536 / 4};
+
+    bool IsSameColor(const Color& a, const Color& b) {
+        return a.mRed == b.mRed && a.mGreen == b.mGreen && a.mBlue == b.mBlue;
+    }
+
+    bool IsSameRenderState(const Material& a, const Material& b) {
+        auto& aDepthState = a.GetDepthState();
+        auto& bDepthState = b.GetDepthState();
+
+        return a.GetShaderId() == b.GetShaderId() &&
+               a.GetTexture() == b.GetTexture() &&
+               a.GetBlend() == b.GetBlend() &&
+               a.GetOpacity() == b.GetOpacity() &&
+               IsSameColor(a.GetAmbient(), b.GetAmbient()) &&
+               IsSameColor(a.GetDiffuse(), b.GetDiffuse()) &&
+               IsSameColor(a.GetSpecular(), b.GetSpecular()) &&
+               IsSameColor(a.GetEmissive(), b.GetEmissive()) &&
+               aDepthState.mDepthTest == bDepthState.mDepthTest &&
+               aDepthState.mDepthTestAllowedOverride == bDepthState.mDepthTestAllowedOverride &&
+               aDepthState.mDepthWrite == bDepthState.mDepthWrite;
+    }
+
+    bool IsBatchable(ParticleEffect& effect) {
+        auto& sceneObject = effect.GetSceneObject();
+
+        // An effect with a layer of its own can not share a batch with its siblings.
+        return effect.IsActive() && effect.GetNumParticles() > 0 && sceneObject.IsVisible() &&
+               sceneObject.GetLayerMask() == 0 &&
+               sceneObject.GetRenderable() == &effect.GetRenderableObject();
+    }
+
+    std::unique_ptr<VertexBuffer> CreateVertexBuffer(RenderMode renderMode, int numParticles) {
+        switch (renderMode) {
+            case RenderMode::Points: {
+                VertexFlags vertexFlags {.mColors = true, .mPointSizes = true};
+                return std::make_unique<VertexBuffer>(numParticles, 0, vertexFlags);
+            }
+            case RenderMode::Triangles: {
+                VertexFlags vertexFlags {.mTextureCoords = true, .mColors = true};
+                return std::make_unique<VertexBuffer>(numParticles * 4,
+                                                      numParticles * 6,
+                                                      vertexFlags);
+            }
+        }
+    }
+}
+
 void ParticleSystem::AddParticleEffect(ParticleEffect& effect) {
     if (std::find(std::begin(mParticleEffects), std::end(mParticleEffects), &effect) ==
         std::end(mParticleEffects)) {
@@ -17,6 +73,10 @@ void ParticleSystem::RemoveParticleEffect(ParticleEffect& effect) {
     mParticleEffects.erase(
         std::remove(std::begin(mParticleEffects), std::end(mParticleEffects), &effect),
         std::end(mParticleEffects));
+
+    mBatchableEffects.erase(
+        std::remove(std::begin(mBatchableEffects), std::end(mBatchableEffects), &effect),
+        std::end(mBatchableEffects));
 }
 
 std::unique_ptr<SceneObject>
@@ -24,19 +84,234 @@ ParticleSystem::CreateParticleEffectSceneObject(const ParticleSettings& particle
                                                 const EmitterSettings& emitterSettings,
                                                 RenderMode renderMode) {
     auto sceneObject = std::make_unique<SceneObject>();
-    
+
     auto particleEffect = std::make_unique<ParticleEffect>(*sceneObject,
                                                            *this,
                                                            particleSettings,
                                                            emitterSettings,
                                                            renderMode);
-    
+    particleEffect->SetIsBatchable(true);
+    mBatchableEffects.push_back(particleEffect.get());
+
     sceneObject->SetComponent<ParticleEffect>(std::move(particleEffect));
     return sceneObject;
 }
 
 void ParticleSystem::Update(float dt) {
+    PHT_PROFILE_ZONE("ParticleSystem::Update");
+    
     for (auto* effect: mParticleEffects) {
         effect->Update(dt);
     }
+
+    BatchParticleEffects();
+}
+
+void ParticleSystem::BatchParticleEffects() {
+    mNumGroups = 0;
+    mBatchAttachments.clear();
+
+    for (auto* effect: mBatchableEffects) {
+        auto* parent = effect->GetSceneObject().GetParent();
+        if (parent && IsBatchable(*effect)) {
+            AddToGroup(*effect, *parent);
+        } else {
+            effect->UploadVertexBuffer();
+        }
+    }
+
+    for (auto i = 0; i < mNumGroups; ++i) {
+        BatchGroup(mGroups[i]);
+    }
+    
+    if (mBatchAttachments != mLastBatchAttachments) {
+        SceneObject::InvalidateRenderLists();
+        mLastBatchAttachments.swap(mBatchAttachments);
+    }
+}
+
+void ParticleSystem::AddToGroup(ParticleEffect& effect, SceneObject& parent) {
+    auto& material = effect.GetRenderableObject().GetMaterial();
+
+    for (auto i = 0; i < mNumGroups; ++i) {
+        auto& group = mGroups[i];
+        auto& firstEffect = *group.mEffects.front();
+
+        if (group.mParent == &parent && firstEffect.GetRenderMode() == effect.GetRenderMode() &&
+            IsSameRenderState(firstEffect.GetRenderableObject().GetMaterial(), material)) {
+
+            group.mEffects.push_back(&effect);
+            return;
+        }
+    }
+
+    if (mNumGroups == static_cast<int>(mGroups.size())) {
+        mGroups.emplace_back();
+    }
+
+    auto& group = mGroups[mNumGroups];
+    ++mNumGroups;
+    group.mParent = &parent;
+    group.mEffects.clear();
+    group.mEffects.push_back(&effect);
+}
+
+void ParticleSystem::BatchGroup(EffectGroup& group) {
+    auto& effects = group.mEffects;
+    if (effects.size() == 1) {
+        effects.front()->UploadVertexBuffer();
+        return;
+    }
+
+    // The particles are blended, so the effects are written back to front, assuming that the
+    // camera looks down the negative z axis.
+    std::stable_sort(std::begin(effects),
+                     std::end(effects),
+                     [] (const ParticleEffect* a, const ParticleEffect* b) {
+                         return a->GetSceneObject().GetWorldSpacePosition().z <
+                                b->GetSceneObject().GetWorldSpacePosition().z;
+                     });
+
+    auto beginIndex = 0;
+    auto numParticles = 0;
+    auto numEffects = static_cast<int>(effects.size());
+
+    for (auto i = 0; i < numEffects; ++i) {
+        auto numEffectParticles = effects[i]->GetNumParticles();
+        if (numParticles + numEffectParticles > maxNumBatchParticles && i > beginIndex) {
+            WriteBatch(effects, beginIndex, i, numParticles, *group.mParent);
+            beginIndex = i;
+            numParticles = 0;
+        }
+
+        numParticles += numEffectParticles;
+    }
+
+    WriteBatch(effects, beginIndex, numEffects, numParticles, *group.mParent);
+}
+
+void ParticleSystem::WriteBatch(const std::vector<ParticleEffect*>& effects,
+                                int beginIndex,
+                                int endIndex,
+                                int numParticles,
+                                SceneObject& parent) {
+    auto& firstEffect = *effects[beginIndex];
+    auto& batch = AcquireBatch(firstEffect.GetRenderMode(), numParticles);
+    auto& batchVertexBuffer = *batch.mVertexBuffer;
+    batchVertexBuffer.Reset();
+
+    // The batch is placed at the farthest effect, so that it is sorted among the other blended
+    // objects in the render pass as that effect would have been.
+    auto batchPosition = firstEffect.GetSceneObject().GetTransform().GetPosition();
+
+    for (auto i = beginIndex; i < endIndex; ++i) {
+        auto& effect = *effects[i];
+        auto& sceneObject = effect.GetSceneObject();
+        auto& transform = sceneObject.GetTransform();
+
+        if (transform.GetRotation() == defaultRotation) {
+            batchVertexBuffer.TransformAndAppendVertices(effect.GetVertexBuffer(),
+                                                         transform.GetPosition() - batchPosition,
+                                                         transform.GetScale());
+        } else {
+            // Since the matrix is row-major it has to be transposed in order to multiply with the
+            // vectors.
+            auto untransposedMatrix = transform.ToMatrix();
+            auto localTransformMatrix = untransposedMatrix.Transposed();
+            localTransformMatrix.x.w -= batchPosition.x;
+            localTransformMatrix.y.w -= batchPosition.y;
+            localTransformMatrix.z.w -= batchPosition.z;
+            auto normalMatrix = untransposedMatrix.ToMat3().Transposed();
+            batchVertexBuffer.TransformWithRotationAndAppendVertices(effect.GetVertexBuffer(),
+                                                                     localTransformMatrix,
+                                                                     normalMatrix);
+        }
+
+        sceneObject.SetRenderable(nullptr);
+        mBatchedEffects.push_back(&effect);
+    }
+
+    auto& batchRenderable = *batch.mRenderableObject;
+    batchRenderable.GetMaterial() = firstEffect.GetRenderableObject().GetMaterial();
+
+    switch (batch.mRenderMode) {
+        case RenderMode::Points:
+            batchRenderable.UploadPoints(BufferUsage::DynamicDraw);
+            break;
+        case RenderMode::Triangles:
+            batchRenderable.UploadTriangles(BufferUsage::DynamicDraw);
+            break;
+    }
+
+    auto& batchSceneObject = *batch.mSceneObject;
+    batchSceneObject.GetTransform().SetPosition(batchPosition);
+    parent.AddFrameChild(batchSceneObject);
+    batch.mParent = &parent;
+    mBatchAttachments.emplace_back(&batchSceneObject, &parent);
+    batchSceneObject.Update(true);
+}
+
+ParticleSystem::Batch& ParticleSystem::AcquireBatch(RenderMode renderMode, int numParticles) {
+    auto numBatches = static_cast<int>(mBatches.size());
+    auto batchIndex = numBatches;
+
+    // A batch that is too small is grown rather than replaced by a new batch, so that the same
+    // batch scene objects are attached from frame to frame.
+    for (auto i = mNumBatchesInUse; i < numBatches; ++i) {
+        auto& batch = mBatches[i];
+        if (batch.mRenderMode == renderMode) {
+            if (batch.mParticleCapacity >= numParticles) {
+                batchIndex = i;
+                break;
+            }
+            
+            if (batchIndex == numBatches) {
+                batchIndex = i;
+            }
+        }
+    }
+
+    if (batchIndex == numBatches) {
+        Batch batch;
+        batch.mSceneObject = std::make_unique<SceneObject>();
+        batch.mRenderMode = renderMode;
+        mBatches.push_back(std::move(batch));
+    }
+    
+    auto& batch = mBatches[batchIndex];
+    if (batch.mParticleCapacity < numParticles) {
+        auto particleCapacity = std::max({
+            numParticles,
+            std::min(batch.mParticleCapacity * 2, maxNumBatchParticles),
+            minBatchParticleCapacity
+        });
+        
+        auto vertexBuffer = CreateVertexBuffer(renderMode, particleCapacity);
+        batch.mVertexBuffer = vertexBuffer.get();
+        batch.mRenderableObject = std::make_unique<RenderableObject>(Material {},
+                                                                     std::move(vertexBuffer),
+                                                                     renderMode);
+        batch.mSceneObject->SetRenderable(batch.mRenderableObject.get());
+        batch.mParticleCapacity = particleCapacity;
+    }
+
+    std::swap(mBatches[batchIndex], mBatches[mNumBatchesInUse]);
+    return mBatches[mNumBatchesInUse++];
+}
+
+void ParticleSystem::UnbatchParticleEffects() {
+    PHT_PROFILE_ZONE("ParticleSystem::UnbatchParticleEffects");
+    
+    for (auto i = 0; i < mNumBatchesInUse; ++i) {
+        auto& batch = mBatches[i];
+        batch.mParent->DetachFrameChild(batch.mSceneObject.get());
+        batch.mParent = nullptr;
+    }
+
+    for (auto* effect: mBatchedEffects) {
+        effect->GetSceneObject().SetRenderable(&effect->GetRenderableObject());
+    }
+
+    mNumBatchesInUse = 0;
+    mBatchedEffects.clear();
 }
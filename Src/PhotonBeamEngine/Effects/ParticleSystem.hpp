@@ -2,10 +2,19 @@
 #define ParticleSystem_hpp
 
 #include <vector>
+#include <utility>
 
 #include "IParticleSystem.hpp"
 
 namespace Pht {
+    class VertexBuffer;
+
+    // Active effects that are siblings in the scene graph and have the same render state are
+    // written into one shared vertex buffer and rendered by a batch scene object that is attached
+    // to their parent for the duration of the frame. An effect that does not share its render state
+    // with a sibling is uploaded and rendered on its own. The render lists are only invalidated
+    // when the batches are attached differently than in the last frame, so a steady stream of
+    // effects does not make the renderer collect the scene objects again every frame.
     class ParticleSystem: public IParticleSystem {
     public:
         void AddParticleEffect(ParticleEffect& effect) override;
@@ -14,11 +23,46 @@ namespace Pht {
             CreateParticleEffectSceneObject(const ParticleSettings& particleSettings,
                                             const EmitterSettings& emitterSettings,
                                             RenderMode renderMode) override;
-        
+
         void Update(float dt);
-        
+        void UnbatchParticleEffects();
+
     private:
+        using BatchAttachment = std::pair<const SceneObject*, const SceneObject*>;
+        
+        struct EffectGroup {
+            SceneObject* mParent {nullptr};
+            std::vector<ParticleEffect*> mEffects;
+        };
+
+        struct Batch {
+            std::unique_ptr<SceneObject> mSceneObject;
+            std::unique_ptr<RenderableObject> mRenderableObject;
+            VertexBuffer* mVertexBuffer {nullptr};
+            SceneObject* mParent {nullptr};
+            RenderMode mRenderMode {RenderMode::Triangles};
+            int mParticleCapacity {0};
+        };
+
+        void BatchParticleEffects();
+        void AddToGroup(ParticleEffect& effect, SceneObject& parent);
+        void BatchGroup(EffectGroup& group);
+        void WriteBatch(const std::vector<ParticleEffect*>& effects,
+                        int beginIndex,
+                        int endIndex,
+                        int numParticles,
+                        SceneObject& parent);
+        Batch& AcquireBatch(RenderMode renderMode, int numParticles);
+
         std::vector<ParticleEffect*> mParticleEffects;
+        std::vector<ParticleEffect*> mBatchableEffects;
+        std::vector<EffectGroup> mGroups;
+        int mNumGroups {0};
+        std::vector<Batch> mBatches;
+        int mNumBatchesInUse {0};
+        std::vector<ParticleEffect*> mBatchedEffects;
+        std::vector<BatchAttachment> mBatchAttachments;
+        std::vector<BatchAttachment> mLastBatchAttachments;
     };
 }
 
@@ -7,6 +7,7 @@
 #include "SceneObject.hpp"
 #include "AnalyticsFactory.hpp"
 #include "PurchasingFactory.hpp"
+#include "Profiler.hpp"
 
 using namespace Pht;
 
@@ -34,6 +35,8 @@ void Engine::Init(bool createFrameBuffer) {
 }
 
 void Engine::Update(float frameSeconds) {
+    PHT_PROFILE_ZONE("Engine::Update");
+    
     if (frameSeconds < maxFrameTimeSeconds) {
         mLastFrameSeconds = frameSeconds;
     } else {
@@ -59,6 +62,8 @@ void Engine::Update(float frameSeconds) {
         mRenderer->ClearFrameBuffer();
         mRenderer->RenderScene(*scene, frameSeconds);
     }
+    
+    mParticleSystem.UnbatchParticleEffects();
 }
 
 void Engine::HandleSceneTransition(Scene& newScene) {
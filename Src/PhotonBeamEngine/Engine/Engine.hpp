@@ -47,9 +47,12 @@ namespace Pht {
         std::unique_ptr<IRendererInternal> mRenderer;
         InputHandler mInputHandler;
         Audio mAudio;
-        SceneManager mSceneManager;
         AnimationSystem mAnimationSystem;
         ParticleSystem mParticleSystem;
+        
+        // Destroyed before the systems, since the components of the scene objects remove
+        // themselves from the systems when destroyed.
+        SceneManager mSceneManager;
         std::unique_ptr<IAnalytics> mAnalytics;
         std::unique_ptr<IPurchasing> mPurchasing;
         std::unique_ptr<IApplication> mApplication;
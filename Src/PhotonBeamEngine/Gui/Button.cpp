@@ -152,6 +152,15 @@ Button::Result Button::OnTouchEnd(const Vec2& touchLocation) {
 }
 
 bool Button::Hit(const Vec2& touch) {
+    auto buttonPos = CalculateScreenPosition();
+    auto halfSizeX = mSize.x / 2.0f;
+    auto halfSizeY = mSize.y / 2.0f;
+    
+    return touch.x > buttonPos.x - halfSizeX && touch.x < buttonPos.x + halfSizeX &&
+           touch.y > buttonPos.y - halfSizeY && touch.y < buttonPos.y + halfSizeY;
+}
+
+Vec2 Button::CalculateScreenPosition() {
     auto& renderer = mEngine.GetRenderer();
     auto modelView = mSceneObject.GetMatrix() * renderer.GetViewMatrix();
     auto modelViewProjection = modelView * renderer.GetProjectionMatrix();
@@ -162,14 +171,8 @@ bool Button::Hit(const Vec2& touch) {
     
     auto& screenInputSize = mEngine.GetInput().GetScreenInputSize();
     
-    Vec2 buttonPos {
+    return {
         (normProjPos.x + 1.0f) / 2.0f * screenInputSize.x,
         (-normProjPos.y + 1.0f) / 2.0f * screenInputSize.y
     };
-    
-    auto halfSizeX = mSize.x / 2.0f;
-    auto halfSizeY = mSize.y / 2.0f;
-    
-    return touch.x > buttonPos.x - halfSizeX && touch.x < buttonPos.x + halfSizeX &&
-           touch.y > buttonPos.y - halfSizeY && touch.y < buttonPos.y + halfSizeY;
 }
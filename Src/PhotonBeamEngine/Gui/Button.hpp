@@ -30,6 +30,10 @@ namespace Pht {
         bool StateIsDownOrMovedOutside() const;
         bool IsDown() const;
         
+        // The center of the button in screen input coordinates, which is where the touches are
+        // tested against its size.
+        Vec2 CalculateScreenPosition();
+        
         void SetSize(const Vec2& size) {
             mSize = size;
         }
@@ -0,0 +1,152 @@
+#include "DistanceFieldGenerator.hpp"
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <assert.h>
+
+using namespace Pht;
+
+namespace {
+    constexpr auto infinity = 1e20;
+    
+    struct Workspace {
+        Workspace(int maxLineLength) :
+            mLine(maxLineLength),
+            mParabolaVertices(maxLineLength),
+            mIntersections(maxLineLength + 1) {}
+        
+        std::vector<double> mLine;
+        std::vector<int> mParabolaVertices;
+        std::vector<double> mIntersections;
+    };
+    
+    // The 1D squared Euclidean distance transform by Felzenszwalb and Huttenlocher, which finds
+    // the lower envelope of the parabolas rooted at each element of the line.
+    void TransformLine(double* grid, int length, int stride, Workspace& workspace) {
+        auto* f = workspace.mLine.data();
+        auto* v = workspace.mParabolaVertices.data();
+        auto* z = workspace.mIntersections.data();
+        
+        for (auto q = 0; q < length; ++q) {
+            f[q] = grid[q * stride];
+        }
+        
+        auto k = 0;
+        v[0] = 0;
+        z[0] = -infinity;
+        z[1] = infinity;
+        
+        for (auto q = 1; q < length; ++q) {
+            double s;
+            for (;;) {
+                auto r = v[k];
+                s = ((f[q] + q * q) - (f[r] + r * r)) / (2.0 * (q - r));
+                if (s > z[k] || k == 0) {
+                    break;
+                }
+                --k;
+            }
+            
+            ++k;
+            v[k] = q;
+            z[k] = s;
+            z[k + 1] = infinity;
+        }
+        
+        k = 0;
+        for (auto q = 0; q < length; ++q) {
+            while (z[k + 1] < q) {
+                ++k;
+            }
+            auto r = v[k];
+            grid[q * stride] = (q - r) * (q - r) + f[r];
+        }
+    }
+    
+    void Transform(std::vector<double>& grid, const IVec2& size, Workspace& workspace) {
+        for (auto x = 0; x < size.x; ++x) {
+            TransformLine(&grid[x], size.y, size.x, workspace);
+        }
+        
+        for (auto y = 0; y < size.y; ++y) {
+            TransformLine(&grid[y * size.x], size.x, 1, workspace);
+        }
+    }
+    
+    unsigned char ToTexelValue(float distance, int spread) {
+        auto value = 0.5f - distance / (2.0f * spread);
+        return static_cast<unsigned char>(std::lround(std::min(std::max(value, 0.0f), 1.0f) *
+                                                      255.0f));
+    }
+}
+
+IVec2 DistanceFieldGenerator::CalcSize(const IVec2& imageSize, int spread, int downscale) {
+    auto border = 2 * spread * downscale;
+    return {
+        (imageSize.x + border + downscale - 1) / downscale,
+        (imageSize.y + border + downscale - 1) / downscale
+    };
+}
+
+std::unique_ptr<BitmapImage> DistanceFieldGenerator::Generate(const IImage& image,
+                                                              int spread,
+                                                              int downscale) {
+    assert(image.GetFormat() == ImageFormat::Alpha && spread > 0 && downscale > 0);
+    
+    auto imageSize = image.GetSize();
+    auto size = CalcSize(imageSize, spread, downscale);
+    IVec2 gridSize {size.x * downscale, size.y * downscale};
+    auto border = spread * downscale;
+    auto numGridPixels = gridSize.x * gridSize.y;
+    
+    // The outer grid holds the squared distances to the outline from the pixels outside of it
+    // and the inner grid the ones from the pixels inside of it. Partially covered pixels are
+    // approximated as being half a pixel minus their coverage away from the outline.
+    std::vector<double> outerGrid(numGridPixels, infinity);
+    std::vector<double> innerGrid(numGridPixels, 0.0);
+    auto* imageData = static_cast<const unsigned char*>(image.GetImageData());
+    
+    for (auto y = 0; y < imageSize.y; ++y) {
+        for (auto x = 0; x < imageSize.x; ++x) {
+            auto coverage = imageData[y * imageSize.x + x] / 255.0;
+            auto gridIndex = (y + border) * gridSize.x + x + border;
+            
+            if (coverage == 1.0) {
+                outerGrid[gridIndex] = 0.0;
+                innerGrid[gridIndex] = infinity;
+            } else if (coverage > 0.0) {
+                auto distance = 0.5 - coverage;
+                outerGrid[gridIndex] = distance > 0.0 ? distance * distance : 0.0;
+                innerGrid[gridIndex] = distance < 0.0 ? distance * distance : 0.0;
+            }
+        }
+    }
+    
+    Workspace workspace {std::max(gridSize.x, gridSize.y)};
+    Transform(outerGrid, gridSize, workspace);
+    Transform(innerGrid, gridSize, workspace);
+    
+    // Each texel gets the average signed distance of the grid pixels it covers, converted to
+    // texels.
+    std::vector<unsigned char> texels(size.x * size.y);
+    auto numPixelsPerTexel = downscale * downscale;
+    
+    for (auto texelY = 0; texelY < size.y; ++texelY) {
+        for (auto texelX = 0; texelX < size.x; ++texelX) {
+            auto distanceSum = 0.0;
+            for (auto y = texelY * downscale; y < (texelY + 1) * downscale; ++y) {
+                for (auto x = texelX * downscale; x < (texelX + 1) * downscale; ++x) {
+                    auto gridIndex = y * gridSize.x + x;
+                    distanceSum += std::sqrt(outerGrid[gridIndex]) -
+                                   std::sqrt(innerGrid[gridIndex]);
+                }
+            }
+            
+            auto distance = static_cast<float>(distanceSum / (numPixelsPerTexel * downscale));
+            texels[texelY * size.x + texelX] = ToTexelValue(distance, spread);
+        }
+    }
+    
+    return std::make_unique<BitmapImage>(texels.data(), ImageFormat::Alpha, size);
+}
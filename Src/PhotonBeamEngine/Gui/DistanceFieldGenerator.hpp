@@ -0,0 +1,20 @@
+#ifndef DistanceFieldGenerator_hpp
+#define DistanceFieldGenerator_hpp
+
+#include <memory>
+
+#include "BitmapImage.hpp"
+
+namespace Pht {
+    // Converts an alpha image into a signed distance field image that is downscale times smaller
+    // than the image and has a border of spread texels around it. The value of a texel is 0.5 on
+    // the outline, grows towards 1 inside the outline and falls towards 0 outside it, reaching
+    // 1 or 0 at a distance of spread texels. Rasterizing the image at a higher resolution than
+    // the distance field gives the outline subtexel precision.
+    namespace DistanceFieldGenerator {
+        std::unique_ptr<BitmapImage> Generate(const IImage& image, int spread, int downscale);
+        IVec2 CalcSize(const IVec2& imageSize, int spread, int downscale);
+    }
+}
+
+#endif
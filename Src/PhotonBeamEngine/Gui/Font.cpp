@@ -1,80 +1,75 @@
 #include "Font.hpp"
 
-#include <ft2build.h>
-#include FT_FREETYPE_H
+#include <iostream>
 
 #include "FileSystem.hpp"
 #include "TextureCache.hpp"
 #include "TextureAtlas.hpp"
-#include "BitmapImage.hpp"
+#include "FontBaker.hpp"
+#include "IImage.hpp"
 
 using namespace Pht;
 
-Font::Font(const std::string& filename, int size) :
-    mSize {size} {
-
-    FT_Library ft;
-    if (FT_Init_FreeType(&ft)) {
-        std::cout << "Font: ERROR: Could not init FreeType Library" << std::endl;
-        assert(false);
-    }
-
-    std::string fullPath {FileSystem::GetResourceDirectory() + "/" + filename};
-    FT_Face face;
-    if (auto errorCode {FT_New_Face(ft, fullPath.c_str(), 0, &face)}) {
-        std::cout << "Font: ERROR: Failed to load font. Error code: " << errorCode << std::endl;
-        assert(false);
+namespace {
+    // A font that could not be loaded has no texture and its texts are not rendered.
+    void LogLoadFailure(const std::string& filename) {
+        std::cout << "Pht::Font: ERROR: Could not load " << filename << "." << std::endl;
     }
+}
 
-    FT_Set_Pixel_Sizes(face, 0, size);
+Font::Font(const std::string& filename, int size, DistanceField distanceField) :
+    mSize {size} {
     
-    auto subTextureIndex = 0;
-    std::vector<std::unique_ptr<const IImage>> glyphImages;
-
-    // Load the first printable set of the ASCII table.
-    for (char c {firstPrintableCharacter}; c < lastPrintableCharacter; c++) {
-        if (FT_Load_Char(face, c, FT_LOAD_RENDER)) {
-            std::cout << "Font: ERROR: Failed to load Glyph" << std::endl;
-            continue;
-        }
-        
-        Optional<int> glyphSubTextureIndex;
-        IVec2 glyphImageSize {
-            static_cast<int>(face->glyph->bitmap.width),
-            static_cast<int>(face->glyph->bitmap.rows)
-        };
-
-        if (glyphImageSize.x > 0 && glyphImageSize.y > 0) {
-            auto glyphImage = std::make_unique<BitmapImage>(face->glyph->bitmap.buffer,
-                                                            ImageFormat::Alpha,
-                                                            glyphImageSize);
-            glyphImages.push_back(std::move(glyphImage));
-            glyphSubTextureIndex = subTextureIndex;
-            ++subTextureIndex;
-        }
-        
-        Glyph glyph {
-            glyphSubTextureIndex,
-            IVec2 {
-                static_cast<int>(face->glyph->bitmap.width),
-                static_cast<int>(face->glyph->bitmap.rows)
-            },
-            IVec2 {face->glyph->bitmap_left, face->glyph->bitmap_top},
-            static_cast<unsigned int>(face->glyph->advance.x)
-        };
-        mGlyphs.push_back(glyph);
+    // Fonts are loaded from the files baked by the font baker tool if there are any, otherwise
+    // they are rasterized here.
+    auto resourceDirectory = FileSystem::GetResourceDirectory() + "/";
+    BakedFont bakedFont;
+    std::string textureAtlasName;
+    
+    switch (distanceField) {
+        case DistanceField::Yes:
+            if (!FontBaker::Read(resourceDirectory +
+                                 FontBaker::ToBakedDistanceFieldFilename(filename),
+                                 bakedFont)) {
+                
+                if (!FontBaker::RasterizeDistanceField(resourceDirectory + filename, bakedFont)) {
+                    LogLoadFailure(filename);
+                    return;
+                }
+            }
+            textureAtlasName = filename + "DistanceField";
+            break;
+        case DistanceField::No:
+            if (!FontBaker::Read(resourceDirectory + FontBaker::ToBakedFilename(filename, size),
+                                 bakedFont)) {
+                
+                if (!FontBaker::Rasterize(resourceDirectory + filename, size, bakedFont)) {
+                    LogLoadFailure(filename);
+                    return;
+                }
+            }
+            textureAtlasName = filename + std::to_string(size);
+            break;
     }
     
-    TextureAtlasConfig textureAtlasConfig {
-        .mPackingDirection = TexturePackingDirection::Horizontal,
-        .mGenerateMipmap = GenerateMipmap::No,
-        .mPadding = 1
-    };
-    auto textureAtlasName = filename + std::to_string(size);
-    mTexture = TextureCache::GetTextureAtlas(textureAtlasName, glyphImages, textureAtlasConfig);
+    mGlyphs = std::move(bakedFont.mGlyphs);
+    mGlyphScale = static_cast<float>(size) / bakedFont.mPixelSize;
+    mDistanceFieldSpread = bakedFont.mDistanceFieldSpread;
+    
+    mTexture = TextureCache::GetTextureAtlas(textureAtlasName,
+                                             *bakedFont.mAtlasImage,
+                                             std::move(bakedFont.mTextureAtlas),
+                                             FontBaker::GetTextureAtlasConfig());
+}
+
+Font::Font(const Font& distanceFieldFont, int size) :
+    mTexture {distanceFieldFont.mTexture},
+    mGlyphs {distanceFieldFont.mGlyphs},
+    mSize {size},
+    mGlyphScale {distanceFieldFont.mGlyphScale * size / distanceFieldFont.mSize},
+    mDistanceFieldSpread {distanceFieldFont.mDistanceFieldSpread} {
     
-    FT_Done_Face(face);
-    FT_Done_FreeType(ft);
+    assert(distanceFieldFont.IsDistanceField());
 }
 
 Font::~Font() {}
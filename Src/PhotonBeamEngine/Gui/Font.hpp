@@ -3,6 +3,7 @@
 
 #include <assert.h>
 #include <vector>
+#include <memory>
 
 #include "Vector.hpp"
 #include "Optional.hpp"
@@ -10,9 +11,21 @@
 namespace Pht {
     class Texture;
     
+    enum class DistanceField {
+        Yes,
+        No
+    };
+    
+    // A distance field font has one glyph atlas of signed distance fields that is rendered
+    // crisply at any size, so fonts of other sizes can share it.
     class Font {
     public:
-        Font(const std::string& filename, int size);
+        Font(const std::string& filename,
+             int size,
+             DistanceField distanceField = DistanceField::No);
+        
+        // Creates a font of another size that shares the atlas of the distance field font.
+        Font(const Font& distanceFieldFont, int size);
         ~Font();
         
         struct Glyph {
@@ -37,6 +50,22 @@ namespace Pht {
             return mSize;
         }
         
+        // The glyph metrics are in the pixels of the size the glyphs were rasterized at, which
+        // this scale converts into the pixels of the font size.
+        float GetGlyphScale() const {
+            return mGlyphScale;
+        }
+        
+        bool IsDistanceField() const {
+            return mDistanceFieldSpread > 0;
+        }
+        
+        // The distance from the outline in glyph metric pixels at which the distance field
+        // reaches 0 or 1.
+        int GetDistanceFieldSpread() const {
+            return mDistanceFieldSpread;
+        }
+        
     private:
         static constexpr char firstPrintableCharacter {32};
         static constexpr char lastPrintableCharacter {127};
@@ -44,6 +73,8 @@ namespace Pht {
         std::shared_ptr<Texture> mTexture;
         std::vector<Glyph> mGlyphs;
         int mSize {0};
+        float mGlyphScale {1.0f};
+        int mDistanceFieldSpread {0};
     };
 
     enum class TextShadow {
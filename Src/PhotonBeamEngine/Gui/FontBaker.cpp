@@ -0,0 +1,348 @@
+#include "FontBaker.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <cstring>
+#include <cmath>
+#include <assert.h>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include "BitmapImage.hpp"
+#include "DistanceFieldGenerator.hpp"
+
+using namespace Pht;
+
+namespace {
+    const std::string bakedFontSuffix {".pfont"};
+    const std::string distanceFieldSuffix {"_sdf"};
+    const char magic[4] {'P', 'F', 'N', 'T'};
+    constexpr uint32_t version {2};
+    constexpr char firstPrintableCharacter {32};
+    constexpr char lastPrintableCharacter {127};
+    
+    const TextureAtlasConfig textureAtlasConfig {
+        .mPackingDirection = TexturePackingDirection::Horizontal,
+        .mGenerateMipmap = GenerateMipmap::No,
+        .mPadding = 1
+    };
+    
+    // The glyphs of distance field fonts are rasterized at 256 pixels and downscaled into 64
+    // texel distance fields, with room for outlines up to 8 texels away from the glyph.
+    const DistanceFieldConfig distanceFieldConfig {
+        .mPixelSize = 256,
+        .mDownscale = 4,
+        .mSpread = 8
+    };
+    
+    struct Header {
+        char mMagic[4];
+        uint32_t mVersion;
+        uint32_t mNumGlyphs;
+        uint32_t mNumSubTextures;
+        int32_t mPixelSize;
+        int32_t mDistanceFieldSpread;
+        int32_t mAtlasWidth;
+        int32_t mAtlasHeight;
+    };
+    
+    struct GlyphRecord {
+        int32_t mSubTextureIndex;
+        int32_t mWidth;
+        int32_t mHeight;
+        int32_t mBearingX;
+        int32_t mBearingY;
+        uint32_t mAdvance;
+    };
+    
+    constexpr auto noSubTexture = -1;
+    
+    template<typename T>
+    const char* ReadValue(const char* read, T& value) {
+        std::memcpy(&value, read, sizeof(T));
+        return read + sizeof(T);
+    }
+    
+    template<typename T>
+    void WriteValue(std::ofstream& file, const T& value) {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+    
+    size_t CalcMetricsSize(const Header& header) {
+        return sizeof(Header) + header.mNumGlyphs * sizeof(GlyphRecord) +
+               header.mNumSubTextures * sizeof(SubTextureUV);
+    }
+    
+    bool IsValid(const Header& header, size_t fileSize) {
+        return std::memcmp(header.mMagic, magic, sizeof(magic)) == 0 &&
+               header.mVersion == version &&
+               header.mPixelSize > 0 && header.mDistanceFieldSpread >= 0 &&
+               header.mAtlasWidth > 0 && header.mAtlasHeight > 0 &&
+               fileSize >= CalcMetricsSize(header);
+    }
+    
+    IVec2 CalcSubTextureSize(const SubTextureUV& subTextureUV, const IVec2& atlasSize) {
+        auto width = (subTextureUV.mBottomRight.x - subTextureUV.mBottomLeft.x) * atlasSize.x;
+        auto height = (subTextureUV.mBottomLeft.y - subTextureUV.mTopLeft.y) * atlasSize.y;
+        return {static_cast<int>(std::lround(width)), static_cast<int>(std::lround(height))};
+    }
+    
+    // The atlas image is packed with the bottom left corner of each sub texture at its bottom left
+    // UV, and the rows of the image are stored from the top.
+    IVec2 CalcSubTextureTopLeftPixel(const SubTextureUV& subTextureUV,
+                                     const IVec2& subTextureSize,
+                                     const IVec2& atlasSize) {
+        auto x = static_cast<int>(std::lround(subTextureUV.mBottomLeft.x * atlasSize.x));
+        auto y = static_cast<int>(std::lround(subTextureUV.mBottomLeft.y * atlasSize.y));
+        return {x, y - subTextureSize.y};
+    }
+    
+    std::unique_ptr<const IImage> CreateGlyphImage(const FT_Bitmap& bitmap, int downscale) {
+        IVec2 size {static_cast<int>(bitmap.width), static_cast<int>(bitmap.rows)};
+        auto image = std::make_unique<BitmapImage>(bitmap.buffer, ImageFormat::Alpha, size);
+        if (downscale == 0) {
+            return image;
+        }
+        
+        return DistanceFieldGenerator::Generate(*image, distanceFieldConfig.mSpread, downscale);
+    }
+    
+    // Rasterizes the glyphs at pixelSize and converts them into distance fields that are
+    // downscale times smaller unless downscale is zero. The glyph metrics stay in the pixels of
+    // pixelSize, so the size of a distance field glyph covers its distance field including the
+    // border.
+    bool RasterizeGlyphs(const std::string& fontPath,
+                         int pixelSize,
+                         int downscale,
+                         BakedFont& bakedFont) {
+        FT_Library ft;
+        if (FT_Init_FreeType(&ft)) {
+            std::cout << "Font: ERROR: Could not init FreeType Library" << std::endl;
+            return false;
+        }
+        
+        FT_Face face;
+        if (auto errorCode {FT_New_Face(ft, fontPath.c_str(), 0, &face)}) {
+            std::cout << "Font: ERROR: Failed to load font. Error code: " << errorCode << std::endl;
+            FT_Done_FreeType(ft);
+            return false;
+        }
+        
+        FT_Set_Pixel_Sizes(face, 0, pixelSize);
+        
+        auto subTextureIndex = 0;
+        auto border = downscale * distanceFieldConfig.mSpread;
+        std::vector<std::unique_ptr<const IImage>> glyphImages;
+        bakedFont.mGlyphs.clear();
+        
+        // Load the first printable set of the ASCII table.
+        for (char c {firstPrintableCharacter}; c < lastPrintableCharacter; c++) {
+            if (FT_Load_Char(face, c, FT_LOAD_RENDER)) {
+                std::cout << "Font: ERROR: Failed to load Glyph" << std::endl;
+                continue;
+            }
+            
+            auto& bitmap = face->glyph->bitmap;
+            Font::Glyph glyph {
+                Optional<int> {},
+                IVec2 {static_cast<int>(bitmap.width), static_cast<int>(bitmap.rows)},
+                IVec2 {face->glyph->bitmap_left, face->glyph->bitmap_top},
+                static_cast<unsigned int>(face->glyph->advance.x)
+            };
+            
+            if (glyph.mSize.x > 0 && glyph.mSize.y > 0) {
+                glyphImages.push_back(CreateGlyphImage(bitmap, downscale));
+                glyph.mSubTextureIndex = subTextureIndex;
+                ++subTextureIndex;
+                
+                if (downscale > 0) {
+                    auto distanceFieldSize = glyphImages.back()->GetSize();
+                    glyph.mSize = IVec2 {
+                        distanceFieldSize.x * downscale,
+                        distanceFieldSize.y * downscale
+                    };
+                    glyph.mBearing += IVec2 {-border, border};
+                }
+            }
+            
+            bakedFont.mGlyphs.push_back(glyph);
+        }
+        
+        FT_Done_Face(face);
+        FT_Done_FreeType(ft);
+        
+        bakedFont.mPixelSize = pixelSize;
+        bakedFont.mDistanceFieldSpread = border;
+        bakedFont.mTextureAtlas = std::make_unique<TextureAtlas>();
+        bakedFont.mAtlasImage = bakedFont.mTextureAtlas->CreateAtlasImage(glyphImages,
+                                                                          textureAtlasConfig);
+        return bakedFont.mAtlasImage != nullptr;
+    }
+}
+
+const TextureAtlasConfig& FontBaker::GetTextureAtlasConfig() {
+    return textureAtlasConfig;
+}
+
+const DistanceFieldConfig& FontBaker::GetDistanceFieldConfig() {
+    return distanceFieldConfig;
+}
+
+std::string FontBaker::ToBakedFilename(const std::string& fontFilename, int size) {
+    auto baseName = fontFilename.substr(0, fontFilename.find_last_of('.'));
+    return baseName + "_" + std::to_string(size) + bakedFontSuffix;
+}
+
+std::string FontBaker::ToBakedDistanceFieldFilename(const std::string& fontFilename) {
+    auto baseName = fontFilename.substr(0, fontFilename.find_last_of('.'));
+    return baseName + distanceFieldSuffix + bakedFontSuffix;
+}
+
+bool FontBaker::Rasterize(const std::string& fontPath, int size, BakedFont& bakedFont) {
+    return RasterizeGlyphs(fontPath, size, 0, bakedFont);
+}
+
+bool FontBaker::RasterizeDistanceField(const std::string& fontPath, BakedFont& bakedFont) {
+    return RasterizeGlyphs(fontPath,
+                           distanceFieldConfig.mPixelSize,
+                           distanceFieldConfig.mDownscale,
+                           bakedFont);
+}
+
+bool FontBaker::Write(const std::string& filename, const BakedFont& bakedFont) {
+    assert(bakedFont.mTextureAtlas && bakedFont.mAtlasImage);
+    assert(bakedFont.mAtlasImage->GetFormat() == ImageFormat::Alpha);
+    
+    auto& textureAtlas = *bakedFont.mTextureAtlas;
+    auto atlasSize = bakedFont.mAtlasImage->GetSize();
+    
+    Header header {
+        .mVersion = version,
+        .mNumGlyphs = static_cast<uint32_t>(bakedFont.mGlyphs.size()),
+        .mNumSubTextures = static_cast<uint32_t>(textureAtlas.GetNumSubTextures()),
+        .mPixelSize = bakedFont.mPixelSize,
+        .mDistanceFieldSpread = bakedFont.mDistanceFieldSpread,
+        .mAtlasWidth = atlasSize.x,
+        .mAtlasHeight = atlasSize.y
+    };
+    
+    std::memcpy(header.mMagic, magic, sizeof(magic));
+    
+    std::ofstream file {filename, std::ios::binary};
+    if (!file.is_open()) {
+        return false;
+    }
+    
+    WriteValue(file, header);
+    
+    for (auto& glyph: bakedFont.mGlyphs) {
+        GlyphRecord glyphRecord {
+            .mSubTextureIndex = glyph.mSubTextureIndex.HasValue() ?
+                                glyph.mSubTextureIndex.GetValue() : noSubTexture,
+            .mWidth = glyph.mSize.x,
+            .mHeight = glyph.mSize.y,
+            .mBearingX = glyph.mBearing.x,
+            .mBearingY = glyph.mBearing.y,
+            .mAdvance = glyph.mAdvance
+        };
+        
+        WriteValue(file, glyphRecord);
+    }
+    
+    for (auto i = 0; i < textureAtlas.GetNumSubTextures(); ++i) {
+        WriteValue(file, *textureAtlas.GetSubTextureUV(i));
+    }
+    
+    // Only the glyph images are stored, since most of the atlas image is empty.
+    auto* atlasData = static_cast<const char*>(bakedFont.mAtlasImage->GetImageData());
+    
+    for (auto i = 0; i < textureAtlas.GetNumSubTextures(); ++i) {
+        auto& subTextureUV = *textureAtlas.GetSubTextureUV(i);
+        auto subTextureSize = CalcSubTextureSize(subTextureUV, atlasSize);
+        auto topLeft = CalcSubTextureTopLeftPixel(subTextureUV, subTextureSize, atlasSize);
+        for (auto row = 0; row < subTextureSize.y; ++row) {
+            file.write(atlasData + (topLeft.y + row) * atlasSize.x + topLeft.x, subTextureSize.x);
+        }
+    }
+    
+    return static_cast<bool>(file);
+}
+
+bool FontBaker::Read(const std::string& filename, BakedFont& bakedFont) {
+    std::ifstream file {filename, std::ios::binary | std::ios::ate};
+    if (!file.is_open()) {
+        return false;
+    }
+    
+    auto fileSize = static_cast<size_t>(file.tellg());
+    if (fileSize < sizeof(Header)) {
+        return false;
+    }
+    
+    std::vector<char> buffer(fileSize);
+    file.seekg(0);
+    file.read(buffer.data(), fileSize);
+    
+    Header header;
+    const char* read = ReadValue(buffer.data(), header);
+    if (!file || !IsValid(header, fileSize)) {
+        return false;
+    }
+    
+    bakedFont.mGlyphs.resize(header.mNumGlyphs);
+    for (auto& glyph: bakedFont.mGlyphs) {
+        GlyphRecord glyphRecord;
+        read = ReadValue(read, glyphRecord);
+        
+        glyph.mSubTextureIndex = glyphRecord.mSubTextureIndex == noSubTexture ?
+                                 Optional<int> {} :
+                                 Optional<int> {glyphRecord.mSubTextureIndex};
+        glyph.mSize = IVec2 {glyphRecord.mWidth, glyphRecord.mHeight};
+        glyph.mBearing = IVec2 {glyphRecord.mBearingX, glyphRecord.mBearingY};
+        glyph.mAdvance = glyphRecord.mAdvance;
+    }
+    
+    std::vector<SubTextureUV> subTextureUVs(header.mNumSubTextures);
+    for (auto& subTextureUV: subTextureUVs) {
+        read = ReadValue(read, subTextureUV);
+    }
+    
+    IVec2 atlasSize {header.mAtlasWidth, header.mAtlasHeight};
+    std::vector<IVec2> subTextureSizes;
+    subTextureSizes.reserve(subTextureUVs.size());
+    auto numPixels = 0;
+    
+    for (auto& subTextureUV: subTextureUVs) {
+        auto subTextureSize = CalcSubTextureSize(subTextureUV, atlasSize);
+        numPixels += subTextureSize.x * subTextureSize.y;
+        subTextureSizes.push_back(subTextureSize);
+    }
+    
+    if (fileSize != CalcMetricsSize(header) + numPixels) {
+        return false;
+    }
+    
+    auto atlasImage = std::make_unique<BitmapImage>(ImageFormat::Alpha, atlasSize);
+    
+    for (auto i = 0; i < subTextureUVs.size(); ++i) {
+        auto& subTextureSize = subTextureSizes[i];
+        BitmapImage subTextureImage {
+            reinterpret_cast<const unsigned char*>(read),
+            ImageFormat::Alpha,
+            subTextureSize
+        };
+        
+        // BitmapImage::Insert takes the position of the bottom left corner.
+        auto topLeft = CalcSubTextureTopLeftPixel(subTextureUVs[i], subTextureSize, atlasSize);
+        atlasImage->Insert(subTextureImage,
+                           IVec2 {topLeft.x, atlasSize.y - topLeft.y - subTextureSize.y});
+        read += subTextureSize.x * subTextureSize.y;
+    }
+    
+    bakedFont.mPixelSize = header.mPixelSize;
+    bakedFont.mDistanceFieldSpread = header.mDistanceFieldSpread;
+    bakedFont.mTextureAtlas = std::make_unique<TextureAtlas>(subTextureUVs);
+    bakedFont.mAtlasImage = std::move(atlasImage);
+    return true;
+}
@@ -0,0 +1,50 @@
+#ifndef FontBaker_hpp
+#define FontBaker_hpp
+
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "Font.hpp"
+#include "TextureAtlas.hpp"
+
+namespace Pht {
+    class IImage;
+    
+    struct BakedFont {
+        // The pixel size that the glyph metrics are in.
+        int mPixelSize {0};
+        
+        // The distance from the outline in the glyph metric pixels at which the values of a
+        // distance field font reach 0 or 1, or zero for a bitmap font.
+        int mDistanceFieldSpread {0};
+        std::vector<Font::Glyph> mGlyphs;
+        std::unique_ptr<TextureAtlas> mTextureAtlas;
+        std::unique_ptr<IImage> mAtlasImage;
+    };
+    
+    struct DistanceFieldConfig {
+        int mPixelSize {0};
+        int mDownscale {1};
+        int mSpread {0};
+    };
+    
+    // A baked font file contains the glyph metrics, the sub texture UVs and the alpha atlas image
+    // of one font at one pixel size, as rasterized by FreeType, so that loading a font does not
+    // have to rasterize and pack the glyphs. A distance field font stores signed distance fields
+    // of the glyphs instead of their coverage, which can be rendered at any size.
+    namespace FontBaker {
+        const TextureAtlasConfig& GetTextureAtlasConfig();
+        const DistanceFieldConfig& GetDistanceFieldConfig();
+        std::string ToBakedFilename(const std::string& fontFilename, int size);
+        std::string ToBakedDistanceFieldFilename(const std::string& fontFilename);
+        bool Rasterize(const std::string& fontPath, int size, BakedFont& bakedFont);
+        bool RasterizeDistanceField(const std::string& fontPath, BakedFont& bakedFont);
+        bool Write(const std::string& filename, const BakedFont& bakedFont);
+        
+        // Returns false if the file does not exist or has another version.
+        bool Read(const std::string& filename, BakedFont& bakedFont);
+    }
+}
+
+#endif
@@ -0,0 +1,117 @@
+#include "TextLayout.hpp"
+
+#include "TextureCache.hpp"
+#include "Profiler.hpp"
+
+using namespace Pht;
+
+void TextLayout::Update(const std::string& text, const TextProperties& properties, float slant) {
+    if (IsUpToDate(text, properties, slant)) {
+        return;
+    }
+    
+    PHT_PROFILE_ZONE("TextLayout::Update");
+    
+    auto& font = properties.mFont;
+    mText = text;
+    mFont = &font;
+    mScale = properties.mScale;
+    mSlant = slant;
+    mAlignment = properties.mAlignment;
+    mGlyphQuads.clear();
+    
+    auto* texture = font.GetTexture();
+    if (texture == nullptr) {
+        assert(texture);
+        return;
+    }
+    
+    auto* textureAtlas = texture->GetAtlas();
+    if (textureAtlas == nullptr) {
+        assert(textureAtlas);
+        return;
+    }
+    
+    auto scale = properties.mScale * font.GetGlyphScale();
+    Vec2 position {0.0f, 0.0f};
+    
+    switch (properties.mAlignment) {
+        case TextAlignment::Left:
+            break;
+        case TextAlignment::CenterX:
+            if (auto* firstGlyph = text.empty() ? nullptr : font.GetGlyph(text.front())) {
+                position.x = -firstGlyph->mBearing.x * scale -
+                             CalculateTextWidth(text, properties) / 2.0f;
+            }
+            break;
+    }
+    
+    for (auto c: text) {
+        auto* glyph = font.GetGlyph(c);
+        if (glyph == nullptr) {
+            continue;
+        }
+        
+        Vec2 bottomLeft {
+            position.x + glyph->mBearing.x * scale,
+            position.y - (glyph->mSize.y - glyph->mBearing.y) * scale
+        };
+        
+        position.x += (glyph->mAdvance >> 6) * scale;
+        
+        auto textureIndex = glyph->mSubTextureIndex;
+        if (!textureIndex.HasValue()) {
+            continue;
+        }
+        
+        auto* uv = textureAtlas->GetSubTextureUV(textureIndex.GetValue());
+        if (uv == nullptr) {
+            continue;
+        }
+        
+        GlyphQuad glyphQuad {
+            .mBottomLeft = bottomLeft,
+            .mSize = {glyph->mSize.x * scale, glyph->mSize.y * scale},
+            .mUV = *uv
+        };
+        
+        mGlyphQuads.push_back(glyphQuad);
+    }
+}
+
+bool TextLayout::IsUpToDate(const std::string& text,
+                            const TextProperties& properties,
+                            float slant) {
+    return mFont == &properties.mFont && mScale == properties.mScale && mSlant == slant &&
+           mAlignment == properties.mAlignment && mText == text;
+}
+
+float TextLayout::CalculateTextWidth(const std::string& text, const TextProperties& properties) {
+    if (text.empty()) {
+        return 0.0f;
+    }
+    
+    auto& font = properties.mFont;
+    auto x = 0.0f;
+    auto textStartX = x;
+    for (auto i = 0; i < text.size(); ++i) {
+        auto* glyph = font.GetGlyph(text[i]);
+        if (glyph == nullptr) {
+            return 0.0f;
+        }
+        
+        if (i == 0) {
+            textStartX = glyph->mBearing.x;
+        }
+        
+        if (i == text.size() - 1) {
+            x += glyph->mBearing.x + glyph->mSize.x;
+            break;
+        }
+        
+        x += glyph->mAdvance >> 6;
+    }
+    
+    return (x - textStartX) * properties.mScale * font.GetGlyphScale() +
+           mSlant * properties.mScale;
+}
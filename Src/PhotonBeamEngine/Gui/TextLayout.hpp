@@ -0,0 +1,45 @@
+#ifndef TextLayout_hpp
+#define TextLayout_hpp
+
+#include <string>
+#include <vector>
+
+#include "Font.hpp"
+#include "TextureAtlas.hpp"
+
+namespace Pht {
+    // The quads of the glyphs of a text in pixels relative to the position of the text. The
+    // layout is only rebuilt when the text, font, scale, slant or alignment has changed, so a text
+    // that does not change is laid out once even though it is rendered every frame.
+    class TextLayout {
+    public:
+        struct GlyphQuad {
+            Vec2 mBottomLeft;
+            Vec2 mSize;
+            SubTextureUV mUV;
+        };
+        
+        void Update(const std::string& text, const TextProperties& properties, float slant);
+        
+        const std::vector<GlyphQuad>& GetGlyphQuads() const {
+            return mGlyphQuads;
+        }
+        
+        float GetSlant() const {
+            return mSlant;
+        }
+    
+    private:
+        bool IsUpToDate(const std::string& text, const TextProperties& properties, float slant);
+        float CalculateTextWidth(const std::string& text, const TextProperties& properties);
+        
+        std::string mText;
+        const Font* mFont {nullptr};
+        float mScale {0.0f};
+        float mSlant {0.0f};
+        TextAlignment mAlignment {TextAlignment::Left};
+        std::vector<GlyphQuad> mGlyphQuads;
+    };
+}
+
+#endif
@@ -1,5 +1,7 @@
 #include "VertexBuffer.hpp"
 
+#include <assert.h>
+
 using namespace Pht;
 
 VertexBuffer::VertexBuffer(int vertexCapacity, int indexCapacity, const VertexFlags& attributeFlags) :
@@ -126,6 +128,54 @@ void VertexBuffer::AddIndex(uint16_t index) {
     ++mNumIndices;
 }
 
+float* VertexBuffer::AppendVertices(int numVertices) {
+    auto newSize = GetVertexBufferSize() + numVertices * mFloatsPerVertex;
+    if (newSize > GetVertexBufferCapacity()) {
+        ReallocateVertexBuffer(newSize);
+    }
+    
+    auto* vertices = mVertexWritePtr;
+    mVertexWritePtr += numVertices * mFloatsPerVertex;
+    mNumVertices += numVertices;
+    return vertices;
+}
+
+uint16_t* VertexBuffer::AppendIndices(int numIndices) {
+    auto newSize = GetIndexBufferSize() + numIndices;
+    if (newSize > GetIndexBufferCapacity()) {
+        ReallocateIndexBuffer(newSize);
+    }
+    
+    auto* indices = mIndexWritePtr;
+    mIndexWritePtr += numIndices;
+    mNumIndices += numIndices;
+    return indices;
+}
+
+void VertexBuffer::AppendQuadIndices(int numQuads) {
+    auto newSize = GetIndexBufferSize() + numQuads * 6;
+    if (newSize > GetIndexBufferCapacity()) {
+        ReallocateIndexBuffer(newSize);
+    }
+    
+    // The quads are the last vertices in the buffer, four vertices each in counter-clockwise order.
+    auto* indexWrite = mIndexWritePtr;
+    auto firstVertex = mNumVertices - numQuads * 4;
+    
+    for (auto i = 0; i < numQuads; ++i) {
+        auto quadFirstVertex = static_cast<uint16_t>(firstVertex + i * 4);
+        *indexWrite++ = quadFirstVertex;
+        *indexWrite++ = quadFirstVertex + 1;
+        *indexWrite++ = quadFirstVertex + 2;
+        *indexWrite++ = quadFirstVertex + 2;
+        *indexWrite++ = quadFirstVertex + 3;
+        *indexWrite++ = quadFirstVertex;
+    }
+    
+    mIndexWritePtr = indexWrite;
+    mNumIndices += numQuads * 6;
+}
+
 const float* VertexBuffer::GetVertexBuffer() const {
     return mVertexBuffer.data();
 }
@@ -38,6 +38,9 @@ namespace Pht {
         void Write(const Vec3& position, const Vec2& textureCoord, const Vec4& color);
         void Write(const Vec3& position, const Vec4& color, float pointSize = 0);
         void AddIndex(uint16_t index);
+        float* AppendVertices(int numVertices);
+        uint16_t* AppendIndices(int numIndices);
+        void AppendQuadIndices(int numQuads);
         const float* GetVertexBuffer() const;
         const uint16_t* GetIndexBuffer() const;
         int GetVertexBufferSize() const;
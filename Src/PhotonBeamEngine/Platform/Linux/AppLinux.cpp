@@ -0,0 +1,36 @@
+#include "App.hpp"
+
+#include <fstream>
+
+#include "FileSystem.hpp"
+
+// The launch is remembered in a marker file in the synced app home directory, like in the user
+// defaults on iOS.
+namespace {
+    const std::string launchedBeforeFilename {"launched_before.dat"};
+    
+    auto isChecked = false;
+    auto isFirstLaunch = false;
+}
+
+namespace Pht {
+    namespace App {
+        bool IsFirstLaunch() {
+            if (isChecked) {
+                return isFirstLaunch;
+            }
+            
+            isChecked = true;
+            
+            auto fullPath = FileSystem::GetSyncedAppHomeDirectory() + "/" + launchedBeforeFilename;
+            if (std::ifstream {fullPath}.is_open()) {
+                isFirstLaunch = false;
+            } else {
+                std::ofstream {fullPath};
+                isFirstLaunch = true;
+            }
+            
+            return isFirstLaunch;
+        }
+    }
+}
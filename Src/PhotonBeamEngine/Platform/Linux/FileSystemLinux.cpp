@@ -0,0 +1,34 @@
+#include "FileSystem.hpp"
+#include "FileSystemLinux.hpp"
+
+#include <cstdlib>
+
+namespace {
+    std::string resourceDirectory {"."};
+    std::string syncedAppHomeDirectory;
+}
+
+namespace Pht {
+    namespace FileSystem {
+        void SetResourceDirectory(const std::string& directory) {
+            resourceDirectory = directory;
+        }
+        
+        std::string GetResourceDirectory() {
+            return resourceDirectory;
+        }
+        
+        void SetSyncedAppHomeDirectory(const std::string& directory) {
+            syncedAppHomeDirectory = directory;
+        }
+        
+        std::string GetSyncedAppHomeDirectory() {
+            if (!syncedAppHomeDirectory.empty()) {
+                return syncedAppHomeDirectory;
+            }
+            
+            auto* homeDirectory = std::getenv("HOME");
+            return homeDirectory ? homeDirectory : ".";
+        }
+    }
+}
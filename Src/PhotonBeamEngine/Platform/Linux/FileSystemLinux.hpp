@@ -0,0 +1,18 @@
+#ifndef FileSystemLinux_hpp
+#define FileSystemLinux_hpp
+
+#include <string>
+
+namespace Pht {
+    namespace FileSystem {
+        // There is no application bundle on Linux so the tools set the resource directory
+        // explicitly. It defaults to the current working directory.
+        void SetResourceDirectory(const std::string& directory);
+        
+        // The user data of the game is stored in the home directory unless another directory is
+        // set.
+        void SetSyncedAppHomeDirectory(const std::string& directory);
+    }
+}
+
+#endif
@@ -0,0 +1,10 @@
+#include "NetworkStatus.hpp"
+
+namespace Pht {
+    namespace NetworkStatus {
+        // There is no store to connect to in the headless builds.
+        bool IsConnected() {
+            return false;
+        }
+    }
+}
@@ -0,0 +1,27 @@
+#include "PurchasingFactory.hpp"
+
+using namespace Pht;
+
+// Headless builds have no store. Product requests and purchases are never answered, which the game
+// handles as it does for a store that does not respond.
+namespace {
+    class NullPurchasing: public IPurchasing {
+    public:
+        void FetchProducts(const std::vector<std::string>& productIds) override {}
+        void StartPurchase(const std::string& productId) override {}
+        
+        bool HasEvents() const override {
+            return false;
+        }
+        
+        std::unique_ptr<PurchaseEvent> PopNextEvent() override {
+            return nullptr;
+        }
+        
+        void FinishTransaction(const std::string& productId) override {}
+    };
+}
+
+std::unique_ptr<IPurchasing> Pht::CreatePurchasingApi() {
+    return std::make_unique<NullPurchasing>();
+}
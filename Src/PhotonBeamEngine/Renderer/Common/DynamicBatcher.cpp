@@ -0,0 +1,182 @@
+#include "DynamicBatcher.hpp"
+
+#include <assert.h>
+
+#include "SceneObject.hpp"
+#include "RenderableObject.hpp"
+#include "VertexBuffer.hpp"
+
+using namespace Pht;
+
+// Definitions of the limits, which are passed by reference.
+constexpr int DynamicBatcher::maxNumBatchVertices;
+constexpr int DynamicBatcher::maxNumBatchIndices;
+constexpr int DynamicBatcher::maxNumBatchableIndices;
+
+namespace {
+    // Pseudo costs relative to the cost of a draw call.
+    constexpr auto drawCallCost = 1.0f;
+    constexpr auto transformUniformsCost = 0.5f;
+    constexpr auto vboChangeCost = 0.5f;
+    constexpr auto batchUploadCost = 1.0f;
+    constexpr auto vertexCost = 0.02f;
+
+    const VertexBuffer* GetCpuSideBuffer(const RenderQueue::Entry& entry) {
+        return entry.mSceneObject->GetRenderable()->GetGpuVertexBuffer().GetCpuSideBuffer();
+    }
+
+    bool IsRotated(const Mat4& matrix) {
+        return matrix.x.y != 0.0f || matrix.x.z != 0.0f || matrix.y.x != 0.0f ||
+               matrix.y.z != 0.0f || matrix.z.x != 0.0f || matrix.z.y != 0.0f;
+    }
+}
+
+bool DynamicBatcher::IsWorthBatching(const RunCost& runCost) {
+    if (runCost.mNumDraws <= 1) {
+        return false;
+    }
+
+    auto savedCost = (runCost.mNumDraws - 1) * (drawCallCost + transformUniformsCost) +
+                     (runCost.mNumVboChanges - 1) * vboChangeCost;
+    auto batchCost = runCost.mNumVertices * vertexCost + batchUploadCost;
+    return savedCost > batchCost;
+}
+
+bool DynamicBatcher::IsBatchable(const RenderQueue::Entry& entry) {
+    if (entry.GetTextKind() != RenderQueue::TextKind::None) {
+        return false;
+    }
+
+    auto& sceneObject = *entry.mSceneObject;
+    auto* renderable = sceneObject.GetRenderable();
+    if (renderable == nullptr || renderable->GetRenderMode() != RenderMode::Triangles) {
+        return false;
+    }
+
+    auto* cpuSideBuffer = renderable->GetGpuVertexBuffer().GetCpuSideBuffer();
+    if (cpuSideBuffer == nullptr || cpuSideBuffer->GetNumIndices() > maxNumBatchableIndices) {
+        return false;
+    }
+
+    return !IsRotated(sceneObject.GetMatrix());
+}
+
+bool DynamicBatcher::CanBeBatchedTogether(const RenderQueue::Entry& first,
+                                          const RenderQueue::Entry& other) {
+    if (!IsBatchable(other) || first.IsDepthWriting() != other.IsDepthWriting()) {
+        return false;
+    }
+
+    auto& firstMaterial = first.mSceneObject->GetRenderable()->GetMaterial();
+    auto& otherMaterial = other.mSceneObject->GetRenderable()->GetMaterial();
+    if (!firstMaterial.Equals(otherMaterial) ||
+        firstMaterial.GetShaderId() != otherMaterial.GetShaderId()) {
+
+        return false;
+    }
+
+    return GetCpuSideBuffer(first)->GetAttributeFlags() ==
+           GetCpuSideBuffer(other)->GetAttributeFlags();
+}
+
+void DynamicBatcher::Plan(RenderQueue& renderQueue) {
+    mEntries.clear();
+    mDrawItems.clear();
+
+    for (renderQueue.BeginIteration(); renderQueue.HasMoreEntries();) {
+        mEntries.push_back(&renderQueue.GetNextEntry());
+    }
+
+    auto numEntries = static_cast<int>(mEntries.size());
+    auto beginIndex = 0;
+
+    while (beginIndex < numEntries) {
+        auto& first = *mEntries[beginIndex];
+        if (!IsBatchable(first)) {
+            mDrawItems.push_back(DrawItem {beginIndex, 1});
+            ++beginIndex;
+            continue;
+        }
+
+        // Scan ahead over the entries that could go into the same batch.
+        auto* firstBuffer = GetCpuSideBuffer(first);
+        RunCost runCost {1, 1, firstBuffer->GetNumVertices()};
+        auto numIndices = firstBuffer->GetNumIndices();
+        auto* previousBuffer = &first.mSceneObject->GetRenderable()->GetGpuVertexBuffer();
+        auto endIndex = beginIndex + 1;
+
+        for (; endIndex < numEntries; ++endIndex) {
+            auto& entry = *mEntries[endIndex];
+            if (!CanBeBatchedTogether(first, entry)) {
+                break;
+            }
+
+            auto* cpuSideBuffer = GetCpuSideBuffer(entry);
+            if (runCost.mNumVertices + cpuSideBuffer->GetNumVertices() > maxNumBatchVertices ||
+                numIndices + cpuSideBuffer->GetNumIndices() > maxNumBatchIndices) {
+                break;
+            }
+
+            auto* gpuVertexBuffer = &entry.mSceneObject->GetRenderable()->GetGpuVertexBuffer();
+            if (gpuVertexBuffer != previousBuffer) {
+                ++runCost.mNumVboChanges;
+                previousBuffer = gpuVertexBuffer;
+            }
+
+            ++runCost.mNumDraws;
+            runCost.mNumVertices += cpuSideBuffer->GetNumVertices();
+            numIndices += cpuSideBuffer->GetNumIndices();
+        }
+
+        PlanRun(beginIndex, endIndex, runCost);
+        beginIndex = endIndex;
+    }
+}
+
+void DynamicBatcher::PlanRun(int beginIndex, int endIndex, const RunCost& runCost) {
+    if (IsWorthBatching(runCost)) {
+        mDrawItems.push_back(DrawItem {beginIndex, endIndex - beginIndex});
+        return;
+    }
+
+    for (auto i = beginIndex; i < endIndex; ++i) {
+        mDrawItems.push_back(DrawItem {i, 1});
+    }
+}
+
+const VertexBuffer& DynamicBatcher::WriteBatch(const DrawItem& drawItem) {
+    assert(drawItem.IsBatch());
+
+    auto& first = *mEntries[drawItem.mFirstEntryIndex];
+    auto& batchVertexBuffer = GetBatchVertexBuffer(GetCpuSideBuffer(first)->GetAttributeFlags());
+    batchVertexBuffer.Reset();
+
+    // The entries are written in queue order, so the batch keeps the draw order of the queue.
+    auto endIndex = drawItem.mFirstEntryIndex + drawItem.mNumEntries;
+    for (auto i = drawItem.mFirstEntryIndex; i < endIndex; ++i) {
+        auto& entry = *mEntries[i];
+        auto& matrix = entry.mSceneObject->GetMatrix();
+        Vec3 translation {matrix.w.x, matrix.w.y, matrix.w.z};
+        Vec3 scale {matrix.x.x, matrix.y.y, matrix.z.z};
+        batchVertexBuffer.TransformAndAppendVertices(*GetCpuSideBuffer(entry), translation, scale);
+    }
+
+    return batchVertexBuffer;
+}
+
+const Material& DynamicBatcher::GetBatchMaterial(const DrawItem& drawItem) const {
+    return mEntries[drawItem.mFirstEntryIndex]->mSceneObject->GetRenderable()->GetMaterial();
+}
+
+VertexBuffer& DynamicBatcher::GetBatchVertexBuffer(const VertexFlags& attributeFlags) {
+    for (auto& vertexBuffer: mBatchVertexBuffers) {
+        if (vertexBuffer->GetAttributeFlags() == attributeFlags) {
+            return *vertexBuffer;
+        }
+    }
+
+    mBatchVertexBuffers.push_back(std::make_unique<VertexBuffer>(maxNumBatchVertices,
+                                                                 maxNumBatchIndices,
+                                                                 attributeFlags));
+    return *mBatchVertexBuffers.back();
+}
@@ -0,0 +1,67 @@
+#ifndef DynamicBatcher_hpp
+#define DynamicBatcher_hpp
+
+#include <vector>
+#include <memory>
+
+#include "RenderQueue.hpp"
+
+namespace Pht {
+    class VertexBuffer;
+    class Material;
+    struct VertexFlags;
+
+    // Merges runs of consecutive render queue entries that share material and have few indices and
+    // no rotation into one vertex buffer in world space, if the estimated cost of the eliminated
+    // draw calls and state changes is greater than the cost of building the batch. Only CPU-side
+    // vertex buffers are read and written, so the batching decisions do not depend on the graphics
+    // API.
+    class DynamicBatcher {
+    public:
+        struct DrawItem {
+            int mFirstEntryIndex {0};
+            int mNumEntries {1};
+
+            bool IsBatch() const {
+                return mNumEntries > 1;
+            }
+        };
+
+        struct RunCost {
+            int mNumDraws {0};
+            int mNumVboChanges {0};
+            int mNumVertices {0};
+        };
+
+        static constexpr int maxNumBatchVertices {16384};
+        static constexpr int maxNumBatchIndices {32768};
+        static constexpr int maxNumBatchableIndices {256};
+
+        static bool IsWorthBatching(const RunCost& runCost);
+        static bool IsBatchable(const RenderQueue::Entry& entry);
+        static bool CanBeBatchedTogether(const RenderQueue::Entry& first,
+                                         const RenderQueue::Entry& other);
+
+        void Plan(RenderQueue& renderQueue);
+        const VertexBuffer& WriteBatch(const DrawItem& drawItem);
+        const Material& GetBatchMaterial(const DrawItem& drawItem) const;
+
+        const std::vector<DrawItem>& GetDrawItems() const {
+            return mDrawItems;
+        }
+
+        RenderQueue::Entry& GetEntry(int entryIndex) {
+            return *mEntries[entryIndex];
+        }
+
+    private:
+        void PlanRun(int beginIndex, int endIndex, const RunCost& runCost);
+        VertexBuffer& GetBatchVertexBuffer(const VertexFlags& attributeFlags);
+
+        std::vector<RenderQueue::Entry*> mEntries;
+        std::vector<DrawItem> mDrawItems;
+        std::vector<std::unique_ptr<VertexBuffer>> mBatchVertexBuffers;
+    };
+}
+
+#endif
@@ -2,7 +2,7 @@
 #define IRenderer_hpp
 
 #include "Matrix.hpp"
-#include "Materials.hpp"
+#include "Material.hpp"
 
 namespace Pht {
     enum class ProjectionMode {
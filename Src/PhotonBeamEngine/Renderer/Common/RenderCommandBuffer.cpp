@@ -0,0 +1,134 @@
+#include "RenderCommandBuffer.hpp"
+
+#include "SceneObject.hpp"
+#include "TextComponent.hpp"
+
+using namespace Pht;
+
+namespace {
+    const Mat4 identityMatrix;
+    
+    RenderQueue::TextKind ToTextShaderKind(RenderQueue::TextKind textKind) {
+        switch (textKind) {
+            case RenderQueue::TextKind::Specular:
+            case RenderQueue::TextKind::Shadow:
+            case RenderQueue::TextKind::SecondShadow:
+                return RenderQueue::TextKind::PlainShader;
+            default:
+                return textKind;
+        }
+    }
+    
+    bool IsSameColor(const Optional<Vec3>& a, const Optional<Vec3>& b) {
+        return a.HasValue() == b.HasValue() && (!a.HasValue() || a.GetValue() == b.GetValue());
+    }
+    
+    bool IsInSameTextBatch(const RenderCommand& command, const RenderCommand& previousCommand) {
+        if (previousCommand.mKind != RenderCommand::Kind::Text) {
+            return false;
+        }
+        
+        auto shaderKind = ToTextShaderKind(command.mTextKind);
+        if (shaderKind != ToTextShaderKind(previousCommand.mTextKind)) {
+            return false;
+        }
+        
+        auto& properties = command.mTextComponent->GetProperties();
+        auto& previousProperties = previousCommand.mTextComponent->GetProperties();
+        if (properties.mFont.GetTexture() != previousProperties.mFont.GetTexture()) {
+            return false;
+        }
+        
+        // The gradients are uniforms of the gradient shaders.
+        auto isSameTopGradient = IsSameColor(properties.mTopGradientColorSubtraction,
+                                             previousProperties.mTopGradientColorSubtraction);
+        auto isSameMidGradient = IsSameColor(properties.mMidGradientColorSubtraction,
+                                             previousProperties.mMidGradientColorSubtraction);
+        switch (shaderKind) {
+            case RenderQueue::TextKind::DoubleGradientShader:
+                return isSameTopGradient && isSameMidGradient;
+            case RenderQueue::TextKind::TopGradientShader:
+                return isSameTopGradient;
+            case RenderQueue::TextKind::MidGradientShader:
+                return isSameMidGradient;
+            default:
+                return true;
+        }
+    }
+}
+
+void RenderCommandBuffer::Build(DynamicBatcher& dynamicBatcher,
+                                bool mustRenderDepthWritingObjectsFirst,
+                                const Mat4& viewMatrix,
+                                const Mat4& projectionMatrix) {
+    mCommands.clear();
+    mViewMatrix = viewMatrix;
+    mProjectionMatrix = projectionMatrix;
+    
+    auto depthWrite = true;
+    const RenderQueue::Entry* previousEntry {nullptr};
+
+    for (auto& drawItem: dynamicBatcher.GetDrawItems()) {
+        auto& renderEntry = dynamicBatcher.GetEntry(drawItem.mFirstEntryIndex);
+
+        if (mustRenderDepthWritingObjectsFirst) {
+            if (!renderEntry.IsDepthWriting()) {
+                if (previousEntry == nullptr || previousEntry->IsDepthWriting()) {
+                    // Transition into rendering the transparent objects (non-depth writing).
+                    depthWrite = false;
+                }
+            }
+        } else {
+            depthWrite = renderEntry.IsDepthWriting();
+        }
+        
+        previousEntry = &renderEntry;
+        
+        if (drawItem.IsBatch()) {
+            // The batch vertices are in world space.
+            auto& command = AddCommand(RenderCommand::Kind::Batch, depthWrite);
+            SetTransforms(command, identityMatrix);
+            command.mMaterial = &dynamicBatcher.GetBatchMaterial(drawItem);
+            command.mBatch = drawItem;
+            continue;
+        }
+        
+        auto* sceneObject = renderEntry.mSceneObject;
+        if (auto* renderable = sceneObject->GetRenderable()) {
+            auto& command = AddCommand(RenderCommand::Kind::Object, depthWrite);
+            SetTransforms(command, sceneObject->GetMatrix());
+            command.mMaterial = &renderable->GetMaterial();
+            command.mVbo = &renderable->GetGpuVertexBuffer();
+            command.mRenderMode = renderable->GetRenderMode();
+        }
+        
+        auto textKind = renderEntry.GetTextKind();
+        if (textKind != RenderQueue::TextKind::None) {
+            if (auto* textComponent = sceneObject->GetComponent<TextComponent>()) {
+                auto& command = AddCommand(RenderCommand::Kind::Text, depthWrite);
+                command.mTextComponent = textComponent;
+                command.mTextKind = textKind;
+                command.mStartsTextBatch =
+                    mCommands.size() == 1 ||
+                    !IsInSameTextBatch(command, mCommands[mCommands.size() - 2]);
+            }
+        }
+    }
+}
+
+RenderCommand& RenderCommandBuffer::AddCommand(RenderCommand::Kind kind, bool depthWrite) {
+    mCommands.emplace_back();
+    auto& command = mCommands.back();
+    command.mKind = kind;
+    command.mDepthWrite = depthWrite;
+    return command;
+}
+
+void RenderCommandBuffer::SetTransforms(RenderCommand& command, const Mat4& modelTransform) {
+    // The normal matrix is in camera space. Modelview is orthogonal, so its Inverse-Transpose is
+    // itself.
+    auto modelView = modelTransform * mViewMatrix;
+    command.mModel = modelTransform;
+    command.mModelViewProjection = modelView * mProjectionMatrix;
+    command.mNormalMatrix = modelView.ToMat3();
+}
@@ -0,0 +1,65 @@
+#ifndef RenderCommandBuffer_hpp
+#define RenderCommandBuffer_hpp
+
+#include <vector>
+
+#include "Matrix.hpp"
+#include "RenderableObject.hpp"
+#include "RenderQueue.hpp"
+#include "DynamicBatcher.hpp"
+
+namespace Pht {
+    class TextComponent;
+
+    // A draw of an object, a dynamic batch or a text, with everything the backend needs to issue
+    // it precomputed. The batches reference vertex data that the dynamic batcher writes when the
+    // command is submitted.
+    struct RenderCommand {
+        enum class Kind {
+            Object,
+            Batch,
+            Text
+        };
+
+        Kind mKind {Kind::Object};
+        bool mDepthWrite {true};
+        Mat4 mModel;
+        Mat4 mModelViewProjection;
+        Mat3 mNormalMatrix;
+        const Material* mMaterial {nullptr};
+        const GpuVertexBuffer* mVbo {nullptr};
+        RenderMode mRenderMode {RenderMode::Triangles};
+        DynamicBatcher::DrawItem mBatch;
+        const TextComponent* mTextComponent {nullptr};
+        RenderQueue::TextKind mTextKind {RenderQueue::TextKind::None};
+        
+        // Consecutive texts that use the same text shader, font texture and gradient are drawn
+        // together, and this is set on the first text of each such batch.
+        bool mStartsTextBatch {false};
+    };
+
+    // The draws of a render pass in submission order. Building the buffer only reads the scene and
+    // the render queue, so it does not depend on the graphics API and a backend only has to replay
+    // the commands.
+    class RenderCommandBuffer {
+    public:
+        void Build(DynamicBatcher& dynamicBatcher,
+                   bool mustRenderDepthWritingObjectsFirst,
+                   const Mat4& viewMatrix,
+                   const Mat4& projectionMatrix);
+
+        const std::vector<RenderCommand>& GetCommands() const {
+            return mCommands;
+        }
+
+    private:
+        RenderCommand& AddCommand(RenderCommand::Kind kind, bool depthWrite);
+        void SetTransforms(RenderCommand& command, const Mat4& modelTransform);
+
+        std::vector<RenderCommand> mCommands;
+        Mat4 mViewMatrix;
+        Mat4 mProjectionMatrix;
+    };
+}
+
+#endif
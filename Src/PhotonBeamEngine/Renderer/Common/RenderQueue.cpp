@@ -2,54 +2,74 @@
 
 #include <assert.h>
 #include <algorithm>
+#include <cstring>
 
 #include "SceneObject.hpp"
 #include "TextComponent.hpp"
+#include "Profiler.hpp"
 
 using namespace Pht;
 
 namespace {
     const Vec4 modelSpaceOrigin {0.0f, 0.0f, 0.0f, 1.0f};
 
-    int CalcNumSceneObjects(const SceneObject& sceneObject) {
-        auto numObjects = 1;
+    // A text is queued once for each of its second shadow, shadow and specular layers on top of
+    // the text itself.
+    constexpr auto maxNumTextEntries = 4;
+    
+    int CalcMaxNumEntries(const SceneObject& sceneObject) {
+        auto numEntries = 1;
+        if (sceneObject.GetComponent<TextComponent>()) {
+            numEntries += maxNumTextEntries;
+        }
         
         for (auto& child: sceneObject.GetChildren()) {
-            numObjects += CalcNumSceneObjects(*child);
+            numEntries += CalcMaxNumEntries(*child);
         }
         
-        return numObjects;
+        return numEntries;
     }
     
-    struct CompareEntriesBySortKeyAndFrontToBack {
-        inline bool operator() (const RenderQueue::Entry& a, const RenderQueue::Entry& b) {
-            if (a.mSortKey == b.mSortKey) {
-                return a.mDistance < b.mDistance;
-            }
+    // Partitions with at most this many entries, or with at most one out of order neighbour per
+    // this many entries, are sorted with insertion sort instead of radix sort.
+    constexpr auto maxNumInsertionSortItems = 32;
+    constexpr auto minNumItemsPerDescent = 32;
     
-            return a.mSortKey > b.mSortKey;
+    constexpr auto radixBits = 8;
+    constexpr auto radixSize = 1 << radixBits;
+    constexpr auto numSecondaryKeyDigits = 4;
+    constexpr auto numDigits = numSecondaryKeyDigits + 8;
+    
+    // Maps a float to an unsigned integer with the same order.
+    uint32_t ToOrderedBits(float value) {
+        if (value == 0.0f) {
+            // Do not separate -0 from 0.
+            value = 0.0f;
         }
-    };
-
-    struct CompareEntriesFrontToBack {
-        inline bool operator() (const RenderQueue::Entry& a, const RenderQueue::Entry& b) {
-            if (a.mDistance == b.mDistance) {
-                return a.mSortKey > b.mSortKey;
-            }
+        
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return (bits & 0x80000000u) ? ~bits : bits | 0x80000000u;
+    }
     
-            return a.mDistance < b.mDistance;
+    bool IsLess(const RenderQueue::SortItem& a, const RenderQueue::SortItem& b) {
+        if (a.mPrimaryKey == b.mPrimaryKey) {
+            return a.mSecondaryKey < b.mSecondaryKey;
         }
-    };
+        
+        return a.mPrimaryKey < b.mPrimaryKey;
+    }
     
-    struct CompareEntriesBackToFront {
-        inline bool operator() (const RenderQueue::Entry& a, const RenderQueue::Entry& b) {
-            if (a.mDistance == b.mDistance) {
-                return a.mSortKey > b.mSortKey;
-            }
-            
-            return a.mDistance > b.mDistance;
+    // The digits are numbered from the least significant digit of the secondary key to the most
+    // significant digit of the primary key.
+    int GetDigit(const RenderQueue::SortItem& item, int digitIndex) {
+        if (digitIndex < numSecondaryKeyDigits) {
+            return (item.mSecondaryKey >> (digitIndex * radixBits)) & (radixSize - 1);
         }
-    };
+        
+        auto shift = (digitIndex - numSecondaryKeyDigits) * radixBits;
+        return static_cast<int>((item.mPrimaryKey >> shift) & (radixSize - 1));
+    }
     
     RenderQueue::TextKind ToTextShaderKind(const TextProperties& textProperties) {
         if (textProperties.mTopGradientColorSubtraction.HasValue() &&
@@ -72,59 +92,223 @@ namespace {
 
 void RenderQueue::Init(const SceneObject& rootSceneObject) {
     mRootSceneObject = &rootSceneObject;
-    auto numSceneObjects = CalcNumSceneObjects(rootSceneObject);
-    mQueue.resize(numSceneObjects);
-    mMaxSize = numSceneObjects;
+    auto maxNumEntries = CalcMaxNumEntries(rootSceneObject);
+    mQueue.resize(maxNumEntries);
+    mMaxSize = maxNumEntries;
+    mViews.clear();
 }
 
 void RenderQueue::Build(const Mat4& viewMatrix,
                         RenderOrder renderOrder,
                         DistanceFunction distanceFunction,
                         int layerMask) {
+    PHT_PROFILE_ZONE("RenderQueue::Build");
+    
     mFirstPartitionSize = 0;
     mSecondPartitionSize = 0;
     mRenderOrder = renderOrder;
-    mLayerMask = layerMask;
 
-    assert(mRootSceneObject);
-    ScanSubtree(*mRootSceneObject, false);
+    auto& view = GetView(renderOrder, layerMask);
+    auto renderListVersion = SceneObject::GetRenderListVersion();
+    if (!view.mRenderListVersion.HasValue() ||
+        view.mRenderListVersion.GetValue() != renderListVersion) {
+        
+        assert(mRootSceneObject);
+        view.mSceneObjects.clear();
+        CollectSceneObjects(*mRootSceneObject, false, view);
+        view.mRenderListVersion = renderListVersion;
+    }
+    
+    // The entries are created from the collected scene objects on every build since renderables,
+    // materials and text properties can change without changing the render list version.
+    for (auto* sceneObject: view.mSceneObjects) {
+        ScanSceneObject(*sceneObject);
+    }
+    
     CalculateDistances(viewMatrix, distanceFunction);
-    Sort();
+    Sort(view);
     BeginIteration();
 }
 
-void RenderQueue::Sort() {
+RenderQueue::View& RenderQueue::GetView(RenderOrder renderOrder, int layerMask) {
+    for (auto& view: mViews) {
+        if (view.mRenderOrder == renderOrder && view.mLayerMask == layerMask) {
+            return view;
+        }
+    }
+    
+    mViews.emplace_back();
+    auto& view = mViews.back();
+    view.mRenderOrder = renderOrder;
+    view.mLayerMask = layerMask;
+    return view;
+}
+
+void RenderQueue::Sort(View& view) {
+    PHT_PROFILE_ZONE("RenderQueue::Sort");
+    
+    auto secondPartitionBeginIndex = mMaxSize - mSecondPartitionSize;
+    
     switch (mRenderOrder) {
         case RenderOrder::StateOptimized:
             // Sort depth-writing entries based on sort key and compare distances if keys are equal.
-            SortFirstPartition<CompareEntriesBySortKeyAndFrontToBack>();
+            SortPartition(0,
+                          mFirstPartitionSize,
+                          SortOrder::BySortKeyAndFrontToBack,
+                          view.mFirstPartitionOrder);
             // Sort non-depth-writing entries back to front.
-            SortSecondPartition<CompareEntriesBackToFront>();
+            SortPartition(secondPartitionBeginIndex,
+                          mMaxSize,
+                          SortOrder::BackToFront,
+                          view.mSecondPartitionOrder);
             break;
         case RenderOrder::PiexelOptimized:
             // Sort depth-writing entries front to back and check sort keys if distances are equal.
-            SortFirstPartition<CompareEntriesFrontToBack>();
+            SortPartition(0, mFirstPartitionSize, SortOrder::FrontToBack, view.mFirstPartitionOrder);
             // Sort non-depth-writing entries back to front.
-            SortSecondPartition<CompareEntriesBackToFront>();
+            SortPartition(secondPartitionBeginIndex,
+                          mMaxSize,
+                          SortOrder::BackToFront,
+                          view.mSecondPartitionOrder);
             break;
         case RenderOrder::BackToFront:
             // Sort all entries back to front.
-            SortFirstPartition<CompareEntriesBackToFront>();
+            SortPartition(0, mFirstPartitionSize, SortOrder::BackToFront, view.mFirstPartitionOrder);
             break;
     }
 }
 
-template<typename Comparator>
-void RenderQueue::SortFirstPartition() {
-    std::sort(&mQueue[0], &mQueue[mFirstPartitionSize], Comparator{});
+void RenderQueue::SortPartition(int beginIndex,
+                                int endIndex,
+                                SortOrder sortOrder,
+                                std::vector<uint32_t>& lastOrder) {
+    auto numItems = endIndex - beginIndex;
+    if (numItems < 2) {
+        lastOrder.clear();
+        return;
+    }
+    
+    if (static_cast<int>(mSortItems.size()) < numItems) {
+        mSortItems.resize(numItems);
+        mSortItemsBuffer.resize(numItems);
+        mSortedEntries.resize(numItems);
+    }
+    
+    // Pack the sort key and the distance into keys that sort in ascending order. Higher sort keys
+    // render first, so the sort key is inverted. If the partition has as many entries as in the
+    // last build, the entries are most likely the same, so the items are laid out in the last
+    // sorted order, which makes them nearly sorted when only the distances have changed a bit.
+    // Any permutation gives a correct result, so nothing is lost if the entries differ.
+    auto useLastOrder = static_cast<int>(lastOrder.size()) == numItems;
+    auto numDescents = 0;
+    for (auto i = 0; i < numItems; ++i) {
+        auto entryIndex = useLastOrder ? lastOrder[i] : static_cast<uint32_t>(i);
+        auto& entry = mQueue[beginIndex + entryIndex];
+        auto& item = mSortItems[i];
+        auto invertedSortKey = ~entry.mSortKey;
+        
+        switch (sortOrder) {
+            case SortOrder::BySortKeyAndFrontToBack:
+                item.mPrimaryKey = invertedSortKey;
+                item.mSecondaryKey = ToOrderedBits(entry.mDistance);
+                break;
+            case SortOrder::FrontToBack:
+                item.mPrimaryKey = (uint64_t{ToOrderedBits(entry.mDistance)} << 32) |
+                                   (invertedSortKey >> 32);
+                item.mSecondaryKey = static_cast<uint32_t>(invertedSortKey);
+                break;
+            case SortOrder::BackToFront:
+                item.mPrimaryKey = (uint64_t{~ToOrderedBits(entry.mDistance)} << 32) |
+                                   (invertedSortKey >> 32);
+                item.mSecondaryKey = static_cast<uint32_t>(invertedSortKey);
+                break;
+        }
+        
+        item.mEntryIndex = entryIndex;
+        
+        if (i > 0 && IsLess(item, mSortItems[i - 1])) {
+            ++numDescents;
+        }
+    }
+    
+    if (numDescents == 0 && !useLastOrder) {
+        lastOrder.clear();
+        return;
+    }
+    
+    if (numDescents > 0) {
+        if (numItems <= maxNumInsertionSortItems ||
+            numDescents * minNumItemsPerDescent <= numItems) {
+            
+            InsertionSort(numItems);
+        } else {
+            RadixSort(numItems);
+        }
+    }
+    
+    lastOrder.resize(numItems);
+    for (auto i = 0; i < numItems; ++i) {
+        auto entryIndex = mSortItems[i].mEntryIndex;
+        lastOrder[i] = entryIndex;
+        mSortedEntries[i] = mQueue[beginIndex + entryIndex];
+    }
+    
+    std::copy(std::begin(mSortedEntries),
+              std::begin(mSortedEntries) + numItems,
+              std::begin(mQueue) + beginIndex);
+}
+
+void RenderQueue::RadixSort(int numItems) {
+    // LSD radix sort with one pass per 8-bit digit. The histograms of all digits are counted in
+    // one pass over the items, and the digits that are the same for all items are skipped, which
+    // is most of the high digits of the sort keys and the distances.
+    int histograms[numDigits][radixSize] {};
+    
+    for (auto i = 0; i < numItems; ++i) {
+        auto& item = mSortItems[i];
+        for (auto digitIndex = 0; digitIndex < numDigits; ++digitIndex) {
+            ++histograms[digitIndex][GetDigit(item, digitIndex)];
+        }
+    }
+    
+    for (auto digitIndex = 0; digitIndex < numDigits; ++digitIndex) {
+        auto& histogram = histograms[digitIndex];
+        if (histogram[GetDigit(mSortItems[0], digitIndex)] == numItems) {
+            continue;
+        }
+        
+        auto offset = 0;
+        for (auto& count: histogram) {
+            auto digitCount = count;
+            count = offset;
+            offset += digitCount;
+        }
+        
+        for (auto i = 0; i < numItems; ++i) {
+            auto& item = mSortItems[i];
+            mSortItemsBuffer[histogram[GetDigit(item, digitIndex)]++] = item;
+        }
+        
+        std::swap(mSortItems, mSortItemsBuffer);
+    }
 }
 
-template<typename Comparator>
-void RenderQueue::SortSecondPartition() {
-    std::sort(&mQueue[mMaxSize - mSecondPartitionSize], &mQueue[mMaxSize], Comparator{});
+void RenderQueue::InsertionSort(int numItems) {
+    for (auto i = 1; i < numItems; ++i) {
+        auto item = mSortItems[i];
+        auto j = i;
+        
+        for (; j > 0 && IsLess(item, mSortItems[j - 1]); --j) {
+            mSortItems[j] = mSortItems[j - 1];
+        }
+        
+        mSortItems[j] = item;
+    }
 }
 
-void RenderQueue::ScanSubtree(const SceneObject& sceneObject, bool ancestorMatchedLayerMask) {
+void RenderQueue::CollectSceneObjects(const SceneObject& sceneObject,
+                                      bool ancestorMatchedLayerMask,
+                                      View& view) {
     if (!sceneObject.IsVisible()) {
         return;
     }
@@ -132,7 +316,7 @@ void RenderQueue::ScanSubtree(const SceneObject& sceneObject, bool ancestorMatch
     auto thisObjectOrAncestorMatchedLayerMask = ancestorMatchedLayerMask;
     auto sceneObjectLayerMask = sceneObject.GetLayerMask();
     if (!ancestorMatchedLayerMask) {
-        if (sceneObjectLayerMask & mLayerMask) {
+        if (sceneObjectLayerMask & view.mLayerMask) {
             thisObjectOrAncestorMatchedLayerMask = true;
         }
     }
@@ -142,11 +326,11 @@ void RenderQueue::ScanSubtree(const SceneObject& sceneObject, bool ancestorMatch
     }
     
     if (thisObjectOrAncestorMatchedLayerMask) {
-        ScanSceneObject(sceneObject);
+        view.mSceneObjects.push_back(&sceneObject);
     }
     
     for (auto& child: sceneObject.GetChildren()) {
-        ScanSubtree(*child, thisObjectOrAncestorMatchedLayerMask);
+        CollectSceneObjects(*child, thisObjectOrAncestorMatchedLayerMask, view);
     }
 }
 
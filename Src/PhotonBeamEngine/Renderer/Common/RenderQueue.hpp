@@ -7,6 +7,7 @@
 #include "Matrix.hpp"
 #include "Scene.hpp"
 #include "RenderPass.hpp"
+#include "Optional.hpp"
 
 namespace Pht {
     class SceneObject;
@@ -56,6 +57,14 @@ namespace Pht {
             }
         };
         
+        // The order of an entry is given by the primary key and then by the secondary key, so the
+        // two keys together work as one 96-bit integer key.
+        struct SortItem {
+            uint64_t mPrimaryKey;
+            uint32_t mSecondaryKey;
+            uint32_t mEntryIndex;
+        };
+        
         void Init(const SceneObject& rootSceneObject);
         void Build(const Mat4& viewMatrix,
                    RenderOrder renderOrder,
@@ -69,27 +78,54 @@ namespace Pht {
         }
 
     private:
-        void Sort();
-        void ScanSubtree(const SceneObject& sceneObject, bool ancestorMatchedLayerMask);
+        // The scene objects that a render pass with a certain layer mask and render order may
+        // render, together with the sorted order of the entries from the last build. The scene
+        // objects are collected again only when the render list version of the scene objects
+        // has changed, and the last sorted order is used as the starting point for the next sort
+        // since the order usually changes very little between frames.
+        struct View {
+            int mLayerMask {0};
+            RenderOrder mRenderOrder {RenderOrder::StateOptimized};
+            Optional<uint32_t> mRenderListVersion;
+            std::vector<const SceneObject*> mSceneObjects;
+            std::vector<uint32_t> mFirstPartitionOrder;
+            std::vector<uint32_t> mSecondPartitionOrder;
+        };
+        
+        View& GetView(RenderOrder renderOrder, int layerMask);
+        void Sort(View& view);
+        void CollectSceneObjects(const SceneObject& sceneObject,
+                                 bool ancestorMatchedLayerMask,
+                                 View& view);
         void ScanSceneObject(const SceneObject& sceneObject);
         void AddEntry(uint64_t sortKey, bool isDepthWriting, const SceneObject& sceneObject);
         void CalculateDistances(const Mat4& viewMatrix, DistanceFunction distanceFunction);
         
-        template<typename Comparator>
-        void SortFirstPartition();
-
-        template<typename Comparator>
-        void SortSecondPartition();
+        enum class SortOrder {
+            BySortKeyAndFrontToBack,
+            FrontToBack,
+            BackToFront
+        };
+        
+        void SortPartition(int beginIndex,
+                           int endIndex,
+                           SortOrder sortOrder,
+                           std::vector<uint32_t>& lastOrder);
+        void RadixSort(int numItems);
+        void InsertionSort(int numItems);
 
         const SceneObject* mRootSceneObject;
         RenderOrder mRenderOrder {RenderOrder::StateOptimized};
-        int mLayerMask {0};
         std::vector<Entry> mQueue;
+        std::vector<View> mViews;
         int mFirstPartitionSize {0};
         int mSecondPartitionSize {0};
         int mMaxSize {0};
         int mIteratorIndex {0};
         int mCurrentPartitionEndIndex {0};
+        std::vector<SortItem> mSortItems;
+        std::vector<SortItem> mSortItemsBuffer;
+        std::vector<Entry> mSortedEntries;
     };
 }
 
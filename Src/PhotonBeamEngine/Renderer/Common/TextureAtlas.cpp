@@ -201,6 +201,9 @@ namespace {
     }
 }
 
+TextureAtlas::TextureAtlas(const std::vector<SubTextureUV>& subTextureUVs) :
+    mSubTextureUVs {subTextureUVs} {}
+
 std::unique_ptr<IImage>
 TextureAtlas::CreateAtlasImage(const SubImages& images,
                                const TextureAtlasConfig& textureAtlasConfig) {
@@ -38,6 +38,9 @@ namespace Pht {
 
     class TextureAtlas {
     public:
+        TextureAtlas() {}
+        explicit TextureAtlas(const std::vector<SubTextureUV>& subTextureUVs);
+        
         std::unique_ptr<IImage> CreateAtlasImage(const SubImages& images,
                                                  const TextureAtlasConfig& textureAtlasConfig);
         
@@ -65,6 +65,10 @@ namespace Pht {
         std::shared_ptr<Texture> GetTextureAtlas(const std::string& name,
                                                  const std::vector<std::unique_ptr<const IImage>>& images,
                                                  const TextureAtlasConfig& textureAtlasConfig);
+        std::shared_ptr<Texture> GetTextureAtlas(const std::string& name,
+                                                 const IImage& atlasImage,
+                                                 std::unique_ptr<TextureAtlas> textureAtlas,
+                                                 const TextureAtlasConfig& textureAtlasConfig);
     }
 }
 
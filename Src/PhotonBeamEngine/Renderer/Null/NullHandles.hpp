@@ -0,0 +1,11 @@
+#ifndef NullHandles_hpp
+#define NullHandles_hpp
+
+namespace Pht {
+    // The null renderer has no graphics API objects to refer to.
+    struct GpuVertexBufferHandles {};
+    
+    struct TextureHandles {};
+}
+
+#endif
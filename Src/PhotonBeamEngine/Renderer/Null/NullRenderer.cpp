@@ -0,0 +1,357 @@
+#include "NullRenderer.hpp"
+
+#include <assert.h>
+#include <iostream>
+
+#include "Scene.hpp"
+#include "ISceneManager.hpp"
+#include "CameraComponent.hpp"
+#include "RenderableObject.hpp"
+#include "TextComponent.hpp"
+#include "VertexBuffer.hpp"
+#include "VertexBufferCache.hpp"
+#include "Profiler.hpp"
+
+using namespace Pht;
+
+namespace {
+    constexpr auto defaultScreenHeight = 1136;
+    constexpr auto topPadding = 1.05f;
+    constexpr auto bottomPadding = 1.67f;
+    const Mat4 identityMatrix;
+    const IVec2 defaultRenderBufferSize {640, 1136};
+    
+    struct FrustumSettings {
+        float mHeight;
+        float mZNearClip;
+        float mZFarClip;
+    };
+    
+    const static FrustumSettings perspectiveFrustumSettings {
+        .mHeight = 7.1f,
+        .mZNearClip = 5.0f,
+        .mZFarClip = 750.0f
+    };
+
+    const static FrustumSettings orthographicFrustumSettings {
+        .mHeight = 24.317f,
+        .mZNearClip = -1.0f,
+        .mZFarClip = 75.0f
+    };
+
+    const static FrustumSettings hudFrustumSettings {
+        .mHeight = 26.625f,
+        .mZNearClip = -1.0f,
+        .mZFarClip = 75.0f
+    };
+    
+    NullRenderer::FrameStats frameStats;
+}
+
+std::unique_ptr<IRendererInternal> Pht::CreateRenderer(bool createFrameBuffer) {
+    return std::make_unique<NullRenderer>(defaultRenderBufferSize);
+}
+
+NullRenderer::NullRenderer(const IVec2& renderBufferSize) :
+    mRenderBufferSize {renderBufferSize} {}
+
+void NullRenderer::Init(bool createFrameBuffer) {
+    std::cout << "Pht::NullRenderer: Using " << mRenderBufferSize.x << "x" << mRenderBufferSize.y
+              << " resolution." << std::endl;
+    
+    InitCamera(ISceneManager::defaultNarrowFrustumHeightFactor);
+}
+
+void NullRenderer::InitCamera(float narrowFrustumHeightFactor) {
+    mNarrowFrustumHeightFactor = narrowFrustumHeightFactor;
+    InitCamera();
+}
+
+void NullRenderer::InitCamera() {
+    mCamera = Camera {
+        mRenderBufferSize,
+        perspectiveFrustumSettings.mHeight * GetFrustumHeightFactor(),
+        perspectiveFrustumSettings.mZNearClip,
+        perspectiveFrustumSettings.mZFarClip
+    };
+    
+    mCamera.LookAt({0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -10.0f}, {0.0f, 1.0f, 0.0f});
+    
+    mOrthographicFrustumSize.y = orthographicFrustumSettings.mHeight * GetFrustumHeightFactor();
+    mOrthographicFrustumSize.x = mOrthographicFrustumSize.y * mRenderBufferSize.x / mRenderBufferSize.y;
+    mCamera.SetOrthographicProjection(mRenderBufferSize,
+                                      mOrthographicFrustumSize.y,
+                                      orthographicFrustumSettings.mZNearClip,
+                                      orthographicFrustumSettings.mZFarClip);
+    
+    auto hudFrustumHeight = hudFrustumSettings.mHeight * GetFrustumHeightFactor();
+    float hudFrustumWidth {hudFrustumHeight * mRenderBufferSize.x / mRenderBufferSize.y};
+    mHudFrustum.mProjection = Mat4::OrthographicProjection(-hudFrustumWidth / 2.0f,
+                                                           hudFrustumWidth / 2.0f,
+                                                           -hudFrustumHeight / 2.0f,
+                                                           hudFrustumHeight / 2.0f,
+                                                           hudFrustumSettings.mZNearClip,
+                                                           hudFrustumSettings.mZFarClip);
+    mHudFrustum.mSize = {hudFrustumWidth, hudFrustumHeight};
+}
+
+void NullRenderer::InitRenderQueue(const Scene& scene) {
+    mRenderQueue.Init(scene.GetRoot());
+}
+
+float NullRenderer::GetAspectRatio() const {
+    return static_cast<float>(mRenderBufferSize.y) / static_cast<float>(mRenderBufferSize.x);
+}
+
+float NullRenderer::GetFrustumHeightFactor() const {
+    if (GetAspectRatio() >= 2.0f) {
+        return mNarrowFrustumHeightFactor;
+    }
+    
+    return 1.0f;
+}
+
+int NullRenderer::GetAdjustedNumPixels(int numPixels) const {
+    return numPixels * mRenderBufferSize.y / (defaultScreenHeight * GetFrustumHeightFactor());
+}
+
+void NullRenderer::SetHudMode(bool hudMode) {
+    mHudMode = hudMode;
+}
+
+void NullRenderer::SetProjectionMode(ProjectionMode projectionMode) {
+    mProjectionMode = projectionMode;
+}
+
+const Mat4& NullRenderer::GetViewMatrix() const {
+    if (mHudMode) {
+        return identityMatrix;
+    }
+    
+    return mCamera.GetViewMatrix();
+}
+
+const Mat4& NullRenderer::GetProjectionMatrix() const {
+    if (mHudMode) {
+        return mHudFrustum.mProjection;
+    }
+    
+    switch (mProjectionMode) {
+        case ProjectionMode::Perspective:
+            return mCamera.GetProjectionMatrix();
+        case ProjectionMode::Orthographic:
+            return mCamera.GetOrthographicProjectionMatrix();
+    }
+}
+
+const Vec2& NullRenderer::GetHudFrustumSize() const {
+    return mHudFrustum.mSize;
+}
+
+const Vec2& NullRenderer::GetOrthographicFrustumSize() const {
+    return mOrthographicFrustumSize;
+}
+
+const IVec2& NullRenderer::GetRenderBufferSize() const {
+    return mRenderBufferSize;
+}
+
+float NullRenderer::GetTopPaddingHeight() const {
+    if (GetAspectRatio() >= 2.0f) {
+        return topPadding * mNarrowFrustumHeightFactor;
+    }
+    
+    return 0.0f;
+}
+
+float NullRenderer::GetBottomPaddingHeight() const {
+    if (GetAspectRatio() >= 2.0f) {
+        return bottomPadding * mNarrowFrustumHeightFactor;
+    }
+    
+    return 0.0f;
+}
+
+std::unique_ptr<RenderableObject>
+NullRenderer::CreateRenderableObject(const IMesh& mesh,
+                                     const Material& material,
+                                     VertexBufferLocation bufferLocation) {
+    VertexFlags vertexFlags;
+    switch (material.GetShaderId()) {
+        case ShaderId::Textured:
+            vertexFlags = {.mTextureCoords = true};
+            break;
+        case ShaderId::VertexColor:
+            vertexFlags = {.mColors = true};
+            break;
+        case ShaderId::Particle:
+        case ShaderId::ParticleTextureColor:
+        case ShaderId::ParticleNoAlphaTexture:
+            vertexFlags = {.mTextureCoords = true, .mColors = true};
+            break;
+        case ShaderId::PointParticle:
+            vertexFlags = {.mColors = true, .mPointSizes = true};
+            break;
+        case ShaderId::TexturedLightingVertexColor:
+            vertexFlags = {.mNormals = true, .mTextureCoords = true, .mColors = true};
+            break;
+        case ShaderId::TexturedLighting:
+        case ShaderId::TexturedPixelLighting:
+        case ShaderId::TexturedEmissiveLighting:
+        case ShaderId::TexturedEnvMapLighting:
+            vertexFlags = {.mNormals = true, .mTextureCoords = true};
+            break;
+        default:
+            vertexFlags = {.mNormals = true};
+            break;
+    }
+    
+    return std::make_unique<RenderableObject>(material, mesh, vertexFlags, bufferLocation);
+}
+
+void NullRenderer::RenderScene(const Scene& scene, float frameSeconds) {
+    PHT_PROFILE_ZONE("NullRenderer::RenderScene");
+    
+    const CameraComponent* previousCamera = nullptr;
+    
+    for (auto& renderPass: scene.GetRenderPasses()) {
+        if (!renderPass.IsEnabled()) {
+            continue;
+        }
+        
+        ++frameStats.mNumRenderPasses;
+        
+        // Starting a pass invalidates the cached render state, as in the GLES3 renderer.
+        mBoundState.mShaderId = ShaderId::Other;
+        mBoundState.mMaterial = nullptr;
+        mBoundState.mTexture = nullptr;
+        mBoundState.mVbo = nullptr;
+        
+        auto* cameraOverride = renderPass.GetCamera();
+        auto* camera = cameraOverride ? cameraOverride : scene.GetCamera();
+        assert(camera);
+        if (camera != previousCamera) {
+            if (!renderPass.IsHudMode()) {
+                mCamera.LookAt(camera->GetSceneObject().GetWorldSpacePosition(),
+                               camera->GetTarget(),
+                               camera->GetUp());
+            }
+            
+            previousCamera = camera;
+        }
+        
+        Render(renderPass, scene.GetDistanceFunction());
+    }
+}
+
+void NullRenderer::Render(const RenderPass& renderPass, DistanceFunction distanceFunction) {
+    SetHudMode(renderPass.IsHudMode());
+    SetProjectionMode(renderPass.GetProjectionMode());
+    
+    mRenderQueue.Build(GetViewMatrix(),
+                       renderPass.GetRenderOrder(),
+                       distanceFunction,
+                       renderPass.GetLayerMask());
+    
+    mDynamicBatcher.Plan(mRenderQueue);
+    mCommandBuffer.Build(mDynamicBatcher,
+                         renderPass.MustRenderDepthWritingObjectsFirst(),
+                         GetViewMatrix(),
+                         GetProjectionMatrix());
+    Submit(mCommandBuffer);
+}
+
+void NullRenderer::Submit(const RenderCommandBuffer& commandBuffer) {
+    for (auto& command: commandBuffer.GetCommands()) {
+        if (command.mDepthWrite != mBoundState.mDepthWrite) {
+            ++frameStats.mNumDepthWriteChanges;
+            mBoundState.mDepthWrite = command.mDepthWrite;
+        }
+        
+        switch (command.mKind) {
+            case RenderCommand::Kind::Object:
+                RecordDraw(command, command.mVbo);
+                break;
+            case RenderCommand::Kind::Batch: {
+                auto& batchVertexBuffer = mDynamicBatcher.WriteBatch(command.mBatch);
+                ReportUpload(batchVertexBuffer.GetVertexBufferSize() * sizeof(float) +
+                             batchVertexBuffer.GetIndexBufferSize() * sizeof(uint16_t));
+                frameStats.mNumTriangles += batchVertexBuffer.GetIndexBufferSize() / 3;
+                ++frameStats.mNumBatchDrawCalls;
+                RecordDraw(command, nullptr);
+                break;
+            }
+            case RenderCommand::Kind::Text:
+                UpdateTextLayout(*command.mTextComponent);
+                ++frameStats.mNumTexts;
+                if (command.mStartsTextBatch) {
+                    ++frameStats.mNumTextDraws;
+                }
+                break;
+        }
+    }
+}
+
+// Lays out the text the same way as the GLES3 renderer, so that the layout is done and cached
+// even when rendering headless.
+void NullRenderer::UpdateTextLayout(const TextComponent& textComponent) {
+    auto& properties = textComponent.GetProperties();
+    auto italicSlant =
+        mRenderBufferSize.x * properties.mItalicSlant * properties.mScale / mHudFrustum.mSize.x;
+    
+    textComponent.GetLayout().Update(textComponent.GetText(), properties, italicSlant);
+}
+
+void NullRenderer::RecordDraw(const RenderCommand& command, const GpuVertexBuffer* vbo) {
+    auto& material = *command.mMaterial;
+    
+    // The same conditions for setting the shader, material and vertex buffer as in the GLES3
+    // renderer.
+    auto isShaderSameAsLastDraw = material.GetShaderId() == mBoundState.mShaderId;
+    if (!isShaderSameAsLastDraw) {
+        ++frameStats.mNumShaderUses;
+        mBoundState.mShaderId = material.GetShaderId();
+    }
+    
+    if (!isShaderSameAsLastDraw || !mBoundState.mMaterial->Equals(material)) {
+        ++frameStats.mNumMaterialUses;
+        mBoundState.mMaterial = &material;
+    }
+    
+    if (material.GetTexture() && material.GetTexture() != mBoundState.mTexture) {
+        ++frameStats.mNumTextureBinds;
+        mBoundState.mTexture = material.GetTexture();
+    }
+    
+    // A batch is drawn from the shared batch buffer, which is bound again after every upload.
+    if (!isShaderSameAsLastDraw || vbo == nullptr || vbo != mBoundState.mVbo) {
+        ++frameStats.mNumVboUses;
+        mBoundState.mVbo = vbo;
+    }
+    
+    if (vbo) {
+        switch (command.mRenderMode) {
+            case RenderMode::Triangles:
+                frameStats.mNumTriangles += vbo->GetIndexCount() / 3;
+                break;
+            case RenderMode::Points:
+                frameStats.mNumPoints += vbo->GetPointCount();
+                break;
+        }
+    }
+    
+    ++frameStats.mNumDrawCalls;
+}
+
+void NullRenderer::ReportUpload(int numBytes) {
+    ++frameStats.mNumUploads;
+    frameStats.mNumUploadedBytes += numBytes;
+}
+
+void NullRenderer::ResetFrameStats() {
+    frameStats = FrameStats {};
+}
+
+const NullRenderer::FrameStats& NullRenderer::GetFrameStats() {
+    return frameStats;
+}
@@ -0,0 +1,107 @@
+#ifndef NullRenderer_hpp
+#define NullRenderer_hpp
+
+#include "IRendererInternal.hpp"
+#include "Camera.hpp"
+#include "RenderQueue.hpp"
+#include "DynamicBatcher.hpp"
+#include "RenderCommandBuffer.hpp"
+
+namespace Pht {
+    class VertexBuffer;
+    class Texture;
+    class TextComponent;
+    
+    // A renderer that builds the render queue, the dynamic batches and the command buffer of every
+    // render pass like the GLES3 renderer does, but records the draw calls, state changes and
+    // uploads of the commands instead of issuing them. It lets the CPU side of a frame run and be
+    // measured without a graphics context.
+    class NullRenderer: public IRendererInternal {
+    public:
+        struct FrameStats {
+            int mNumRenderPasses {0};
+            int mNumDrawCalls {0};
+            int mNumBatchDrawCalls {0};
+            int mNumTexts {0};
+            int mNumTextDraws {0};
+            int mNumShaderUses {0};
+            int mNumMaterialUses {0};
+            int mNumTextureBinds {0};
+            int mNumVboUses {0};
+            int mNumDepthWriteChanges {0};
+            int mNumTriangles {0};
+            int mNumPoints {0};
+            int mNumUploads {0};
+            int mNumUploadedBytes {0};
+        };
+        
+        explicit NullRenderer(const IVec2& renderBufferSize);
+        
+        // Methods implementing IRenderer:
+        void EnableShader(ShaderId shaderId) override {}
+        void DisableShader(ShaderId shaderId) override {}
+        void SetClearColorBuffer(bool clearColorBuffer) override {}
+        void SetHudMode(bool hudMode) override;
+        void SetProjectionMode(ProjectionMode projectionMode) override;
+        int GetAdjustedNumPixels(int numPixels) const override;
+        const Mat4& GetViewMatrix() const override;
+        const Mat4& GetProjectionMatrix() const override;
+        const Vec2& GetHudFrustumSize() const override;
+        const Vec2& GetOrthographicFrustumSize() const override;
+        float GetFrustumHeightFactor() const override;
+        const IVec2& GetRenderBufferSize() const override;
+        float GetTopPaddingHeight() const override;
+        float GetBottomPaddingHeight() const override;
+
+        // Methods implementing IRendererInternal:
+        void Init(bool createFrameBuffer) override;
+        void InitCamera(float narrowFrustumHeightFactor) override;
+        void InitRenderQueue(const Scene& scene) override;
+        std::unique_ptr<RenderableObject> CreateRenderableObject(const IMesh& mesh,
+                                                                 const Material& material,
+                                                                 VertexBufferLocation bufferLocation) override;
+        void ClearFrameBuffer() override {}
+        void RenderScene(const Scene& scene, float frameSeconds) override;
+        
+        // The uploads are reported by the GPU vertex buffers, which also upload outside of
+        // RenderScene, so the stats cover everything since the last reset.
+        static void ReportUpload(int numBytes);
+        static void ResetFrameStats();
+        static const FrameStats& GetFrameStats();
+        
+    private:
+        void InitCamera();
+        float GetAspectRatio() const;
+        void Render(const RenderPass& renderPass, DistanceFunction distanceFunction);
+        void Submit(const RenderCommandBuffer& commandBuffer);
+        void UpdateTextLayout(const TextComponent& textComponent);
+        void RecordDraw(const RenderCommand& command, const GpuVertexBuffer* vbo);
+        
+        struct HudFrustum {
+            Mat4 mProjection;
+            Vec2 mSize;
+        };
+        
+        struct BoundState {
+            ShaderId mShaderId {ShaderId::Other};
+            const Material* mMaterial {nullptr};
+            const Texture* mTexture {nullptr};
+            const GpuVertexBuffer* mVbo {nullptr};
+            bool mDepthWrite {true};
+        };
+        
+        ProjectionMode mProjectionMode {ProjectionMode::Perspective};
+        Camera mCamera;
+        HudFrustum mHudFrustum;
+        Vec2 mOrthographicFrustumSize;
+        float mNarrowFrustumHeightFactor {1.0f};
+        IVec2 mRenderBufferSize;
+        RenderQueue mRenderQueue;
+        DynamicBatcher mDynamicBatcher;
+        RenderCommandBuffer mCommandBuffer;
+        BoundState mBoundState;
+        bool mHudMode {false};
+    };
+}
+
+#endif
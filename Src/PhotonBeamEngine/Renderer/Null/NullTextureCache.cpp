@@ -0,0 +1,122 @@
+#include "TextureCache.hpp"
+
+#include <vector>
+#include <mutex>
+#include <algorithm>
+
+#include "TextureAtlas.hpp"
+#include "NullHandles.hpp"
+
+using namespace Pht;
+
+// The null renderer does not load or upload any images, so the textures only have an identity that
+// the materials can be compared by. Textures with the same name are shared as in the GLES3 texture
+// cache. The atlases of the fonts are kept since the text layouts read the glyph UVs from them.
+// Atlases of sub images get one sub texture per image that covers the whole texture, so that the
+// objects that pick sub textures by index are still created.
+namespace {
+    static std::mutex mutex;
+    static std::vector<std::pair<std::string, std::weak_ptr<Texture>>> textures;
+    
+    std::shared_ptr<Texture> GetOrCreateTexture(const std::string& name,
+                                                std::unique_ptr<TextureAtlas> atlas = nullptr) {
+        std::lock_guard<std::mutex> guard {mutex};
+        
+        textures.erase(
+            std::remove_if(
+                std::begin(textures),
+                std::end(textures),
+                [] (const auto& entry) {
+                    return entry.second.lock() == std::shared_ptr<Texture>();
+                }),
+            std::end(textures));
+        
+        for (const auto& entry: textures) {
+            if (auto texture = entry.second.lock()) {
+                if (entry.first == name) {
+                    return texture;
+                }
+            }
+        }
+        
+        auto texture = std::make_shared<Texture>(false, std::move(atlas));
+        textures.emplace_back(name, texture);
+        return texture;
+    }
+    
+    std::unique_ptr<TextureAtlas> CreateWholeTextureAtlas(int numSubTextures) {
+        SubTextureUV wholeTextureUV {
+            .mBottomLeft = {0.0f, 0.0f},
+            .mBottomRight = {1.0f, 0.0f},
+            .mTopRight = {1.0f, 1.0f},
+            .mTopLeft = {0.0f, 1.0f}
+        };
+        
+        std::vector<SubTextureUV> subTextureUVs(numSubTextures, wholeTextureUV);
+        return std::make_unique<TextureAtlas>(subTextureUVs);
+    }
+}
+
+bool EnvMapTextureFilenames::operator==(const EnvMapTextureFilenames& other) const {
+    return mPositiveX == other.mPositiveX && mNegativeX == other.mNegativeX &&
+           mPositiveY == other.mPositiveY && mNegativeY == other.mNegativeY &&
+           mPositiveZ == other.mPositiveZ && mNegativeZ == other.mNegativeZ;
+}
+
+Texture::Texture(bool hasPremultipliedAlpha, std::unique_ptr<TextureAtlas> atlas) :
+    mHandles {std::make_unique<TextureHandles>()},
+    mAtlas {std::move(atlas)},
+    mHasPremultipliedAlpha {hasPremultipliedAlpha} {}
+
+Texture::~Texture() {}
+
+std::shared_ptr<Texture> TextureCache::GetTexture(const std::string& textureName,
+                                                  GenerateMipmap generateMipmap) {
+    if (textureName.empty()) {
+        return nullptr;
+    }
+    
+    return GetOrCreateTexture(textureName);
+}
+
+std::shared_ptr<Texture> TextureCache::GetTexture(const EnvMapTextureFilenames& filenames) {
+    return GetOrCreateTexture(filenames.mPositiveX + filenames.mNegativeX +
+                              filenames.mPositiveY + filenames.mNegativeY +
+                              filenames.mPositiveZ + filenames.mNegativeZ);
+}
+
+std::shared_ptr<Texture> TextureCache::GetTexture(const IImage& image,
+                                                  GenerateMipmap generateMipmap,
+                                                  const Optional<std::string>& name) {
+    if (!name.HasValue()) {
+        return std::make_shared<Texture>(false, nullptr);
+    }
+    
+    return GetOrCreateTexture(name.GetValue());
+}
+
+std::shared_ptr<Texture>
+TextureCache::GetTextureAtlas(const std::vector<std::string>& filenames,
+                              const TextureAtlasConfig& textureAtlasConfig) {
+    std::string name;
+    for (auto& filename: filenames) {
+        name += filename;
+    }
+    
+    return GetOrCreateTexture(name, CreateWholeTextureAtlas(static_cast<int>(filenames.size())));
+}
+
+std::shared_ptr<Texture>
+TextureCache::GetTextureAtlas(const std::string& name,
+                              const std::vector<std::unique_ptr<const IImage>>& images,
+                              const TextureAtlasConfig& textureAtlasConfig) {
+    return GetOrCreateTexture(name, CreateWholeTextureAtlas(static_cast<int>(images.size())));
+}
+
+std::shared_ptr<Texture>
+TextureCache::GetTextureAtlas(const std::string& name,
+                              const IImage& atlasImage,
+                              std::unique_ptr<TextureAtlas> textureAtlas,
+                              const TextureAtlasConfig& textureAtlasConfig) {
+    return GetOrCreateTexture(name, std::move(textureAtlas));
+}
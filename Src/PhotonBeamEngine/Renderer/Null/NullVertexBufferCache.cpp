@@ -0,0 +1,64 @@
+#include "VertexBufferCache.hpp"
+
+#include <mutex>
+#include <vector>
+#include <algorithm>
+
+#include "NullHandles.hpp"
+#include "NullRenderer.hpp"
+
+using namespace Pht;
+
+namespace {
+    static std::mutex mutex;
+    static std::vector<std::pair<std::string, std::weak_ptr<GpuVertexBuffer>>> cache;
+}
+
+uint32_t GpuVertexBuffer::mIdCounter = 0;
+
+GpuVertexBuffer::GpuVertexBuffer(GenerateIndexBuffer generateIndexBuffer) :
+    mHandles {std::make_unique<GpuVertexBufferHandles>()} {}
+
+GpuVertexBuffer::~GpuVertexBuffer() {}
+
+void GpuVertexBuffer::UploadTriangles(const VertexBuffer& vertexBuffer, BufferUsage bufferUsage) {
+    NullRenderer::ReportUpload(vertexBuffer.GetVertexBufferSize() * sizeof(float) +
+                               vertexBuffer.GetIndexBufferSize() * sizeof(uint16_t));
+    
+    mIndexCount = vertexBuffer.GetIndexBufferSize();
+}
+
+void GpuVertexBuffer::UploadPoints(const VertexBuffer& vertexBuffer, BufferUsage bufferUsage) {
+    NullRenderer::ReportUpload(vertexBuffer.GetVertexBufferSize() * sizeof(float));
+    
+    mPointCount = vertexBuffer.GetNumVertices();
+}
+
+std::shared_ptr<GpuVertexBuffer> VertexBufferCache::Get(const std::string& meshName) {
+    std::lock_guard<std::mutex> guard {mutex};
+    
+    cache.erase(
+        std::remove_if(
+            std::begin(cache),
+            std::end(cache),
+            [] (const auto& entry) {
+                return entry.second.lock() == std::shared_ptr<GpuVertexBuffer>();
+            }),
+        std::end(cache));
+
+    for (const auto& entry: cache) {
+        if (auto buffer = entry.second.lock()) {
+            if (meshName == entry.first) {
+                return buffer;
+            }
+        }
+    }
+    
+    return nullptr;
+}
+
+void VertexBufferCache::Add(const std::string& meshName, std::shared_ptr<GpuVertexBuffer> buffer) {
+    std::lock_guard<std::mutex> guard {mutex};
+    
+    cache.emplace_back(meshName, buffer);
+}
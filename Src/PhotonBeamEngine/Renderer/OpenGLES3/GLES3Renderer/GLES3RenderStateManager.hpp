@@ -44,6 +44,10 @@ namespace Pht {
             IF_USING_FRAME_STATS(ReportVboUse());
         }
 
+        void InvalidateVbo() {
+            mVbo = nullptr;
+        }
+
         bool IsShaderInUse(const GLES3ShaderProgram& shaderProgram) const {
             return &shaderProgram == mShaderProgram;
         }
@@ -23,11 +23,14 @@
 #include "Camera.hpp"
 #include "Material.hpp"
 #include "RenderQueue.hpp"
+#include "DynamicBatcher.hpp"
+#include "RenderCommandBuffer.hpp"
 #include "VertexBufferCache.hpp"
 #include "GLES3Handles.hpp"
 #include "GLES3ShaderProgram.hpp"
 #include "GLES3TextRenderer.hpp"
 #include "GLES3RenderStateManager.hpp"
+#include "Profiler.hpp"
 
 #define STRINGIFY(A)  #A
 #include "../GLES3Shaders/PixelLighting.vert"
@@ -103,8 +106,11 @@ namespace {
         void SetLightDirection(const Vec3& lightDirection);
         void CalculateCameraSpaceLightDirection();
         const Vec3& GetCameraPosition() const;
-        void RenderObject(const RenderableObject& renderableObject, const Mat4& modelTransform);
-        void SetTransforms(const Mat4& modelTransform, GLES3ShaderProgram& shaderProgram);
+        void Submit(const RenderCommandBuffer& commandBuffer);
+        void RenderObject(const RenderCommand& command, const GpuVertexBuffer& vbo);
+        void RenderBatch(const RenderCommand& command);
+        void RenderText(const RenderCommand& command);
+        void SetTransforms(const RenderCommand& command, GLES3ShaderProgram& shaderProgram);
         void SetMaterialProperties(const Material& material,
                                    ShaderId shaderId,
                                    const GLES3ShaderProgram& shaderProgram);
@@ -112,15 +118,15 @@ namespace {
                           ShaderId shaderId,
                           const GLES3ShaderProgram& shaderProgram);
         void SetupBlend(const Material& material, ShaderId shaderId);
-        void SetVbo(const RenderableObject& renderableObject,
+        void SetVbo(const GpuVertexBuffer& vbo,
+                    RenderMode renderMode,
                     const GLES3ShaderProgram& shaderProgram);
         void CreateShader(ShaderId shaderId, const VertexFlags& vertexFlags);
         GLES3ShaderProgram& GetShader(ShaderId shaderId);
-        void RenderText(const std::string& text,
+        void RenderText(const TextComponent& textComponent,
                         const Vec2& position,
-                        RenderQueue::TextKind textKind,
-                        const TextProperties& properties);
-        void RenderTextImpl(const std::string& text,
+                        RenderQueue::TextKind textKind);
+        void RenderTextImpl(const TextComponent& textComponent,
                             const Vec2& position,
                             RenderQueue::TextKind textKind,
                             const GLES3TextRenderer::ColorProperties& colorProperties,
@@ -150,6 +156,9 @@ namespace {
         float mNarrowFrustumHeightFactor {1.0f};
         IVec2 mRenderBufferSize;
         RenderQueue mRenderQueue;
+        DynamicBatcher mDynamicBatcher;
+        RenderCommandBuffer mCommandBuffer;
+        std::unique_ptr<GpuVertexBuffer> mBatchGpuVertexBuffer;
         GLES3RenderStateManager mRenderState;
         std::unordered_map<ShaderId, std::unique_ptr<GLES3ShaderProgram>> mShaders;
         std::unique_ptr<GLES3TextRenderer> mTextRenderer;
@@ -318,6 +327,7 @@ void GLES3Renderer::Init(bool createFrameBuffer) {
     
     InitOpenGL(createFrameBuffer);
     InitShaders();
+    mBatchGpuVertexBuffer = std::make_unique<GpuVertexBuffer>(GenerateIndexBuffer::Yes);
     InitCamera(ISceneManager::defaultNarrowFrustumHeightFactor);
 
     mRenderState.Init();
@@ -611,6 +621,8 @@ void GLES3Renderer::ClearFrameBuffer() {
 }
 
 void GLES3Renderer::RenderScene(const Scene& scene, float frameSeconds) {
+    PHT_PROFILE_ZONE("GLES3Renderer::RenderScene");
+    
     const CameraComponent* previousCamera = nullptr;
     const LightComponent* previousLight = nullptr;
     
@@ -687,45 +699,51 @@ void GLES3Renderer::Render(const RenderPass& renderPass, DistanceFunction distan
         mRenderState.SetDepthWrite(true);
     }
     
-    RenderQueue::Entry* previousEntry {nullptr};
-
-    for (mRenderQueue.BeginIteration(); mRenderQueue.HasMoreEntries();) {
-        auto& renderEntry = mRenderQueue.GetNextEntry();
+    mDynamicBatcher.Plan(mRenderQueue);
+    mCommandBuffer.Build(mDynamicBatcher,
+                         renderPass.MustRenderDepthWritingObjectsFirst(),
+                         GetViewMatrix(),
+                         GetProjectionMatrix());
+    Submit(mCommandBuffer);
+}
 
-        if (renderPass.MustRenderDepthWritingObjectsFirst()) {
-            if (!renderEntry.IsDepthWriting()) {
-                if (previousEntry == nullptr || previousEntry->IsDepthWriting()) {
-                    // Transition into rendering the transparent objects (non-depth writing).
-                    mRenderState.SetDepthWrite(false);
-                }
-            }
-        } else {
-            mRenderState.SetDepthWrite(renderEntry.IsDepthWriting());
+void GLES3Renderer::Submit(const RenderCommandBuffer& commandBuffer) {
+    for (auto& command: commandBuffer.GetCommands()) {
+        // The batched texts have to be drawn before anything that follows them.
+        if (command.mKind != RenderCommand::Kind::Text || command.mStartsTextBatch) {
+            mTextRenderer->Flush();
         }
         
-        auto* sceneObject = renderEntry.mSceneObject;
-        if (auto* renderable = sceneObject->GetRenderable()) {
-            RenderObject(*renderable, sceneObject->GetMatrix());
-        }
+        mRenderState.SetDepthWrite(command.mDepthWrite);
         
-        auto textKind = renderEntry.GetTextKind();
-        if (textKind != RenderQueue::TextKind::None) {
-            if (auto* textComponent = sceneObject->GetComponent<TextComponent>()) {
-                auto textPosition = CalculateTextHudPosition(*textComponent);
-                RenderText(textComponent->GetText(),
-                           textPosition,
-                           textKind,
-                           textComponent->GetProperties());
-            }
+        switch (command.mKind) {
+            case RenderCommand::Kind::Object:
+                RenderObject(command, *command.mVbo);
+                break;
+            case RenderCommand::Kind::Batch:
+                RenderBatch(command);
+                break;
+            case RenderCommand::Kind::Text:
+                RenderText(command);
+                break;
         }
-        
-        previousEntry = &renderEntry;
     }
+    
+    mTextRenderer->Flush();
+}
+
+void GLES3Renderer::RenderBatch(const RenderCommand& command) {
+    auto& batchVertexBuffer = mDynamicBatcher.WriteBatch(command.mBatch);
+    mBatchGpuVertexBuffer->UploadTriangles(batchVertexBuffer, BufferUsage::DynamicDraw);
+    
+    // The upload binds the batch buffers, so the vertex buffer in use has to be bound again.
+    mRenderState.InvalidateVbo();
+    
+    RenderObject(command, *mBatchGpuVertexBuffer);
 }
 
-void GLES3Renderer::RenderObject(const RenderableObject& renderableObject,
-                                 const Mat4& modelTransform) {
-    auto& material = renderableObject.GetMaterial();
+void GLES3Renderer::RenderObject(const RenderCommand& command, const GpuVertexBuffer& vbo) {
+    auto& material = *command.mMaterial;
     auto shaderId = material.GetShaderId();
     auto& shaderProgram = GetShader(shaderId);
     
@@ -734,20 +752,20 @@ void GLES3Renderer::RenderObject(const RenderableObject& renderableObject,
         mRenderState.UseShader(shaderProgram);
     }
     
-    SetTransforms(modelTransform, shaderProgram);
+    SetTransforms(command, shaderProgram);
     
     if (!isShaderSameAsLastDraw || !mRenderState.IsMaterialInUse(material)) {
         mRenderState.UseMaterial(material);
         SetMaterialProperties(material, shaderId, shaderProgram);
     }
     
-    auto& vbo = renderableObject.GetGpuVertexBuffer();
+    auto renderMode = command.mRenderMode;
     if (!isShaderSameAsLastDraw || !mRenderState.IsVboInUse(vbo)) {
         mRenderState.UseVbo(vbo);
-        SetVbo(renderableObject, shaderProgram);
+        SetVbo(vbo, renderMode, shaderProgram);
     }
 
-    switch (renderableObject.GetRenderMode()) {
+    switch (renderMode) {
         case RenderMode::Triangles:
             glDrawElements(GL_TRIANGLES, vbo.GetIndexCount(), GL_UNSIGNED_SHORT, 0);
             break;
@@ -759,22 +777,18 @@ void GLES3Renderer::RenderObject(const RenderableObject& renderableObject,
     IF_USING_FRAME_STATS(mRenderState.ReportDrawCall());
 }
 
-void GLES3Renderer::SetTransforms(const Mat4& modelTransform, GLES3ShaderProgram& shaderProgram) {
+void GLES3Renderer::SetTransforms(const RenderCommand& command,
+                                  GLES3ShaderProgram& shaderProgram) {
     // Note: the matrix in the matrix lib is row-major while OpenGL expects column-major. However,
     // it works since all transforms are created in row-major order while OpenGL reads the matrix in
     // column-major order which transposes it. Transposing the matrix is required in order to
     // multiply with a vector: M * v.
-    auto modelview = modelTransform * GetViewMatrix();
-    auto modelViewProjection = modelview * GetProjectionMatrix();
     auto& uniforms = shaderProgram.GetUniforms();
-    glUniformMatrix4fv(uniforms.mModelViewProjection, 1, 0, modelViewProjection.Pointer());
-
-    // Set the normal matrix in camera space. Modelview is orthogonal, so its Inverse-Transpose is
-    // itself.
-    auto normalMatrix = modelview.ToMat3();
-    glUniformMatrix3fv(uniforms.mNormalMatrix, 1, 0, normalMatrix.Pointer());
+    glUniformMatrix4fv(uniforms.mModelViewProjection, 1, 0, command.mModelViewProjection.Pointer());
+    glUniformMatrix3fv(uniforms.mNormalMatrix, 1, 0, command.mNormalMatrix.Pointer());
     
     // Set the model matrix.
+    auto& modelTransform = command.mModel;
     glUniformMatrix4fv(uniforms.mModel, 1, 0, modelTransform.Pointer());
     glUniformMatrix3fv(uniforms.mModel3x3, 1, 0, modelTransform.ToMat3().Pointer());
     
@@ -879,25 +893,30 @@ void GLES3Renderer::SetupBlend(const Material& material, ShaderId shaderId) {
     }
 }
 
-void GLES3Renderer::SetVbo(const RenderableObject& renderableObject,
+void GLES3Renderer::SetVbo(const GpuVertexBuffer& vbo,
+                           RenderMode renderMode,
                            const GLES3ShaderProgram& shaderProgram) {
-    auto& vbo = renderableObject.GetGpuVertexBuffer();
-    
     // Bind the vertex buffer.
     glBindBuffer(GL_ARRAY_BUFFER, vbo.GetHandles()->mGLVertexBufferHandle);
     
     // Enable vertex attribute arrays.
     EnableVertexAttributes(shaderProgram);
     
-    if (renderableObject.GetRenderMode() == RenderMode::Triangles) {
+    if (renderMode == RenderMode::Triangles) {
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vbo.GetHandles()->mGLIndexBufferHandle);
     }
 }
 
-void GLES3Renderer::RenderText(const std::string& text,
+void GLES3Renderer::RenderText(const RenderCommand& command) {
+    auto& textComponent = *command.mTextComponent;
+    auto textPosition = CalculateTextHudPosition(textComponent);
+    RenderText(textComponent, textPosition, command.mTextKind);
+}
+
+void GLES3Renderer::RenderText(const TextComponent& textComponent,
                                const Vec2& position,
-                               RenderQueue::TextKind textKind,
-                               const TextProperties& properties) {
+                               RenderQueue::TextKind textKind) {
+    auto& properties = textComponent.GetProperties();
     auto textPosition = properties.mShadow == TextShadow::Yes ?
                         position + properties.mShadowOffset * properties.mScale :
                         position;
@@ -909,7 +928,7 @@ void GLES3Renderer::RenderText(const std::string& text,
                 .mTopGradientColorSubtraction = properties.mTopGradientColorSubtraction,
                 .mMidGradientColorSubtraction = properties.mMidGradientColorSubtraction
             };
-            RenderTextImpl(text, textPosition, textKind, colorProperties, properties);
+            RenderTextImpl(textComponent, textPosition, textKind, colorProperties, properties);
             break;
         }
         case RenderQueue::TextKind::TopGradientShader: {
@@ -917,7 +936,7 @@ void GLES3Renderer::RenderText(const std::string& text,
                 .mColor = properties.mColor,
                 .mTopGradientColorSubtraction = properties.mTopGradientColorSubtraction
             };
-            RenderTextImpl(text, textPosition, textKind, colorProperties, properties);
+            RenderTextImpl(textComponent, textPosition, textKind, colorProperties, properties);
             break;
         }
         case RenderQueue::TextKind::MidGradientShader: {
@@ -925,21 +944,21 @@ void GLES3Renderer::RenderText(const std::string& text,
                 .mColor = properties.mColor,
                 .mMidGradientColorSubtraction = properties.mMidGradientColorSubtraction
             };
-            RenderTextImpl(text, textPosition, textKind, colorProperties, properties);
+            RenderTextImpl(textComponent, textPosition, textKind, colorProperties, properties);
             break;
         }
         case RenderQueue::TextKind::PlainShader: {
             GLES3TextRenderer::ColorProperties colorProperties {
                 .mColor = properties.mColor
             };
-            RenderTextImpl(text, textPosition, textKind, colorProperties, properties);
+            RenderTextImpl(textComponent, textPosition, textKind, colorProperties, properties);
             break;
         }
         case RenderQueue::TextKind::Specular: {
             GLES3TextRenderer::ColorProperties colorProperties {
                 .mColor = properties.mSpecularColor
             };
-            RenderTextImpl(text,
+            RenderTextImpl(textComponent,
                            textPosition + properties.mSpecularOffset * properties.mScale,
                            textKind,
                            colorProperties,
@@ -950,14 +969,14 @@ void GLES3Renderer::RenderText(const std::string& text,
             GLES3TextRenderer::ColorProperties colorProperties {
                 .mColor = properties.mShadowColor
             };
-            RenderTextImpl(text, position, textKind, colorProperties, properties);
+            RenderTextImpl(textComponent, position, textKind, colorProperties, properties);
             break;
         }
         case RenderQueue::TextKind::SecondShadow: {
             GLES3TextRenderer::ColorProperties colorProperties {
                 .mColor = properties.mSecondShadowColor
             };
-            RenderTextImpl(text,
+            RenderTextImpl(textComponent,
                            position - properties.mSecondShadowOffset * properties.mScale,
                            textKind,
                            colorProperties,
@@ -970,7 +989,7 @@ void GLES3Renderer::RenderText(const std::string& text,
     }
 }
 
-void GLES3Renderer::RenderTextImpl(const std::string& text,
+void GLES3Renderer::RenderTextImpl(const TextComponent& textComponent,
                                    const Vec2& position,
                                    RenderQueue::TextKind textKind,
                                    const GLES3TextRenderer::ColorProperties& colorProperties,
@@ -991,12 +1010,9 @@ void GLES3Renderer::RenderTextImpl(const std::string& text,
     auto italicSlant =
         mRenderBufferSize.x * properties.mItalicSlant * properties.mScale / mHudFrustum.mSize.x;
     
-    mTextRenderer->RenderText(text,
-                              pixelPosition,
-                              italicSlant,
-                              textKind,
-                              colorProperties,
-                              properties);
+    auto& layout = textComponent.GetLayout();
+    layout.Update(textComponent.GetText(), properties, italicSlant);
+    mTextRenderer->AddText(layout, pixelPosition, textKind, colorProperties, properties);
 }
                         
 Vec2 GLES3Renderer::CalculateTextHudPosition(const TextComponent& textComponent) {
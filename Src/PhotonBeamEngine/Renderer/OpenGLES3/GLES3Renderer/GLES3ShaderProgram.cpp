@@ -58,6 +58,8 @@ void GLES3ShaderProgram::Build(const char* vertexShaderSource, const char* fragm
     mAttributes.mColor = glGetAttribLocation(mProgram, "Color");
     mAttributes.mTextCoords = glGetAttribLocation(mProgram, "TextCoords");
     mAttributes.mTextGradientFunction = glGetAttribLocation(mProgram, "TextGradientFunction");
+    mAttributes.mTextColor = glGetAttribLocation(mProgram, "TextColor");
+    mAttributes.mTextSmoothing = glGetAttribLocation(mProgram, "TextSmoothing");
     mAttributes.mPointSize = glGetAttribLocation(mProgram, "PointSize");
     
     // Extract the handles to uniforms.
@@ -72,7 +74,6 @@ void GLES3ShaderProgram::Build(const char* vertexShaderSource, const char* fragm
     mUniforms.mShininess = glGetUniformLocation(mProgram, "Shininess");
     mUniforms.mReflectivity = glGetUniformLocation(mProgram, "Reflectivity");
     mUniforms.mOpacity = glGetUniformLocation(mProgram, "Opacity");
-    mUniforms.mTextColor = glGetUniformLocation(mProgram, "TextColor");
     mUniforms.mTextTopColorSubtraction = glGetUniformLocation(mProgram, "TextTopColorSubtraction");
     mUniforms.mTextMidColorSubtraction = glGetUniformLocation(mProgram, "TextMidColorSubtraction");
     mUniforms.mSampler = glGetUniformLocation(mProgram, "Sampler");
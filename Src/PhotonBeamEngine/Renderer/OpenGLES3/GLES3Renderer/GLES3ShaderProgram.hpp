@@ -25,7 +25,6 @@ namespace Pht {
             GLint mShininess {0};
             GLint mReflectivity {0};
             GLint mOpacity {0};
-            GLint mTextColor {0};
             GLint mTextTopColorSubtraction {0};
             GLint mTextMidColorSubtraction {0};
             GLint mSampler {0};
@@ -42,6 +41,8 @@ namespace Pht {
             GLint mColor {0};
             GLint mTextCoords {0};
             GLint mTextGradientFunction {0};
+            GLint mTextColor {0};
+            GLint mTextSmoothing {0};
             GLint mPointSize {0};
         };
         
@@ -1,7 +1,10 @@
 #include "GLES3TextRenderer.hpp"
 
+#include <algorithm>
+
 #include "Font.hpp"
-#include "TextureAtlas.hpp"
+#include "TextLayout.hpp"
+#include "TextureCache.hpp"
 #include "GLES3RenderStateManager.hpp"
 #include "GLES3Handles.hpp"
 
@@ -14,6 +17,10 @@
 #include "../GLES3Shaders/TextTopGradient.frag"
 #include "../GLES3Shaders/TextMidGradient.vert"
 #include "../GLES3Shaders/TextMidGradient.frag"
+#include "../GLES3Shaders/TextDistanceField.frag"
+#include "../GLES3Shaders/TextDistanceFieldDoubleGradient.frag"
+#include "../GLES3Shaders/TextDistanceFieldTopGradient.frag"
+#include "../GLES3Shaders/TextDistanceFieldMidGradient.frag"
 
 using namespace Pht;
 
@@ -27,6 +34,21 @@ namespace {
         glDisableVertexAttribArray(attributes.mColor);
         glDisableVertexAttribArray(attributes.mPointSize);
     }
+    
+    // The attributes that a shader does not use have no location.
+    void EnableVertexAttribute(GLint attribute, int size, int offset, int numFloatsPerVertex) {
+        if (attribute < 0) {
+            return;
+        }
+        
+        glEnableVertexAttribArray(attribute);
+        glVertexAttribPointer(attribute,
+                              size,
+                              GL_FLOAT,
+                              GL_FALSE,
+                              numFloatsPerVertex * sizeof(GLfloat),
+                              reinterpret_cast<const GLvoid*>(offset * sizeof(GLfloat)));
+    }
 }
 
 GLES3TextRenderer::GLES3TextRenderer(GLES3RenderStateManager& renderState,
@@ -36,7 +58,11 @@ GLES3TextRenderer::GLES3TextRenderer(GLES3RenderStateManager& renderState,
     mTextShader {{}},
     mTextDoubleGradientShader {{}},
     mTextTopGradientShader {{}},
-    mTextMidGradientShader {{}} {
+    mTextMidGradientShader {{}},
+    mTextDistanceFieldShader {{}},
+    mTextDistanceFieldDoubleGradientShader {{}},
+    mTextDistanceFieldTopGradientShader {{}},
+    mTextDistanceFieldMidGradientShader {{}} {
     
     glGenBuffers(1, &mVbo);
     glBindBuffer(GL_ARRAY_BUFFER, mVbo);
@@ -49,6 +75,16 @@ GLES3TextRenderer::GLES3TextRenderer(GLES3RenderStateManager& renderState,
     BuildShader(mTextDoubleGradientShader, TextDoubleGradientVertexShader, TextDoubleGradientFragmentShader);
     BuildShader(mTextTopGradientShader, TextTopGradientVertexShader, TextTopGradientFragmentShader);
     BuildShader(mTextMidGradientShader, TextMidGradientVertexShader, TextMidGradientFragmentShader);
+    BuildShader(mTextDistanceFieldShader, TextVertexShader, TextDistanceFieldFragmentShader);
+    BuildShader(mTextDistanceFieldDoubleGradientShader,
+                TextDoubleGradientVertexShader,
+                TextDistanceFieldDoubleGradientFragmentShader);
+    BuildShader(mTextDistanceFieldTopGradientShader,
+                TextTopGradientVertexShader,
+                TextDistanceFieldTopGradientFragmentShader);
+    BuildShader(mTextDistanceFieldMidGradientShader,
+                TextMidGradientVertexShader,
+                TextDistanceFieldMidGradientFragmentShader);
 }
 
 GLES3TextRenderer::~GLES3TextRenderer() {
@@ -63,13 +99,65 @@ void GLES3TextRenderer::BuildShader(GLES3ShaderProgram& shader,
     shader.SetProjection(mProjection);
 }
 
-void GLES3TextRenderer::RenderText(const std::string& text,
-                                   Vec2 position,
-                                   float slant,
-                                   RenderQueue::TextKind textKind,
-                                   const ColorProperties& colorProperties,
-                                   const TextProperties& properties) {
-    auto& shaderProgram = GetShaderProgram(textKind);
+void GLES3TextRenderer::AddText(const TextLayout& layout,
+                                const Vec2& position,
+                                RenderQueue::TextKind textKind,
+                                const ColorProperties& colorProperties,
+                                const TextProperties& properties) {
+    auto& font = properties.mFont;
+    auto* texture = font.GetTexture();
+    if (texture == nullptr) {
+        assert(texture);
+        return;
+    }
+    
+    auto& glyphQuads = layout.GetGlyphQuads();
+    auto numCharacters = std::min(static_cast<int>(glyphQuads.size()), maxNumCharacters);
+    if (mNumVertices + numCharacters * numVerticesPerCharacter > maxNumVertices) {
+        Flush();
+    }
+    
+    if (mNumVertices == 0) {
+        mBatchShaderProgram = &GetShaderProgram(textKind, font);
+        mBatchTexture = texture;
+        mBatchColorProperties = colorProperties;
+    }
+    
+    auto smoothing = 0.0f;
+    if (font.IsDistanceField()) {
+        // Smooths the outline over one pixel at the scale of the text.
+        auto pixelsPerSpread =
+            font.GetDistanceFieldSpread() * properties.mScale * font.GetGlyphScale();
+        smoothing = 0.25f / pixelsPerSpread;
+    }
+    
+    auto& color = colorProperties.mColor;
+    auto slant = layout.GetSlant();
+    
+    for (auto i = 0; i < numCharacters; ++i) {
+        auto& glyphQuad = glyphQuads[i];
+        auto& uv = glyphQuad.mUV;
+        GLfloat xPos {position.x + glyphQuad.mBottomLeft.x};
+        GLfloat yPos {position.y + glyphQuad.mBottomLeft.y};
+        GLfloat w {glyphQuad.mSize.x};
+        GLfloat h {glyphQuad.mSize.y};
+        
+        WriteVertex({xPos + slant,     yPos + h}, uv.mTopLeft,     0.0f, color, smoothing);
+        WriteVertex({xPos,             yPos},     uv.mBottomLeft,  1.0f, color, smoothing);
+        WriteVertex({xPos + w,         yPos},     uv.mBottomRight, 1.0f, color, smoothing);
+        
+        WriteVertex({xPos + slant,     yPos + h}, uv.mTopLeft,     0.0f, color, smoothing);
+        WriteVertex({xPos + w,         yPos},     uv.mBottomRight, 1.0f, color, smoothing);
+        WriteVertex({xPos + w + slant, yPos + h}, uv.mTopRight,    0.0f, color, smoothing);
+    }
+}
+
+void GLES3TextRenderer::Flush() {
+    if (mNumVertices == 0) {
+        return;
+    }
+    
+    auto& shaderProgram = *mBatchShaderProgram;
     auto& uniforms = shaderProgram.GetUniforms();
     auto& attributes = shaderProgram.GetAttributes();
     
@@ -81,99 +169,26 @@ void GLES3TextRenderer::RenderText(const std::string& text,
         
         DisableVertexAttributes(shaderProgram);
         
-        auto stride = static_cast<int>(sizeof(Vec4) + sizeof(float));
         glBindBuffer(GL_ARRAY_BUFFER, mVbo);
-        glEnableVertexAttribArray(attributes.mTextCoords);
-        glVertexAttribPointer(attributes.mTextCoords, 4, GL_FLOAT, GL_FALSE, stride, 0);
-        
-        auto offset = sizeof(Vec4);
-        glEnableVertexAttribArray(attributes.mTextGradientFunction);
-        glVertexAttribPointer(attributes.mTextGradientFunction,
-                              1,
-                              GL_FLOAT,
-                              GL_FALSE,
-                              stride,
-                              reinterpret_cast<const GLvoid*>(offset));
+        EnableVertexAttribute(attributes.mTextCoords, 4, 0, numFloatsPerVertex);
+        EnableVertexAttribute(attributes.mTextGradientFunction, 1, 4, numFloatsPerVertex);
+        EnableVertexAttribute(attributes.mTextColor, 4, 5, numFloatsPerVertex);
+        EnableVertexAttribute(attributes.mTextSmoothing, 1, 9, numFloatsPerVertex);
     }
     
-    glUniform4fv(uniforms.mTextColor, 1, colorProperties.mColor.Pointer());
-    
-    if (colorProperties.mTopGradientColorSubtraction.HasValue()) {
+    if (mBatchColorProperties.mTopGradientColorSubtraction.HasValue()) {
         glUniform3fv(uniforms.mTextTopColorSubtraction,
                      1,
-                     colorProperties.mTopGradientColorSubtraction.GetValue().Pointer());
+                     mBatchColorProperties.mTopGradientColorSubtraction.GetValue().Pointer());
     }
 
-    if (colorProperties.mMidGradientColorSubtraction.HasValue()) {
+    if (mBatchColorProperties.mMidGradientColorSubtraction.HasValue()) {
         glUniform3fv(uniforms.mTextMidColorSubtraction,
                      1,
-                     colorProperties.mMidGradientColorSubtraction.GetValue().Pointer());
-    }
-    
-    switch (properties.mAlignment) {
-        case TextAlignment::Left:
-            break;
-        case TextAlignment::CenterX:
-            position = AdjustPositionCenterXAlignment(text, position, slant, properties);
-            break;
-    }
-    
-    auto& font = properties.mFont;
-    auto* texture = font.GetTexture();
-    if (texture == nullptr) {
-        assert(texture);
-        return;
-    }
-    
-    auto* textureAtlas = texture->GetAtlas();
-    if (textureAtlas == nullptr) {
-        assert(texture);
-        return;
+                     mBatchColorProperties.mMidGradientColorSubtraction.GetValue().Pointer());
     }
     
-    mRenderState.BindTexture(GL_TEXTURE0, GL_TEXTURE_2D, texture->GetHandles()->mGLHandle);
-    mVertexBuffer.Clear();
-    mNumVertices = 0;
-    
-    auto numCharacters = 0;
-    
-    for (auto c: text) {
-        if (numCharacters > maxNumCharacters) {
-            break;
-        }
-        
-        auto* glyph = font.GetGlyph(c);
-        if (glyph == nullptr) {
-            continue;
-        }
-        
-        GLfloat xPos {position.x + glyph->mBearing.x * properties.mScale};
-        GLfloat yPos {position.y - (glyph->mSize.y - glyph->mBearing.y) * properties.mScale};
-        GLfloat w {glyph->mSize.x * properties.mScale};
-        GLfloat h {glyph->mSize.y * properties.mScale};
-        
-        position.x += (glyph->mAdvance >> 6) * properties.mScale;
-        
-        auto textureIndex = glyph->mSubTextureIndex;
-        if (!textureIndex.HasValue()) {
-            continue;
-        }
-        
-        auto* uv = textureAtlas->GetSubTextureUV(textureIndex.GetValue());
-        if (uv == nullptr) {
-            continue;
-        }
-
-        WriteVertex({xPos + slant,     yPos + h}, {uv->mTopLeft.x,     uv->mTopLeft.y},     0.0f);
-        WriteVertex({xPos,             yPos},     {uv->mBottomLeft.x,  uv->mBottomLeft.y},  1.0f);
-        WriteVertex({xPos + w,         yPos},     {uv->mBottomRight.x, uv->mBottomRight.y}, 1.0f);
-        
-        WriteVertex({xPos + slant,     yPos + h}, {uv->mTopLeft.x,     uv->mTopLeft.y},     0.0f);
-        WriteVertex({xPos + w,         yPos},     {uv->mBottomRight.x, uv->mBottomRight.y}, 1.0f);
-        WriteVertex({xPos + w + slant, yPos + h}, {uv->mTopRight.x,    uv->mTopRight.y},    0.0f);
-
-        ++numCharacters;
-    }
+    mRenderState.BindTexture(GL_TEXTURE0, GL_TEXTURE_2D, mBatchTexture->GetHandles()->mGLHandle);
     
     // Should use glBufferSubData here but it leads to very poor performance for some reason.
     glBufferData(GL_ARRAY_BUFFER,
@@ -182,21 +197,53 @@ void GLES3TextRenderer::RenderText(const std::string& text,
                  GL_DYNAMIC_DRAW);
     glDrawArrays(GL_TRIANGLES, 0, mNumVertices);
     IF_USING_FRAME_STATS(mRenderState.ReportDrawCall());
+    
+    mVertexBuffer.Clear();
+    mNumVertices = 0;
 }
 
 void GLES3TextRenderer::WriteVertex(const Vec2& position,
                                     const Vec2& textureCoords,
-                                    float gradientFunction) {
+                                    float gradientFunction,
+                                    const Vec4& color,
+                                    float smoothing) {
     mVertexBuffer.PushBack(position.x);
     mVertexBuffer.PushBack(position.y);
     mVertexBuffer.PushBack(textureCoords.x);
     mVertexBuffer.PushBack(textureCoords.y);
     mVertexBuffer.PushBack(gradientFunction);
+    mVertexBuffer.PushBack(color.x);
+    mVertexBuffer.PushBack(color.y);
+    mVertexBuffer.PushBack(color.z);
+    mVertexBuffer.PushBack(color.w);
+    mVertexBuffer.PushBack(smoothing);
 
     ++mNumVertices;
 }
 
-GLES3ShaderProgram& GLES3TextRenderer::GetShaderProgram(RenderQueue::TextKind textKind) {
+GLES3ShaderProgram& GLES3TextRenderer::GetShaderProgram(RenderQueue::TextKind textKind,
+                                                       const Font& font) {
+    if (font.IsDistanceField()) {
+        switch (textKind) {
+            case RenderQueue::TextKind::DoubleGradientShader:
+                return mTextDistanceFieldDoubleGradientShader;
+            case RenderQueue::TextKind::TopGradientShader:
+                return mTextDistanceFieldTopGradientShader;
+            case RenderQueue::TextKind::MidGradientShader:
+                return mTextDistanceFieldMidGradientShader;
+            case RenderQueue::TextKind::PlainShader:
+            case RenderQueue::TextKind::Specular:
+            case RenderQueue::TextKind::Shadow:
+            case RenderQueue::TextKind::SecondShadow:
+                return mTextDistanceFieldShader;
+            case RenderQueue::TextKind::None:
+                assert(false);
+                break;
+        }
+        
+        return mTextDistanceFieldShader;
+    }
+    
     switch (textKind) {
         case RenderQueue::TextKind::DoubleGradientShader:
             return mTextDoubleGradientShader;
@@ -216,50 +263,3 @@ GLES3ShaderProgram& GLES3TextRenderer::GetShaderProgram(RenderQueue::TextKind te
 
     return mTextShader;
 }
-
-Vec2 GLES3TextRenderer::AdjustPositionCenterXAlignment(const std::string& text,
-                                                       Vec2 position,
-                                                       float slant,
-                                                       const TextProperties& properties) {
-    if (text.empty()) {
-        return position;
-    }
-    
-    auto textWidth = CalculateTextWidth(text, slant, properties);
-    auto* firstGlyph = properties.mFont.GetGlyph(text.front());
-    if (firstGlyph) {
-        position.x = position.x - firstGlyph->mBearing.x * properties.mScale - textWidth / 2.0f;
-    }
-    
-    return position;
-}
-
-float GLES3TextRenderer::CalculateTextWidth(const std::string& text,
-                                            float slant,
-                                            const TextProperties& properties) {
-    if (text.empty()) {
-        return 0.0f;
-    }
-    
-    auto x = 0.0f;
-    auto textStartX = x;
-    for (auto i = 0; i < text.size(); ++i) {
-        auto* glyph = properties.mFont.GetGlyph(text[i]);
-        if (glyph == nullptr) {
-            return 0.0f;
-        }
-        
-        if (i == 0) {
-            textStartX = glyph->mBearing.x;
-        }
-        
-        if (i == text.size() - 1) {
-            x += glyph->mBearing.x + glyph->mSize.x + slant;
-            break;
-        }
-        
-        x += glyph->mAdvance >> 6;
-    }
-    
-    return (x - textStartX) * properties.mScale;
-}
@@ -14,8 +14,13 @@
 namespace Pht {
     class Font;
     class TextProperties;
+    class TextLayout;
+    class Texture;
     class GLES3RenderStateManager;
     
+    // Collects the glyph quads of consecutive texts that use the same text shader, font texture
+    // and gradient, and draws them with one upload and draw call when flushed. The color and the
+    // outline smoothing are vertex attributes so that they can differ between the texts.
     class GLES3TextRenderer {
     public:
         GLES3TextRenderer(GLES3RenderStateManager& renderState, const IVec2& screenSize);
@@ -27,42 +32,48 @@ namespace Pht {
             Pht::Optional<Pht::Vec3> mMidGradientColorSubtraction;
         };
         
-        void RenderText(const std::string& text,
-                        Vec2 position,
-                        float slant,
-                        RenderQueue::TextKind textKind,
-                        const ColorProperties& colorProperties,
-                        const TextProperties& properties);
+        // Texts added after a flush start a new batch, which takes its shader, texture and
+        // gradient from the first text.
+        void AddText(const TextLayout& layout,
+                     const Vec2& position,
+                     RenderQueue::TextKind textKind,
+                     const ColorProperties& colorProperties,
+                     const TextProperties& properties);
+        void Flush();
         
     private:
-        void WriteVertex(const Vec2& position, const Vec2& textureCoords, float gradientFunction);
+        void WriteVertex(const Vec2& position,
+                         const Vec2& textureCoords,
+                         float gradientFunction,
+                         const Vec4& color,
+                         float smoothing);
         void BuildShader(GLES3ShaderProgram& shader,
                          const char* vertexShaderSource,
                          const char* fragmentShaderSource);
-        GLES3ShaderProgram& GetShaderProgram(RenderQueue::TextKind textKind);
-        Vec2 AdjustPositionCenterXAlignment(const std::string& text,
-                                            Vec2 position,
-                                            float slant,
-                                            const TextProperties& properties);
-        float CalculateTextWidth(const std::string& text,
-                                 float slant,
-                                 const TextProperties& properties);
+        GLES3ShaderProgram& GetShaderProgram(RenderQueue::TextKind textKind, const Font& font);
         
-        static constexpr auto maxNumCharacters = 512;
-        static constexpr auto numFloatsPerVertex = 5;
+        static constexpr auto maxNumCharacters = 1024;
+        static constexpr auto numFloatsPerVertex = 10;
         static constexpr auto numVerticesPerCharacter = 6;
-        static constexpr auto vertexBufferCapacity = maxNumCharacters * numFloatsPerVertex *
-                                                     numVerticesPerCharacter;
+        static constexpr auto maxNumVertices = maxNumCharacters * numVerticesPerCharacter;
+        static constexpr auto vertexBufferCapacity = maxNumVertices * numFloatsPerVertex;
         
         GLES3RenderStateManager& mRenderState;
         Mat4 mProjection;
         GLuint mVbo {0};
         StaticVector<float, vertexBufferCapacity> mVertexBuffer;
         int mNumVertices {0};
+        GLES3ShaderProgram* mBatchShaderProgram {nullptr};
+        const Texture* mBatchTexture {nullptr};
+        ColorProperties mBatchColorProperties;
         GLES3ShaderProgram mTextShader;
         GLES3ShaderProgram mTextDoubleGradientShader;
         GLES3ShaderProgram mTextTopGradientShader;
         GLES3ShaderProgram mTextMidGradientShader;
+        GLES3ShaderProgram mTextDistanceFieldShader;
+        GLES3ShaderProgram mTextDistanceFieldDoubleGradientShader;
+        GLES3ShaderProgram mTextDistanceFieldTopGradientShader;
+        GLES3ShaderProgram mTextDistanceFieldMidGradientShader;
     };
 }
 
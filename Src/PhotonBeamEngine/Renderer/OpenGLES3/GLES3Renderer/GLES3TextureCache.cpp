@@ -295,3 +295,21 @@ TextureCache::GetTextureAtlas(const std::string& name,
     atlasTextures.emplace_back(key, texture);
     return texture;
 }
+
+std::shared_ptr<Texture>
+TextureCache::GetTextureAtlas(const std::string& name,
+                              const IImage& atlasImage,
+                              std::unique_ptr<TextureAtlas> textureAtlas,
+                              const TextureAtlasConfig& textureAtlasConfig) {
+    AtlasTextureKey key {name, textureAtlasConfig};
+    auto textureFromCache = LookupTexture<AtlasTextureKey>(atlasTextures, key);
+    if (textureFromCache != nullptr) {
+        return textureFromCache;
+    }
+    
+    auto texture = textureAtlasConfig.mGenerateMipmap == GenerateMipmap::Yes ?
+                   CreateTexture(atlasImage, GenerateMipmap::Yes, std::move(textureAtlas)) :
+                   CreateAtlasTextureNoMipmap(atlasImage, std::move(textureAtlas));
+    atlasTextures.emplace_back(key, texture);
+    return texture;
+}
@@ -0,0 +1,15 @@
+static const char* TextDistanceFieldFragmentShader = STRINGIFY(
+
+varying highp vec2 TextureCoordOut;
+varying mediump vec4 TextColorOut;
+varying mediump float TextSmoothingOut;
+
+uniform sampler2D Sampler;
+
+void main(void) {
+    mediump float fieldValue = texture2D(Sampler, TextureCoordOut).a;
+    mediump float alpha = smoothstep(0.5 - TextSmoothingOut, 0.5 + TextSmoothingOut, fieldValue);
+    gl_FragColor = vec4(1.0, 1.0, 1.0, alpha) * TextColorOut;
+}
+
+);
@@ -0,0 +1,21 @@
+static const char* TextDistanceFieldMidGradientFragmentShader = STRINGIFY(
+
+varying highp vec2 TextureCoordOut;
+varying mediump vec4 TextColorOut;
+varying mediump float TextSmoothingOut;
+varying highp float TextGradientFunctionOut;
+
+uniform sampler2D Sampler;
+uniform mediump vec3 TextMidColorSubtraction;
+
+void main(void) {
+    mediump float fieldValue = texture2D(Sampler, TextureCoordOut).a;
+    mediump float alpha = smoothstep(0.5 - TextSmoothingOut, 0.5 + TextSmoothingOut, fieldValue);
+    if (TextGradientFunctionOut > 0.5) {
+        gl_FragColor = vec4(vec3(1.0, 1.0, 1.0) - 2.0 * TextMidColorSubtraction * (1.0 - TextGradientFunctionOut), alpha * TextColorOut.w);
+    } else {
+        gl_FragColor = vec4(vec3(1.0, 1.0, 1.0), alpha) * TextColorOut;
+    }
+}
+
+);
@@ -0,0 +1,17 @@
+static const char* TextDistanceFieldTopGradientFragmentShader = STRINGIFY(
+
+varying highp vec2 TextureCoordOut;
+varying mediump vec4 TextColorOut;
+varying mediump float TextSmoothingOut;
+varying highp float TextGradientFunctionOut;
+
+uniform sampler2D Sampler;
+uniform mediump vec3 TextTopColorSubtraction;
+
+void main(void) {
+    mediump float fieldValue = texture2D(Sampler, TextureCoordOut).a;
+    mediump float alpha = smoothstep(0.5 - TextSmoothingOut, 0.5 + TextSmoothingOut, fieldValue);
+    gl_FragColor = vec4(TextColorOut.xyz - TextTopColorSubtraction * (1.0 - TextGradientFunctionOut), alpha * TextColorOut.w);
+}
+
+);
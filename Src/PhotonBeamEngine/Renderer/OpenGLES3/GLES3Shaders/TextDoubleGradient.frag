@@ -1,18 +1,18 @@
 static const char* TextDoubleGradientFragmentShader = STRINGIFY(
 
 varying highp vec2 TextureCoordOut;
+varying mediump vec4 TextColorOut;
 varying highp float TextGradientFunctionOut;
 
 uniform sampler2D Sampler;
-uniform mediump vec4 TextColor;
 uniform mediump vec3 TextTopColorSubtraction;
 uniform mediump vec3 TextMidColorSubtraction;
 
 void main(void) {
     if (TextGradientFunctionOut > 0.5) {
-        gl_FragColor = vec4(TextColor.xyz - 2.0 * TextMidColorSubtraction * (1.0 - TextGradientFunctionOut), texture2D(Sampler, TextureCoordOut).a * TextColor.w);
+        gl_FragColor = vec4(TextColorOut.xyz - 2.0 * TextMidColorSubtraction * (1.0 - TextGradientFunctionOut), texture2D(Sampler, TextureCoordOut).a * TextColorOut.w);
     } else {
-        gl_FragColor = vec4(vec3(1.0, 1.0, 1.0) - 2.0 * TextTopColorSubtraction * (0.5 - TextGradientFunctionOut), texture2D(Sampler, TextureCoordOut).a * TextColor.w);
+        gl_FragColor = vec4(vec3(1.0, 1.0, 1.0) - 2.0 * TextTopColorSubtraction * (0.5 - TextGradientFunctionOut), texture2D(Sampler, TextureCoordOut).a * TextColorOut.w);
     }
 }
 
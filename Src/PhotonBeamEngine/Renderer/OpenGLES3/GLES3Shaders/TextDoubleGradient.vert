@@ -2,15 +2,21 @@ static const char* TextDoubleGradientVertexShader = STRINGIFY(
 
 attribute vec4 TextCoords;
 attribute float TextGradientFunction;
+attribute vec4 TextColor;
+attribute float TextSmoothing;
 
 uniform mat4 Projection;
 
 varying vec2 TextureCoordOut;
 varying float TextGradientFunctionOut;
+varying vec4 TextColorOut;
+varying float TextSmoothingOut;
 
 void main(void) {
     gl_Position = Projection * vec4(TextCoords.xy, 0.0, 1.0);
     TextureCoordOut = TextCoords.zw;
+    TextColorOut = TextColor;
+    TextSmoothingOut = TextSmoothing;
     TextGradientFunctionOut = TextGradientFunction;
 }
     
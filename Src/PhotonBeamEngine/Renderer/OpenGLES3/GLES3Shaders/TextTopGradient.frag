@@ -1,14 +1,14 @@
 static const char* TextTopGradientFragmentShader = STRINGIFY(
 
 varying highp vec2 TextureCoordOut;
+varying mediump vec4 TextColorOut;
 varying highp float TextGradientFunctionOut;
 
 uniform sampler2D Sampler;
-uniform mediump vec4 TextColor;
 uniform mediump vec3 TextTopColorSubtraction;
 
 void main(void) {
-    gl_FragColor = vec4(TextColor.xyz - TextTopColorSubtraction * (1.0 - TextGradientFunctionOut), texture2D(Sampler, TextureCoordOut).a * TextColor.w);
+    gl_FragColor = vec4(TextColorOut.xyz - TextTopColorSubtraction * (1.0 - TextGradientFunctionOut), texture2D(Sampler, TextureCoordOut).a * TextColorOut.w);
 }
 
 );
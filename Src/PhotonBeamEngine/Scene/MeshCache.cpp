@@ -0,0 +1,321 @@
+#include "MeshCache.hpp"
+
+#include <fstream>
+#include <cstring>
+#include <assert.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using namespace Pht;
+
+namespace {
+    const std::string objSuffix {".obj"};
+    const std::string cacheSuffix {".pmesh"};
+    const char magic[4] {'P', 'M', 'S', 'H'};
+    constexpr uint32_t version {2};
+    
+    constexpr uint32_t normalsFlag {1};
+    constexpr uint32_t textureCoordsFlag {2};
+    constexpr uint32_t colorsFlag {4};
+    constexpr uint32_t pointSizesFlag {8};
+    
+    const VertexFlags cachedVertexFlags {.mNormals = true, .mTextureCoords = true};
+    constexpr auto floatsPerCachedVertex = 3 + 3 + 2;
+    constexpr auto maxNumVertices = 65535;
+    
+    struct Header {
+        char mMagic[4];
+        uint32_t mVersion;
+        uint32_t mVertexFlags;
+        uint32_t mNumVertices;
+        uint32_t mNumIndices;
+        float mMeshCenter[3];
+        uint64_t mSourceHash;
+    };
+    
+    static_assert(sizeof(Header) % sizeof(float) == 0, "The vertices must be aligned");
+    
+    class MappedFile {
+    public:
+        explicit MappedFile(const std::string& filename) {
+            auto fileDescriptor = open(filename.c_str(), O_RDONLY);
+            if (fileDescriptor == -1) {
+                return;
+            }
+            
+            struct stat fileStatus;
+            if (fstat(fileDescriptor, &fileStatus) != 0 || fileStatus.st_size <= 0) {
+                close(fileDescriptor);
+                return;
+            }
+            
+            auto size = static_cast<size_t>(fileStatus.st_size);
+            auto* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+            close(fileDescriptor);
+            
+            if (data != MAP_FAILED) {
+                mData = static_cast<const uint8_t*>(data);
+                mSize = size;
+            }
+        }
+        
+        ~MappedFile() {
+            if (mData) {
+                munmap(const_cast<uint8_t*>(mData), mSize);
+            }
+        }
+        
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        
+        const uint8_t* GetData() const {
+            return mData;
+        }
+        
+        size_t GetSize() const {
+            return mSize;
+        }
+        
+    private:
+        const uint8_t* mData {nullptr};
+        size_t mSize {0};
+    };
+    
+    // Hashes eight bytes at a time since all OBJ files are hashed when checking the cache files.
+    uint64_t CalcHash(const uint8_t* data, size_t size) {
+        constexpr uint64_t multiplier {0x9e3779b97f4a7c15ull};
+        uint64_t hash {size};
+        size_t i {0};
+        
+        for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+            uint64_t word;
+            std::memcpy(&word, data + i, sizeof(uint64_t));
+            hash = (hash ^ word) * multiplier;
+            hash ^= hash >> 29;
+        }
+        
+        for (; i < size; ++i) {
+            hash = (hash ^ data[i]) * multiplier;
+            hash ^= hash >> 29;
+        }
+        
+        return hash;
+    }
+    
+    uint32_t ToBits(const VertexFlags& flags) {
+        uint32_t bits {0};
+        
+        if (flags.mNormals) {
+            bits |= normalsFlag;
+        }
+        if (flags.mTextureCoords) {
+            bits |= textureCoordsFlag;
+        }
+        if (flags.mColors) {
+            bits |= colorsFlag;
+        }
+        if (flags.mPointSizes) {
+            bits |= pointSizesFlag;
+        }
+        
+        return bits;
+    }
+    
+    size_t CalcFileSize(uint32_t numVertices, uint32_t numIndices) {
+        return sizeof(Header) + numVertices * floatsPerCachedVertex * sizeof(float) +
+               numIndices * sizeof(uint16_t);
+    }
+    
+    bool IsValid(const Header& header, size_t fileSize) {
+        return std::memcmp(header.mMagic, magic, sizeof(magic)) == 0 &&
+               header.mVersion == version &&
+               header.mVertexFlags == ToBits(cachedVertexFlags) &&
+               header.mNumVertices <= maxNumVertices &&
+               header.mNumIndices % 3 == 0 &&
+               fileSize == CalcFileSize(header.mNumVertices, header.mNumIndices);
+    }
+    
+    bool AreIndicesValid(const uint16_t* indices, int numIndices, int numVertices) {
+        for (auto i = 0; i < numIndices; ++i) {
+            if (indices[i] >= numVertices) {
+                return false;
+            }
+        }
+        
+        return true;
+    }
+    
+    void WriteVertices(float* vertexWrite,
+                       const float* vertexRead,
+                       int numVertices,
+                       VertexFlags attributeFlags,
+                       float scale,
+                       const Vec3& center) {
+        // Gives the same result as the OBJ loader, which moves the mesh before scaling it.
+        for (auto i = 0; i < numVertices; ++i) {
+            *vertexWrite++ = (vertexRead[0] - center.x) * scale;
+            *vertexWrite++ = (vertexRead[1] - center.y) * scale;
+            *vertexWrite++ = (vertexRead[2] - center.z) * scale;
+            
+            if (attributeFlags.mNormals) {
+                *vertexWrite++ = vertexRead[3];
+                *vertexWrite++ = vertexRead[4];
+                *vertexWrite++ = vertexRead[5];
+            }
+            
+            if (attributeFlags.mTextureCoords) {
+                *vertexWrite++ = vertexRead[6];
+                *vertexWrite++ = vertexRead[7];
+            }
+            
+            if (attributeFlags.mColors) {
+                *vertexWrite++ = 1.0f;
+                *vertexWrite++ = 1.0f;
+                *vertexWrite++ = 1.0f;
+                *vertexWrite++ = 1.0f;
+            }
+            
+            vertexRead += floatsPerCachedVertex;
+        }
+    }
+    
+    std::unique_ptr<VertexBuffer> CreateVertexBuffer(const uint8_t* data,
+                                                     size_t dataSize,
+                                                     VertexFlags attributeFlags,
+                                                     float scale,
+                                                     MoveMeshToOrigin moveMeshToOrigin) {
+        if (dataSize < sizeof(Header)) {
+            return nullptr;
+        }
+        
+        Header header;
+        std::memcpy(&header, data, sizeof(Header));
+        if (!IsValid(header, dataSize)) {
+            return nullptr;
+        }
+        
+        auto numVertices = static_cast<int>(header.mNumVertices);
+        auto numIndices = static_cast<int>(header.mNumIndices);
+        auto* vertexRead = reinterpret_cast<const float*>(data + sizeof(Header));
+        auto* indexRead =
+            reinterpret_cast<const uint16_t*>(vertexRead + numVertices * floatsPerCachedVertex);
+        
+        if (!AreIndicesValid(indexRead, numIndices, numVertices)) {
+            return nullptr;
+        }
+        
+        auto vertexBuffer = std::make_unique<VertexBuffer>(numVertices, numIndices, attributeFlags);
+        auto* vertexWrite = vertexBuffer->AppendVertices(numVertices);
+        
+        if (attributeFlags == cachedVertexFlags && scale == 1.0f &&
+            moveMeshToOrigin == MoveMeshToOrigin::No) {
+            
+            std::memcpy(vertexWrite,
+                        vertexRead,
+                        numVertices * floatsPerCachedVertex * sizeof(float));
+        } else {
+            // Subtracting zero keeps negative zeros, so the result is the same as not moving.
+            Vec3 center {0.0f, 0.0f, 0.0f};
+            if (moveMeshToOrigin == MoveMeshToOrigin::Yes) {
+                center = Vec3 {header.mMeshCenter[0], header.mMeshCenter[1], header.mMeshCenter[2]};
+            }
+            
+            WriteVertices(vertexWrite, vertexRead, numVertices, attributeFlags, scale, center);
+        }
+        
+        std::memcpy(vertexBuffer->AppendIndices(numIndices),
+                    indexRead,
+                    numIndices * sizeof(uint16_t));
+        return vertexBuffer;
+    }
+}
+
+VertexFlags MeshCache::GetVertexFlags() {
+    return cachedVertexFlags;
+}
+
+std::string MeshCache::ToCacheFilename(const std::string& objFilename) {
+    auto suffixPosition = objFilename.size() - objSuffix.size();
+    if (objFilename.size() > objSuffix.size() &&
+        objFilename.compare(suffixPosition, objSuffix.size(), objSuffix) == 0) {
+        
+        return objFilename.substr(0, suffixPosition) + cacheSuffix;
+    }
+    
+    return objFilename + cacheSuffix;
+}
+
+Optional<uint64_t> MeshCache::CalcSourceHash(const std::string& objFilename) {
+    MappedFile objFile {objFilename};
+    if (objFile.GetData() == nullptr) {
+        return {};
+    }
+    
+    return CalcHash(objFile.GetData(), objFile.GetSize());
+}
+
+bool MeshCache::IsUpToDate(const std::string& filename, const std::string& objFilename) {
+    MappedFile cacheFile {filename};
+    if (cacheFile.GetData() == nullptr || cacheFile.GetSize() < sizeof(Header)) {
+        return false;
+    }
+    
+    Header header;
+    std::memcpy(&header, cacheFile.GetData(), sizeof(Header));
+    if (!IsValid(header, cacheFile.GetSize())) {
+        return false;
+    }
+    
+    auto sourceHash = CalcSourceHash(objFilename);
+    return sourceHash.HasValue() && sourceHash.GetValue() == header.mSourceHash;
+}
+
+bool MeshCache::Write(const std::string& filename,
+                      const VertexBuffer& vertexBuffer,
+                      const Vec3& meshCenter,
+                      uint64_t sourceHash) {
+    assert(vertexBuffer.GetAttributeFlags() == cachedVertexFlags);
+    
+    Header header {
+        .mVersion = version,
+        .mVertexFlags = ToBits(cachedVertexFlags),
+        .mNumVertices = static_cast<uint32_t>(vertexBuffer.GetNumVertices()),
+        .mNumIndices = static_cast<uint32_t>(vertexBuffer.GetNumIndices()),
+        .mMeshCenter = {meshCenter.x, meshCenter.y, meshCenter.z},
+        .mSourceHash = sourceHash
+    };
+    
+    std::memcpy(header.mMagic, magic, sizeof(magic));
+    
+    std::ofstream file {filename, std::ios::binary};
+    if (!file.is_open()) {
+        return false;
+    }
+    
+    file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    file.write(reinterpret_cast<const char*>(vertexBuffer.GetVertexBuffer()),
+               vertexBuffer.GetVertexBufferSize() * sizeof(float));
+    file.write(reinterpret_cast<const char*>(vertexBuffer.GetIndexBuffer()),
+               vertexBuffer.GetIndexBufferSize() * sizeof(uint16_t));
+    return static_cast<bool>(file);
+}
+
+std::unique_ptr<VertexBuffer> MeshCache::Load(const std::string& filename,
+                                              VertexFlags attributeFlags,
+                                              float scale,
+                                              MoveMeshToOrigin moveMeshToOrigin) {
+    assert(attributeFlags.mNormals && !attributeFlags.mPointSizes);
+    
+    MappedFile cacheFile {filename};
+    if (cacheFile.GetData() == nullptr) {
+        return nullptr;
+    }
+    
+    return CreateVertexBuffer(cacheFile.GetData(),
+                              cacheFile.GetSize(),
+                              attributeFlags,
+                              scale,
+                              moveMeshToOrigin);
+}
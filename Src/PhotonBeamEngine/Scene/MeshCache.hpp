@@ -0,0 +1,41 @@
+#ifndef MeshCache_hpp
+#define MeshCache_hpp
+
+#include <memory>
+#include <string>
+
+#include "VertexBuffer.hpp"
+#include "ObjMeshLoader.hpp"
+#include "Optional.hpp"
+
+namespace Pht {
+    // A mesh cache file is an OBJ mesh converted offline into an indexed vertex buffer with
+    // interleaved positions, normals and texture coordinates, unscaled and not moved to the
+    // origin. The file starts with a header containing the version, the vertex flags, the
+    // vertex and index counts, the center of the mesh and a hash of the OBJ file it was converted
+    // from, followed by the vertices and the 16-bit indices in native byte order. The hash is only
+    // checked when building, by the mesh converter, so loading a mesh does not read its OBJ file.
+    namespace MeshCache {
+        // The attributes of the vertices in a mesh cache file.
+        VertexFlags GetVertexFlags();
+        std::string ToCacheFilename(const std::string& objFilename);
+        Optional<uint64_t> CalcSourceHash(const std::string& objFilename);
+        bool Write(const std::string& filename,
+                   const VertexBuffer& vertexBuffer,
+                   const Vec3& meshCenter,
+                   uint64_t sourceHash);
+        
+        // Returns false if the file does not exist, is not valid or was converted from another
+        // version of the OBJ file.
+        bool IsUpToDate(const std::string& filename, const std::string& objFilename);
+        
+        // Returns nullptr if the file does not exist, has another version or size or has indices
+        // outside the vertices.
+        std::unique_ptr<VertexBuffer> Load(const std::string& filename,
+                                           VertexFlags attributeFlags,
+                                           float scale,
+                                           MoveMeshToOrigin moveMeshToOrigin);
+    }
+}
+
+#endif
@@ -1,220 +1,299 @@
 #include "ObjMeshLoader.hpp"
 
 #include <fstream>
+#include <iostream>
 #include <vector>
-#include <map>
+#include <unordered_map>
+#include <cstdlib>
+#include <cstring>
 #include <assert.h>
 
 #include "FileSystem.hpp"
 #include "Vector.hpp"
+#include "MeshCache.hpp"
 
 using namespace Pht;
 
 namespace {
-    constexpr auto maxLineSize = 128;
-    constexpr auto unknownIndex = -1;
+    constexpr auto maxNumVertices = 65536;
+    constexpr auto maxNumFastPathDigits = 19;
+    constexpr auto maxFastPathExponent = 22;
+    constexpr uint64_t maxFastPathMantissa {uint64_t{1} << 53};
     
-    struct Quantities {
-        int mVertexCount {0};
-        int mTextureCoordCount {0};
-        int mNormalCount {0};
-        int mIndexCount {0};
+    // All powers of ten up to 1e22 are exact doubles.
+    const double powersOfTen[] {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
     };
     
     struct VertexRef {
         int mVertexIndex {0};
         int mTextureCoordIndex {0};
         int mNormalIndex {0};
+    };
+    
+    struct ObjData {
+        std::vector<Vec3> mVertices;
+        std::vector<Vec2> mTextureCoords;
+        std::vector<Vec3> mNormals;
+        std::vector<VertexRef> mFaceVertexRefs;
+    };
+    
+    // The attributes of a vertex in the vertex buffer, compared bit by bit when removing
+    // duplicated vertices.
+    struct VertexKey {
+        float mValues[8];
         
-        bool operator<(const VertexRef& other) const {
-            if (mVertexIndex < other.mVertexIndex) {
-                return true;
-            } else if (mVertexIndex == other.mVertexIndex) {
-                if (mTextureCoordIndex < other.mTextureCoordIndex) {
-                    return true;
-                } else if (mTextureCoordIndex == other.mTextureCoordIndex) {
-                    return mNormalIndex < other.mNormalIndex;
-                } else {
-                    return false;
-                }
-            } else {
-                return false;
-            }
+        bool operator==(const VertexKey& other) const {
+            return std::memcmp(mValues, other.mValues, sizeof(mValues)) == 0;
         }
     };
     
-    struct VertexRefs {
-        std::map<VertexRef, int> mNewIndices;
-        std::vector<VertexRef> mVertexRefVector;
+    struct VertexKeyHash {
+        size_t operator()(const VertexKey& key) const {
+            // FNV-1a over the bits of the values.
+            uint64_t hash {14695981039346656037ull};
+            for (auto value: key.mValues) {
+                uint32_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                hash = (hash ^ bits) * 1099511628211ull;
+            }
+            
+            return static_cast<size_t>(hash);
+        }
     };
     
-    Quantities GetQuantities(const std::string& filename) {
-        Quantities quantities;
-        std::ifstream objFile {filename};
-        assert(objFile.is_open());
+    std::vector<char> ReadFile(const std::string& filename) {
+        std::ifstream file {filename, std::ios::binary | std::ios::ate};
+        auto position = file.tellg();
         
-        while (objFile) {
-            switch (objFile.get()) {
-                case 'v':
-                    switch (objFile.get()) {
-                        case ' ':
-                            quantities.mVertexCount++;
-                            break;
-                        case 't':
-                            quantities.mTextureCoordCount++;
-                            break;
-                        case 'n':
-                            quantities.mNormalCount++;
-                            break;
-                        default:
-                            break;
-                    }
-                    break;
-                case 'f':
-                    quantities.mIndexCount += 3;
-                    break;
-                default:
-                    break;
-            }
+        if (file && position >= 0) {
+            auto size = static_cast<size_t>(position);
+            file.seekg(0);
             
-            objFile.ignore(maxLineSize, '\n');
+            // The terminating zero stops the parser at the end of the buffer.
+            std::vector<char> buffer(size + 1);
+            if (file.read(buffer.data(), size)) {
+                buffer[size] = '\0';
+                return buffer;
+            }
         }
         
-        return quantities;
+        // An empty buffer gives an empty mesh.
+        std::cout << "Pht::ObjMeshLoader: ERROR: Could not read " << filename << std::endl;
+        return std::vector<char>(1, '\0');
     }
     
-    void ReadVertices(std::vector<Vec3>& vertices, const std::string& filename) {
-        std::ifstream objFile {filename};
-        assert(objFile.is_open());
-        auto index = 0;
+    const char* SkipSpaces(const char* read) {
+        while (*read == ' ' || *read == '\t') {
+            ++read;
+        }
         
-        while (objFile) {
-            if (objFile.get() == 'v' && objFile.get() == ' ') {
-                assert(index < vertices.size());
-                
-                auto& vertex = vertices[index];
-                objFile >> vertex.x;
-                objFile >> vertex.y;
-                objFile >> vertex.z;
-                
-                ++index;
-            }
-            
-            objFile.ignore(maxLineSize, '\n');
+        return read;
+    }
+    
+    const char* SkipLine(const char* read) {
+        while (*read != '\n' && *read != '\0') {
+            ++read;
         }
+        
+        return *read == '\n' ? read + 1 : read;
     }
-
-    void ReadTextureCoords(std::vector<Vec2>& textureCoords, const std::string& filename) {
-        std::ifstream objFile {filename};
-        assert(objFile.is_open());
-        auto index = 0;
+    
+    bool IsDigit(char c) {
+        return c >= '0' && c <= '9';
+    }
+    
+    const char* ParseInt(const char* read, int& value) {
+        auto isNegative = false;
+        if (*read == '-') {
+            isNegative = true;
+            ++read;
+        }
         
-        while (objFile) {
-            if (objFile.get() == 'v' && objFile.get() == 't') {
-                assert(index < textureCoords.size());
-                
-                auto& textureCoord = textureCoords[index];
-                objFile >> textureCoord.x;
-                objFile >> textureCoord.y;
-                
-                textureCoord.y = 1.0f - textureCoord.y;
-                
-                ++index;
-            }
-            
-            objFile.ignore(maxLineSize, '\n');
+        auto result = 0;
+        while (IsDigit(*read)) {
+            result = result * 10 + (*read - '0');
+            ++read;
         }
+        
+        value = isNegative ? -result : result;
+        return read;
     }
-
-    void ReadNormals(std::vector<Vec3>& normals, const std::string& filename) {
-        std::ifstream objFile {filename};
-        assert(objFile.is_open());
-        auto index = 0;
+    
+    // Numbers with at most 19 significant digits whose mantissa and power of ten are exact doubles
+    // are converted with one multiplication or division, which rounds correctly. Other numbers are
+    // handed to strtod.
+    const char* ParseFloat(const char* read, float& value) {
+        read = SkipSpaces(read);
+        auto* begin = read;
         
-        while (objFile) {
-            if (objFile.get() == 'v' && objFile.get() == 'n') {
-                assert(index < normals.size());
-                
-                auto& normal = normals[index];
-                objFile >> normal.x;
-                objFile >> normal.y;
-                objFile >> normal.z;
-                
-                normal.Normalize();
-                
-                ++index;
+        auto isNegative = false;
+        if (*read == '-' || *read == '+') {
+            isNegative = *read == '-';
+            ++read;
+        }
+        
+        uint64_t mantissa {0};
+        auto numDigits = 0;
+        auto exponent = 0;
+        
+        for (; IsDigit(*read); ++read) {
+            if (numDigits < maxNumFastPathDigits) {
+                mantissa = mantissa * 10 + (*read - '0');
+                numDigits += mantissa > 0;
+            } else {
+                ++exponent;
+            }
+        }
+        
+        if (*read == '.') {
+            for (++read; IsDigit(*read); ++read) {
+                if (numDigits < maxNumFastPathDigits) {
+                    mantissa = mantissa * 10 + (*read - '0');
+                    numDigits += mantissa > 0;
+                    --exponent;
+                }
+            }
+        }
+        
+        if (*read == 'e' || *read == 'E') {
+            auto explicitExponent = 0;
+            auto* exponentRead = read + 1;
+            if (*exponentRead == '+') {
+                ++exponentRead;
             }
             
-            objFile.ignore(maxLineSize, '\n');
+            read = ParseInt(exponentRead, explicitExponent);
+            exponent += explicitExponent;
+        }
+        
+        if (numDigits >= maxNumFastPathDigits || mantissa > maxFastPathMantissa ||
+            exponent < -maxFastPathExponent || exponent > maxFastPathExponent) {
+            
+            char* end {nullptr};
+            value = static_cast<float>(std::strtod(begin, &end));
+            return end;
+        }
+        
+        auto result = static_cast<double>(mantissa);
+        if (exponent < 0) {
+            result /= powersOfTen[-exponent];
+        } else {
+            result *= powersOfTen[exponent];
         }
+        
+        value = static_cast<float>(isNegative ? -result : result);
+        return read;
     }
     
-    void ReadVertexIndices(VertexRefs& vertexRefs,
-                           const Quantities& quantities,
-                           std::ifstream& objFile) {
-        VertexRef vertexRef;
+    int ToZeroBasedIndex(int objIndex, size_t count) {
+        // Negative indices are relative to the end of the elements read so far.
+        auto index = objIndex < 0 ? static_cast<int>(count) + objIndex : objIndex - 1;
+        assert(index >= 0 && index < count);
+        return index;
+    }
+    
+    const char* ParseVertexRef(const char* read, const ObjData& objData, VertexRef& vertexRef) {
+        auto objIndex = 0;
+        read = ParseInt(read, objIndex);
+        vertexRef.mVertexIndex = ToZeroBasedIndex(objIndex, objData.mVertices.size());
+        vertexRef.mTextureCoordIndex = 0;
         
-        objFile >> vertexRef.mVertexIndex;
-        vertexRef.mVertexIndex--;
-        assert(vertexRef.mVertexIndex < quantities.mVertexCount);
+        // Faces without normal indices use the normal with the same index as the vertex.
+        vertexRef.mNormalIndex = vertexRef.mVertexIndex;
         
-        if (objFile.peek() == '/') {
-            objFile.get();
-            
-            if (objFile.peek() != '/') {
-                objFile >> vertexRef.mTextureCoordIndex;
-                vertexRef.mTextureCoordIndex--;
-                assert(vertexRef.mTextureCoordIndex < quantities.mTextureCoordCount);
+        if (*read == '/') {
+            ++read;
+            if (*read != '/') {
+                read = ParseInt(read, objIndex);
+                vertexRef.mTextureCoordIndex =
+                    ToZeroBasedIndex(objIndex, objData.mTextureCoords.size());
             }
             
-            if (objFile.peek() == '/') {
-                objFile.get();
-            
-                objFile >> vertexRef.mNormalIndex;
-                vertexRef.mNormalIndex--;
-                assert(vertexRef.mNormalIndex < quantities.mNormalCount);
-            } else {
-                vertexRef.mNormalIndex = vertexRef.mVertexIndex;
+            if (*read == '/') {
+                ++read;
+                read = ParseInt(read, objIndex);
+                vertexRef.mNormalIndex = ToZeroBasedIndex(objIndex, objData.mNormals.size());
             }
-        } else {
-            vertexRef.mNormalIndex = vertexRef.mVertexIndex;
         }
         
-        vertexRefs.mNewIndices.insert(std::make_pair(vertexRef, unknownIndex));
-        vertexRefs.mVertexRefVector.push_back(vertexRef);
+        return read;
     }
     
-    void ReadFaces(VertexRefs& vertexRefs,
-                   const Quantities& quantities,
-                   const std::string& filename) {
-        std::ifstream objFile {filename};
-        assert(objFile.is_open());
+    const char* ParseFace(const char* read, ObjData& objData) {
+        // Polygons with more than three vertices are split into a fan of triangles.
+        VertexRef firstVertexRef;
+        VertexRef previousVertexRef;
+        auto numVertexRefs = 0;
         
-        while (objFile) {
-            if (objFile.get() == 'f' && objFile.get() == ' ') {
-                ReadVertexIndices(vertexRefs, quantities, objFile);
-                ReadVertexIndices(vertexRefs, quantities, objFile);
-                ReadVertexIndices(vertexRefs, quantities, objFile);
+        for (;;) {
+            read = SkipSpaces(read);
+            if (!IsDigit(*read) && *read != '-') {
+                break;
             }
             
-            objFile.ignore(maxLineSize, '\n');
+            VertexRef vertexRef;
+            read = ParseVertexRef(read, objData, vertexRef);
+            
+            if (numVertexRefs == 0) {
+                firstVertexRef = vertexRef;
+            } else if (numVertexRefs >= 2) {
+                objData.mFaceVertexRefs.push_back(firstVertexRef);
+                objData.mFaceVertexRefs.push_back(previousVertexRef);
+                objData.mFaceVertexRefs.push_back(vertexRef);
+            }
+            
+            previousVertexRef = vertexRef;
+            ++numVertexRefs;
         }
+        
+        return read;
     }
     
-    void InitNormals(std::vector<Vec3>& normals, int numNormals) {
-        normals.resize(numNormals);
+    void Parse(ObjData& objData, const std::string& filename) {
+        auto buffer = ReadFile(filename);
+        const char* read = buffer.data();
         
-        for (auto& normal: normals) {
-            normal = Vec3 {0.0f, 0.0f, 0.0f};
+        // Rough estimates of the number of elements that avoid most reallocations.
+        auto estimatedNumLines = buffer.size() / 32;
+        objData.mVertices.reserve(estimatedNumLines / 4);
+        objData.mFaceVertexRefs.reserve(estimatedNumLines);
+        
+        while (*read != '\0') {
+            read = SkipSpaces(read);
+            
+            if (read[0] == 'v' && read[1] == ' ') {
+                Vec3 vertex;
+                read = ParseFloat(read + 2, vertex.x);
+                read = ParseFloat(read, vertex.y);
+                read = ParseFloat(read, vertex.z);
+                objData.mVertices.push_back(vertex);
+            } else if (read[0] == 'v' && read[1] == 't') {
+                Vec2 textureCoord;
+                read = ParseFloat(read + 2, textureCoord.x);
+                read = ParseFloat(read, textureCoord.y);
+                textureCoord.y = 1.0f - textureCoord.y;
+                objData.mTextureCoords.push_back(textureCoord);
+            } else if (read[0] == 'v' && read[1] == 'n') {
+                Vec3 normal;
+                read = ParseFloat(read + 2, normal.x);
+                read = ParseFloat(read, normal.y);
+                read = ParseFloat(read, normal.z);
+                normal.Normalize();
+                objData.mNormals.push_back(normal);
+            } else if (read[0] == 'f' && read[1] == ' ') {
+                read = ParseFace(read + 2, objData);
+            }
+            
+            read = SkipLine(read);
         }
     }
     
     void CalculateNormals(std::vector<Vec3>& normals,
                           const std::vector<Vec3>& vertices,
-                          VertexRefs& vertexRefs) {
-        InitNormals(normals, static_cast<int>(vertices.size()));
-        
-        const auto& faceVertexRefs = vertexRefs.mVertexRefVector;
+                          const std::vector<VertexRef>& faceVertexRefs) {
+        normals.assign(vertices.size(), Vec3 {0.0f, 0.0f, 0.0f});
         assert(faceVertexRefs.size() % 3 == 0);
         
         for (auto i = 0; i < faceVertexRefs.size(); ) {
@@ -238,7 +317,7 @@ namespace {
         }
     }
     
-    void MoveVerticesToOrigin(std::vector<Vec3>& vertices) {
+    Vec3 CalculateCenter(const std::vector<Vec3>& vertices) {
         auto maxVal = 32000.0f;
         auto minVal = -maxVal;
         auto xMax = minVal;
@@ -252,11 +331,11 @@ namespace {
             if (vertex.x > xMax) {
                 xMax = vertex.x;
             }
-
+            
             if (vertex.y > yMax) {
                 yMax = vertex.y;
             }
-
+            
             if (vertex.z > zMax) {
                 zMax = vertex.z;
             }
@@ -264,97 +343,118 @@ namespace {
             if (vertex.x < xMin) {
                 xMin = vertex.x;
             }
-
+            
             if (vertex.y < yMin) {
                 yMin = vertex.y;
             }
-
+            
             if (vertex.z < zMin) {
                 zMin = vertex.z;
             }
         }
         
-        Vec3 objectCenter {(xMax + xMin) / 2.0f, (yMax + yMin) / 2.0f, (zMax + zMin) / 2.0f};
-        
-        for (auto& vertex: vertices) {
-            vertex -= objectCenter;
-        }
+        return {(xMax + xMin) / 2.0f, (yMax + yMin) / 2.0f, (zMax + zMin) / 2.0f};
     }
     
-    void SetNewIndices(VertexRefs& vertexRefs) {
-        auto newIndex = 0;
-        for (auto& keyValuePair: vertexRefs.mNewIndices) {
-            keyValuePair.second = newIndex++;
+    // The key holds all attributes in the OBJ file even if some of them are not in the vertex
+    // buffer, so that the vertices are the same whatever attributes are requested, and the same as
+    // in the mesh cache files.
+    VertexKey ToVertexKey(const VertexRef& vertexRef, const ObjData& objData) {
+        auto& vertex = objData.mVertices[vertexRef.mVertexIndex];
+        auto& normal = objData.mNormals[vertexRef.mNormalIndex];
+        
+        Vec2 textureCoord {0.0f, 0.0f};
+        if (!objData.mTextureCoords.empty()) {
+            textureCoord = objData.mTextureCoords[vertexRef.mTextureCoordIndex];
         }
+        
+        return {
+            vertex.x, vertex.y, vertex.z,
+            normal.x, normal.y, normal.z,
+            textureCoord.x, textureCoord.y
+        };
     }
     
-    void WriteVertices(VertexBuffer& vertexBuffer,
-                       VertexFlags flags,
-                       const std::vector<Vec3>& vertices,
-                       const std::vector<Vec2>& textureCoords,
-                       const std::vector<Vec3>& normals,
-                       VertexRefs& vertexRefs,
-                       float scale) {
-        SetNewIndices(vertexRefs);
+    std::unique_ptr<VertexBuffer> CreateVertexBuffer(const ObjData& objData,
+                                                     VertexFlags flags,
+                                                     float scale,
+                                                     const Vec3& center) {
+        auto& faceVertexRefs = objData.mFaceVertexRefs;
+        std::vector<VertexKey> vertexKeys;
+        std::vector<uint16_t> indices(faceVertexRefs.size());
+        std::unordered_map<VertexKey, uint16_t, VertexKeyHash> vertexIndices;
+        vertexIndices.reserve(faceVertexRefs.size());
         
-        for (auto& keyValuePair: vertexRefs.mNewIndices) {
-            auto& vertexRef = keyValuePair.first;
-            vertexBuffer.Write(vertices[vertexRef.mVertexIndex] * scale,
-                               normals[vertexRef.mNormalIndex],
-                               flags.mTextureCoords ? textureCoords[vertexRef.mTextureCoordIndex] :
-                               Pht::Vec2 {});
+        for (auto i = 0; i < faceVertexRefs.size(); ++i) {
+            auto vertexKey = ToVertexKey(faceVertexRefs[i], objData);
+            auto insertion = vertexIndices.emplace(vertexKey, vertexKeys.size());
+            if (insertion.second) {
+                assert(vertexKeys.size() < maxNumVertices);
+                vertexKeys.push_back(vertexKey);
+            }
+            
+            indices[i] = insertion.first->second;
         }
         
-        for (const auto& vertexRef: vertexRefs.mVertexRefVector) {
-            auto i = vertexRefs.mNewIndices.find(vertexRef);
-            assert(i != vertexRefs.mNewIndices.end());
-            
-            vertexBuffer.AddIndex(i->second);
+        auto vertexBuffer = std::make_unique<VertexBuffer>(static_cast<int>(vertexKeys.size()),
+                                                           static_cast<int>(indices.size()),
+                                                           flags);
+        for (auto& vertexKey: vertexKeys) {
+            auto* values = vertexKey.mValues;
+            Vec3 vertex {values[0], values[1], values[2]};
+            vertexBuffer->Write((vertex - center) * scale,
+                                Vec3 {values[3], values[4], values[5]},
+                                Vec2 {values[6], values[7]});
         }
+        
+        std::memcpy(vertexBuffer->AppendIndices(static_cast<int>(indices.size())),
+                    indices.data(),
+                    indices.size() * sizeof(uint16_t));
+        return vertexBuffer;
     }
 }
 
-
 std::unique_ptr<VertexBuffer> ObjMeshLoader::Load(const std::string& filename,
                                                   VertexFlags attributeFlags,
                                                   float scale,
                                                   MoveMeshToOrigin moveMeshToOrigin) {
-    assert(attributeFlags.mNormals);
-
-    auto fullPath = FileSystem::GetResourceDirectory() + "/" + filename;
-    auto quantities = GetQuantities(fullPath);
+    auto resourceDirectory = FileSystem::GetResourceDirectory() + "/";
+    auto objPath = resourceDirectory + filename;
+    auto cachePath = resourceDirectory + MeshCache::ToCacheFilename(filename);
     
-    std::vector<Vec3> vertices(quantities.mVertexCount);
-    ReadVertices(vertices, fullPath);
+    auto vertexBuffer = MeshCache::Load(cachePath, attributeFlags, scale, moveMeshToOrigin);
     
-    if (moveMeshToOrigin == MoveMeshToOrigin::Yes) {
-        MoveVerticesToOrigin(vertices);
+    if (vertexBuffer) {
+        return vertexBuffer;
     }
     
-    std::vector<Vec2> textureCoords(quantities.mTextureCoordCount);
-    ReadTextureCoords(textureCoords, fullPath);
-    
-    std::vector<Vec3> normals(quantities.mNormalCount);
-    ReadNormals(normals, fullPath);
+    return LoadObjFile(objPath, attributeFlags, scale, moveMeshToOrigin);
+}
 
-    VertexRefs vertexRefs;
-    ReadFaces(vertexRefs, quantities, fullPath);
+std::unique_ptr<VertexBuffer> ObjMeshLoader::LoadObjFile(const std::string& fullPath,
+                                                         VertexFlags attributeFlags,
+                                                         float scale,
+                                                         MoveMeshToOrigin moveMeshToOrigin) {
+    assert(attributeFlags.mNormals);
     
-    auto vertexCount =
-        static_cast<int>(normals.empty() ? vertices.size() : vertexRefs.mNewIndices.size());
-    auto vertexBuffer = std::make_unique<VertexBuffer>(vertexCount,
-                                                       quantities.mIndexCount,
-                                                       attributeFlags);
-    if (normals.empty()) {
-        CalculateNormals(normals, vertices, vertexRefs);
+    ObjData objData;
+    Parse(objData, fullPath);
+    
+    if (objData.mNormals.empty()) {
+        CalculateNormals(objData.mNormals, objData.mVertices, objData.mFaceVertexRefs);
+    }
+    
+    // Subtracting zero keeps negative zeros, so the result is the same as not moving the mesh.
+    Vec3 center {0.0f, 0.0f, 0.0f};
+    if (moveMeshToOrigin == MoveMeshToOrigin::Yes) {
+        center = CalculateCenter(objData.mVertices);
     }
     
-    WriteVertices(*vertexBuffer,
-                  attributeFlags,
-                  vertices,
-                  textureCoords,
-                  normals,
-                  vertexRefs,
-                  scale);
-    return vertexBuffer;
+    return CreateVertexBuffer(objData, attributeFlags, scale, center);
+}
+
+Vec3 ObjMeshLoader::CalculateMeshCenter(const std::string& fullPath) {
+    ObjData objData;
+    Parse(objData, fullPath);
+    return CalculateCenter(objData.mVertices);
 }
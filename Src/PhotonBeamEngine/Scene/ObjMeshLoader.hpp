@@ -12,10 +12,17 @@ namespace Pht {
     };
     
     namespace ObjMeshLoader {
+        // Loads the converted mesh cache file of the OBJ file if there is one, otherwise the OBJ
+        // file.
         std::unique_ptr<VertexBuffer> Load(const std::string& filename,
                                            VertexFlags attributeFlags,
                                            float scale,
                                            MoveMeshToOrigin moveMeshToOrigin);
+        std::unique_ptr<VertexBuffer> LoadObjFile(const std::string& fullPath,
+                                                  VertexFlags attributeFlags,
+                                                  float scale,
+                                                  MoveMeshToOrigin moveMeshToOrigin);
+        Vec3 CalculateMeshCenter(const std::string& fullPath);
     }
 }
 
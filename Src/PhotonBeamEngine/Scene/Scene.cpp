@@ -8,6 +8,7 @@
 #include "TextComponent.hpp"
 #include "Fnv1Hash.hpp"
 #include "ISceneManager.hpp"
+#include "Profiler.hpp"
 
 using namespace Pht;
 
@@ -23,6 +24,8 @@ Scene::Scene(ISceneManager& sceneManager, Name name) :
 Scene::~Scene() {}
 
 void Scene::Update() {
+    // The zone covers the recursive update of the whole scene graph.
+    PHT_PROFILE_ZONE("SceneObject::Update");
     GetRoot().Update(false);
 }
 
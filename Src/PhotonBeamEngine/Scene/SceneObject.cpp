@@ -4,6 +4,8 @@
 
 using namespace Pht;
 
+uint32_t SceneObject::renderListVersion {0};
+
 SceneObject::SceneObject() {}
 
 SceneObject::SceneObject(Name name) :
@@ -57,19 +59,36 @@ void SceneObject::InitialUpdate(bool parentMatrixChanged) {
 }
 
 void SceneObject::AddChild(SceneObject& child) {
+    AddFrameChild(child);
+    ++renderListVersion;
+}
+
+void SceneObject::DetachChild(const SceneObject* child) {
+    if (RemoveChild(child)) {
+        ++renderListVersion;
+    }
+}
+
+void SceneObject::AddFrameChild(SceneObject& child) {
     child.mParent = this;
     mChildren.push_back(&child);
 }
 
-void SceneObject::DetachChild(const SceneObject* child) {
+void SceneObject::DetachFrameChild(const SceneObject* child) {
+    RemoveChild(child);
+}
+
+bool SceneObject::RemoveChild(const SceneObject* child) {
     for (auto i = std::begin(mChildren); i != std::end(mChildren); ++i) {
         auto* currentChild = *i;
         if (currentChild == child) {
             currentChild->mParent = nullptr;
             mChildren.erase(i);
-            break;
+            return true;
         }
     }
+    
+    return false;
 }
 
 void SceneObject::DetachChildren() {
@@ -78,6 +97,7 @@ void SceneObject::DetachChildren() {
     }
     
     mChildren.clear();
+    ++renderListVersion;
 }
 
 SceneObject* SceneObject::Find(Name name) {
@@ -97,4 +117,5 @@ SceneObject* SceneObject::Find(Name name) {
 
 void SceneObject::SetLayer(int layerIndex) {
     mLayerMask = (1 << layerIndex);
+    ++renderListVersion;
 }
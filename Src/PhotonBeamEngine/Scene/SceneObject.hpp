@@ -24,6 +24,13 @@ namespace Pht {
         void AddChild(SceneObject& child);
         void DetachChild(const SceneObject* child);
         void DetachChildren();
+        
+        // For children that are attached for the duration of a frame, such as the particle
+        // batches. These do not change the render list version, so the caller has to call
+        // InvalidateRenderLists if the children are not attached in the same places as in the
+        // last frame.
+        void AddFrameChild(SceneObject& child);
+        void DetachFrameChild(const SceneObject* child);
         SceneObject* Find(Name name);
         void SetLayer(int layerIndex);
         
@@ -94,7 +101,10 @@ namespace Pht {
         }
         
         void SetIsVisible(bool isVisible) {
-            mIsVisible = isVisible;
+            if (isVisible != mIsVisible) {
+                mIsVisible = isVisible;
+                ++renderListVersion;
+            }
         }
 
         bool IsStatic() const {
@@ -105,6 +115,10 @@ namespace Pht {
             mIsStatic = isStatic;
         }
         
+        SceneObject* GetParent() {
+            return mParent;
+        }
+        
         const std::vector<SceneObject*>& GetChildren() const {
             return mChildren;
         }
@@ -113,7 +127,21 @@ namespace Pht {
             return mLayerMask;
         }
         
+        // Incremented whenever an object is attached, detached, hidden, shown or moved to another
+        // layer, which are the changes that add or remove objects from the render lists.
+        static uint32_t GetRenderListVersion() {
+            return renderListVersion;
+        }
+        
+        static void InvalidateRenderLists() {
+            ++renderListVersion;
+        }
+        
     private:
+        bool RemoveChild(const SceneObject* child);
+        
+        static uint32_t renderListVersion;
+        
         Name mName {0};
         Transform mTransform;
         Mat4 mMatrix;
@@ -3,6 +3,7 @@
 
 #include "ISceneObjectComponent.hpp"
 #include "Font.hpp"
+#include "TextLayout.hpp"
 
 namespace Pht {
     class SceneObject;
@@ -39,10 +40,16 @@ namespace Pht {
             return mProperties;
         }
         
+        // The renderer keeps the layout of the glyphs here between frames.
+        TextLayout& GetLayout() const {
+            return mLayout;
+        }
+        
     private:
         SceneObject& mSceneObject;
         std::string mText;
         TextProperties mProperties;
+        mutable TextLayout mLayout;
     };
 }
 
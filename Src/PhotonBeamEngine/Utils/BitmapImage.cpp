@@ -1,5 +1,7 @@
 #include "BitmapImage.hpp"
 
+#include <assert.h>
+
 using namespace Pht;
 
 namespace {
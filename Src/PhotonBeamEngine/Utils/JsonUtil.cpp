@@ -79,6 +79,15 @@ float Json::ReadFloat(const rapidjson::Value& object, const std::string& name) {
     return value.GetFloat();
 }
 
+double Json::ReadDouble(const rapidjson::Value& object, const std::string& name) {
+    assert(object.HasMember(name.c_str()));
+    
+    const auto& value = object[name.c_str()];
+    assert(value.IsNumber());
+    
+    return value.GetDouble();
+}
+
 IVec2 Json::ReadIVec2(const rapidjson::Value& object, const std::string& name) {
     assert(object.HasMember(name.c_str()));
 
@@ -145,6 +154,19 @@ void Json::AddUInt64(rapidjson::Value& object,
     object.AddMember(n, v, allocator);
 }
 
+void Json::AddDouble(rapidjson::Value& object,
+                     const std::string& name,
+                     double value,
+                     rapidjson::Document::AllocatorType& allocator) {
+    rapidjson::Value v;
+    v.SetDouble(value);
+
+    rapidjson::Value n;
+    n.SetString(name.c_str(), static_cast<unsigned int>(name.size()), allocator);
+    
+    object.AddMember(n, v, allocator);
+}
+
 void Json::AddValue(rapidjson::Value& object,
                     const std::string& name,
                     rapidjson::Value& value,
@@ -18,6 +18,7 @@ namespace Pht {
         int ReadInt(const rapidjson::Value& object, const std::string& name);
         uint64_t ReadUInt64(const rapidjson::Value& object, const std::string& name);
         float ReadFloat(const rapidjson::Value& object, const std::string& name);
+        double ReadDouble(const rapidjson::Value& object, const std::string& name);
         IVec2 ReadIVec2(const rapidjson::Value& object, const std::string& name);
         void AddString(rapidjson::Value& object,
                        const std::string& name,
@@ -35,6 +36,10 @@ namespace Pht {
                        const std::string& name,
                        uint64_t value,
                        rapidjson::Document::AllocatorType& allocator);
+        void AddDouble(rapidjson::Value& object,
+                       const std::string& name,
+                       double value,
+                       rapidjson::Document::AllocatorType& allocator);
         void AddValue(rapidjson::Value& object,
                       const std::string& name,
                       rapidjson::Value& value,
@@ -0,0 +1,278 @@
+#include "Profiler.hpp"
+
+#include <mutex>
+#include <memory>
+#include <map>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+using namespace Pht;
+
+std::atomic<bool> Profiler::isEnabled {false};
+
+namespace {
+    constexpr auto ringBufferCapacity = 32768;
+    
+    using Nanoseconds = std::chrono::duration<int64_t, std::nano>;
+    
+    struct Event {
+        const char* mName;
+        int64_t mStartTime;
+        int64_t mDuration;
+        int mDepth;
+    };
+    
+    struct ThreadBuffer {
+        std::mutex mMutex;
+        std::vector<Event> mEvents;
+        int mNextIndex {0};
+        int mThreadIndex {0};
+    };
+    
+    struct TimedEvent {
+        Event mEvent;
+        int mThreadIndex;
+    };
+    
+    const Profiler::Clock::time_point originTime {Profiler::Clock::now()};
+    std::mutex threadBuffersMutex;
+    
+    // The buffers are shared with the threads so that the zones of a thread that has exited can
+    // still be exported.
+    std::vector<std::shared_ptr<ThreadBuffer>> threadBuffers;
+    thread_local std::shared_ptr<ThreadBuffer> threadBuffer;
+    thread_local int threadDepth {0};
+    
+    ThreadBuffer& GetThreadBuffer() {
+        if (threadBuffer == nullptr) {
+            threadBuffer = std::make_shared<ThreadBuffer>();
+            threadBuffer->mEvents.reserve(ringBufferCapacity);
+            
+            std::lock_guard<std::mutex> guard {threadBuffersMutex};
+            threadBuffer->mThreadIndex = static_cast<int>(threadBuffers.size());
+            threadBuffers.push_back(threadBuffer);
+        }
+        
+        return *threadBuffer;
+    }
+    
+    // Returns the recorded events of all threads ordered by start time, so that a zone comes before
+    // the zones nested in it.
+    std::vector<TimedEvent> CollectEvents() {
+        std::vector<TimedEvent> events;
+        std::lock_guard<std::mutex> guard {threadBuffersMutex};
+        
+        for (auto& buffer: threadBuffers) {
+            std::lock_guard<std::mutex> bufferGuard {buffer->mMutex};
+            for (auto& event: buffer->mEvents) {
+                events.push_back(TimedEvent {event, buffer->mThreadIndex});
+            }
+        }
+        
+        std::sort(std::begin(events),
+                  std::end(events),
+                  [] (const TimedEvent& a, const TimedEvent& b) {
+                      if (a.mEvent.mStartTime == b.mEvent.mStartTime) {
+                          return a.mEvent.mDepth < b.mEvent.mDepth;
+                      }
+                      
+                      return a.mEvent.mStartTime < b.mEvent.mStartTime;
+                  });
+        
+        return events;
+    }
+    
+    double CalculatePercentile(std::vector<double>& samples, double percentile) {
+        // Nearest-rank percentile.
+        auto rank = static_cast<int>(std::ceil(percentile / 100.0 * samples.size()));
+        auto index = std::min(std::max(rank - 1, 0), static_cast<int>(samples.size()) - 1);
+        std::nth_element(std::begin(samples), std::begin(samples) + index, std::end(samples));
+        return samples[index];
+    }
+}
+
+void Profiler::SetIsEnabled(bool enabled) {
+    isEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+void Profiler::Clear() {
+    std::lock_guard<std::mutex> guard {threadBuffersMutex};
+    
+    for (auto& buffer: threadBuffers) {
+        std::lock_guard<std::mutex> bufferGuard {buffer->mMutex};
+        buffer->mEvents.clear();
+        buffer->mNextIndex = 0;
+    }
+}
+
+int Profiler::BeginZone() {
+    return threadDepth++;
+}
+
+void Profiler::EndZone(const char* name, Clock::time_point startTime, int depth) {
+    auto endTime = Clock::now();
+    threadDepth = depth;
+    
+    Event event {
+        name,
+        std::chrono::duration_cast<Nanoseconds>(startTime - originTime).count(),
+        std::chrono::duration_cast<Nanoseconds>(endTime - startTime).count(),
+        depth
+    };
+    
+    auto& buffer = GetThreadBuffer();
+    std::lock_guard<std::mutex> guard {buffer.mMutex};
+    
+    if (static_cast<int>(buffer.mEvents.size()) < ringBufferCapacity) {
+        buffer.mEvents.push_back(event);
+    } else {
+        buffer.mEvents[buffer.mNextIndex] = event;
+        buffer.mNextIndex = (buffer.mNextIndex + 1) % ringBufferCapacity;
+    }
+}
+
+std::vector<Profiler::ZoneStatistics> Profiler::CalculateZoneStatistics() {
+    // The zones are summarized per call path, so that a zone that is nested in different parents
+    // gets a row below each of them. The children of a zone are listed in the order they are first
+    // seen.
+    struct ZoneNode {
+        std::string mName;
+        int mDepth {-1};
+        std::vector<double> mSamples;
+        std::vector<int> mChildren;
+    };
+    
+    std::vector<ZoneNode> zoneNodes(1);
+    std::map<int, std::vector<int>> threadZoneStacks;
+    
+    for (auto& timedEvent: CollectEvents()) {
+        auto& event = timedEvent.mEvent;
+        auto& zoneStack = threadZoneStacks[timedEvent.mThreadIndex];
+        
+        // The parent of the zone is the latest zone of the thread at the depth above it. The zones
+        // of the parents may have been overwritten in the ring buffer, in which case the zone is
+        // placed below the deepest zone that is left.
+        while (static_cast<int>(zoneStack.size()) > event.mDepth) {
+            zoneStack.pop_back();
+        }
+        
+        auto parentIndex = zoneStack.empty() ? 0 : zoneStack.back();
+        auto& siblings = zoneNodes[parentIndex].mChildren;
+        auto nodeIndex = -1;
+        for (auto childIndex: siblings) {
+            if (zoneNodes[childIndex].mName == event.mName) {
+                nodeIndex = childIndex;
+                break;
+            }
+        }
+        
+        if (nodeIndex == -1) {
+            nodeIndex = static_cast<int>(zoneNodes.size());
+            zoneNodes[parentIndex].mChildren.push_back(nodeIndex);
+            
+            ZoneNode zoneNode;
+            zoneNode.mName = event.mName;
+            zoneNode.mDepth = zoneNodes[parentIndex].mDepth + 1;
+            zoneNodes.push_back(zoneNode);
+        }
+        
+        zoneNodes[nodeIndex].mSamples.push_back(event.mDuration / 1000000.0);
+        zoneStack.push_back(nodeIndex);
+    }
+    
+    std::vector<ZoneStatistics> statistics;
+    std::vector<int> nodesToVisit {std::rbegin(zoneNodes[0].mChildren),
+                                   std::rend(zoneNodes[0].mChildren)};
+    
+    while (!nodesToVisit.empty()) {
+        auto& zoneNode = zoneNodes[nodesToVisit.back()];
+        nodesToVisit.pop_back();
+        nodesToVisit.insert(std::end(nodesToVisit),
+                            std::rbegin(zoneNode.mChildren),
+                            std::rend(zoneNode.mChildren));
+        
+        auto& samples = zoneNode.mSamples;
+        auto total = 0.0;
+        for (auto sample: samples) {
+            total += sample;
+        }
+        
+        ZoneStatistics zoneStatistics;
+        zoneStatistics.mName = zoneNode.mName;
+        zoneStatistics.mDepth = zoneNode.mDepth;
+        zoneStatistics.mNumSamples = static_cast<int>(samples.size());
+        zoneStatistics.mMean = total / samples.size();
+        zoneStatistics.mP50 = CalculatePercentile(samples, 50.0);
+        zoneStatistics.mP99 = CalculatePercentile(samples, 99.0);
+        statistics.push_back(zoneStatistics);
+    }
+    
+    return statistics;
+}
+
+std::string Profiler::ToZoneTable() {
+    std::string table;
+    char line[256];
+    
+    std::snprintf(line,
+                  sizeof(line),
+                  "%-40s %8s %12s %12s %12s\n",
+                  "zone",
+                  "samples",
+                  "p50",
+                  "p99",
+                  "mean");
+    table += line;
+    
+    for (auto& zone: CalculateZoneStatistics()) {
+        auto name = std::string(zone.mDepth * 2, ' ') + zone.mName;
+        std::snprintf(line,
+                      sizeof(line),
+                      "%-40s %8d %12.4f %12.4f %12.4f\n",
+                      name.c_str(),
+                      zone.mNumSamples,
+                      zone.mP50,
+                      zone.mP99,
+                      zone.mMean);
+        table += line;
+    }
+    
+    return table;
+}
+
+std::string Profiler::ToChromeTrace() {
+    std::string trace {"{\"traceEvents\":["};
+    char eventJson[256];
+    auto isFirstEvent = true;
+    
+    for (auto& timedEvent: CollectEvents()) {
+        auto& event = timedEvent.mEvent;
+        
+        // Complete events with the timestamps in microseconds.
+        std::snprintf(eventJson,
+                      sizeof(eventJson),
+                      "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                      isFirstEvent ? "" : ",",
+                      event.mName,
+                      timedEvent.mThreadIndex,
+                      event.mStartTime / 1000.0,
+                      event.mDuration / 1000.0);
+        trace += eventJson;
+        isFirstEvent = false;
+    }
+    
+    trace += "\n],\"displayTimeUnit\":\"ms\"}\n";
+    return trace;
+}
+
+bool Profiler::WriteChromeTrace(const std::string& filename) {
+    std::ofstream file {filename};
+    if (!file) {
+        return false;
+    }
+    
+    file << ToChromeTrace();
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,73 @@
+#ifndef Profiler_hpp
+#define Profiler_hpp
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace Pht {
+    // Records the duration and nesting depth of scoped zones into a ring buffer per thread. When
+    // the profiler is disabled a zone only costs a relaxed atomic load. The recorded zones can be
+    // exported as Chrome trace JSON, for chrome://tracing or Perfetto, or summarized as percentiles
+    // per zone over the zones still in the ring buffers.
+    namespace Profiler {
+        using Clock = std::chrono::steady_clock;
+        
+        struct ZoneStatistics {
+            std::string mName;
+            int mDepth {0};
+            int mNumSamples {0};
+            double mP50 {0.0};
+            double mP99 {0.0};
+            double mMean {0.0};
+        };
+        
+        extern std::atomic<bool> isEnabled;
+        
+        inline bool IsEnabled() {
+            return isEnabled.load(std::memory_order_relaxed);
+        }
+        
+        void SetIsEnabled(bool enabled);
+        void Clear();
+        int BeginZone();
+        void EndZone(const char* name, Clock::time_point startTime, int depth);
+        std::vector<ZoneStatistics> CalculateZoneStatistics();
+        std::string ToZoneTable();
+        std::string ToChromeTrace();
+        bool WriteChromeTrace(const std::string& filename);
+    }
+    
+    class ProfilerZone {
+    public:
+        explicit ProfilerZone(const char* name) :
+            mName {name} {
+            
+            if (Profiler::IsEnabled()) {
+                mDepth = Profiler::BeginZone();
+                mStartTime = Profiler::Clock::now();
+            }
+        }
+        
+        ~ProfilerZone() {
+            if (mDepth >= 0) {
+                Profiler::EndZone(mName, mStartTime, mDepth);
+            }
+        }
+        
+        ProfilerZone(const ProfilerZone&) = delete;
+        ProfilerZone& operator=(const ProfilerZone&) = delete;
+        
+    private:
+        const char* mName;
+        Profiler::Clock::time_point mStartTime;
+        int mDepth {-1};
+    };
+}
+
+#define PHT_PROFILER_CONCAT_IMPL(a, b) a##b
+#define PHT_PROFILER_CONCAT(a, b) PHT_PROFILER_CONCAT_IMPL(a, b)
+#define PHT_PROFILE_ZONE(name) Pht::ProfilerZone PHT_PROFILER_CONCAT(profilerZone, __LINE__) {name}
+
+#endif
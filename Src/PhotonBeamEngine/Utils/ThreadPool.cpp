@@ -0,0 +1,70 @@
+#include "ThreadPool.hpp"
+
+using namespace Pht;
+
+ThreadPool::ThreadPool(int numThreads) {
+    mThreads.reserve(numThreads);
+    
+    for (auto i = 0; i < numThreads; ++i) {
+        mThreads.emplace_back(&ThreadPool::ThreadMain, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> guard {mMutex};
+        mIsShuttingDown = true;
+    }
+    
+    mJobStarted.notify_all();
+    
+    for (auto& thread: mThreads) {
+        thread.join();
+    }
+}
+
+void ThreadPool::Run(const Job& job) {
+    if (mThreads.empty()) {
+        return;
+    }
+    
+    std::unique_lock<std::mutex> lock {mMutex};
+    mJob = &job;
+    mNumBusyThreads = static_cast<int>(mThreads.size());
+    ++mJobGeneration;
+    mJobStarted.notify_all();
+    
+    mJobFinished.wait(lock, [this] () { return mNumBusyThreads == 0; });
+    mJob = nullptr;
+}
+
+void ThreadPool::ThreadMain(int threadIndex) {
+    auto handledJobGeneration = 0;
+    
+    for (;;) {
+        const Job* job {nullptr};
+        
+        {
+            std::unique_lock<std::mutex> lock {mMutex};
+            mJobStarted.wait(lock, [&] () {
+                return mIsShuttingDown || mJobGeneration != handledJobGeneration;
+            });
+            
+            if (mIsShuttingDown) {
+                return;
+            }
+            
+            handledJobGeneration = mJobGeneration;
+            job = mJob;
+        }
+        
+        (*job)(threadIndex);
+        
+        {
+            std::lock_guard<std::mutex> guard {mMutex};
+            --mNumBusyThreads;
+        }
+        
+        mJobFinished.notify_one();
+    }
+}
@@ -0,0 +1,41 @@
+#ifndef ThreadPool_hpp
+#define ThreadPool_hpp
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+#include "Noncopyable.hpp"
+
+namespace Pht {
+    class ThreadPool: public Noncopyable {
+    public:
+        using Job = std::function<void(int threadIndex)>;
+        
+        explicit ThreadPool(int numThreads);
+        ~ThreadPool();
+        
+        // Runs the job once on each thread in the pool and returns when all of them are done.
+        void Run(const Job& job);
+        
+        int GetNumThreads() const {
+            return static_cast<int>(mThreads.size());
+        }
+        
+    private:
+        void ThreadMain(int threadIndex);
+        
+        std::vector<std::thread> mThreads;
+        std::mutex mMutex;
+        std::condition_variable mJobStarted;
+        std::condition_variable mJobFinished;
+        const Job* mJob {nullptr};
+        int mJobGeneration {0};
+        int mNumBusyThreads {0};
+        bool mIsShuttingDown {false};
+    };
+}
+
+#endif
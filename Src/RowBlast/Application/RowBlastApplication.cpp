@@ -7,6 +7,7 @@
 #include "IAudio.hpp"
 #include "ISceneManager.hpp"
 #include "IAnalytics.hpp"
+#include "Profiler.hpp"
 
 // Game includes.
 #include "UiLayer.hpp"
@@ -103,6 +104,8 @@ void RowBlastApplication::SetUpAudio() {
 }
 
 void RowBlastApplication::OnUpdate() {
+    PHT_PROFILE_ZONE("RowBlastApplication::OnUpdate");
+    
     if (mState == State::MapScene) {
         mUserServices.Update();
     }
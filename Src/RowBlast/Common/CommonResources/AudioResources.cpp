@@ -1,5 +1,7 @@
 #include "AudioResources.hpp"
 
+#include <assert.h>
+
 // Engine includes.
 #include "IEngine.hpp"
 #include "IAudio.hpp"
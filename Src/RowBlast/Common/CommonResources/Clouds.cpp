@@ -7,6 +7,7 @@
 #include "IEngine.hpp"
 #include "MathUtils.hpp"
 #include "Scene.hpp"
+#include "ISceneManager.hpp"
 #include "SceneObject.hpp"
 #include "QuadMesh.hpp"
 #include "Material.hpp"
@@ -136,6 +137,8 @@ Clouds::Clouds(Pht::IEngine& engine,
         assert(false);
     }
 
+    auto& sceneManager = engine.GetSceneManager();
+
     for (auto& volume: mPathVolumes) {
         std::normal_distribution<float> xDistribution {0.0, volume.mClusterSize.x / 4.0f};
         std::normal_distribution<float> yDistribution {0.0, volume.mClusterSize.y / 4.0f};
@@ -189,8 +192,14 @@ Clouds::Clouds(Pht::IEngine& engine,
                 {{-halfX, halfY, 0.0f}, cloudColor, textureUV->mTopLeft},
             };
 
-            auto& cloudSceneObject =
-                scene.CreateSceneObject(Pht::QuadMesh {cloudVertices}, cloudMaterial);
+            // The clouds keep their vertices on the CPU side as well so that the renderer can
+            // batch them dynamically.
+            auto cloudRenderable =
+                sceneManager.CreateBatchableRenderableObject(Pht::QuadMesh {cloudVertices},
+                                                             cloudMaterial);
+            auto& cloudSceneObject = scene.CreateSceneObject();
+            cloudSceneObject.SetRenderable(cloudRenderable.get());
+            scene.AddRenderableObject(std::move(cloudRenderable));
             sceneObject.AddChild(cloudSceneObject);
             cloudSceneObject.GetTransform().SetPosition(cloudPosition);
 
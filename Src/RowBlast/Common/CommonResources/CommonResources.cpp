@@ -18,23 +18,24 @@ CommonResources::CommonResources(Pht::IEngine& engine) {
     auto& renderer = engine.GetRenderer();
     auto& sceneManager = engine.GetSceneManager();
     
+    // All the fonts share the glyph atlas of the distance field font.
     sceneManager.InitSceneSystems(Pht::ISceneManager::defaultNarrowFrustumHeightFactor);
     mHussarFontSize20 = std::make_unique<Pht::Font>("HussarBoldWeb.otf",
-                                                    renderer.GetAdjustedNumPixels(20));
-    mHussarFontSize27 = std::make_unique<Pht::Font>("HussarBoldWeb.otf",
-                                                    renderer.GetAdjustedNumPixels(27));
-    mHussarFontSize35 = std::make_unique<Pht::Font>("HussarBoldWeb.otf",
-                                                    renderer.GetAdjustedNumPixels(35));
+                                                    renderer.GetAdjustedNumPixels(20),
+                                                    Pht::DistanceField::Yes);
+    auto& font = *mHussarFontSize20;
+    mHussarFontSize27 = std::make_unique<Pht::Font>(font, renderer.GetAdjustedNumPixels(27));
+    mHussarFontSize35 = std::make_unique<Pht::Font>(font, renderer.GetAdjustedNumPixels(35));
     
     sceneManager.InitSceneSystems(CommonResources::narrowFrustumHeightFactor);
-    mHussarFontSize20PotentiallyZoomedScreen = std::make_unique<Pht::Font>("HussarBoldWeb.otf",
-                                                                           renderer.GetAdjustedNumPixels(20));
-    mHussarFontSize27PotentiallyZoomedScreen = std::make_unique<Pht::Font>("HussarBoldWeb.otf",
-                                                                           renderer.GetAdjustedNumPixels(27));
-    mHussarFontSize35PotentiallyZoomedScreen = std::make_unique<Pht::Font>("HussarBoldWeb.otf",
-                                                                           renderer.GetAdjustedNumPixels(35));
-    mHussarFontSize52PotentiallyZoomedScreen = std::make_unique<Pht::Font>("HussarBoldWeb.otf",
-                                                                           renderer.GetAdjustedNumPixels(52));
+    mHussarFontSize20PotentiallyZoomedScreen =
+        std::make_unique<Pht::Font>(font, renderer.GetAdjustedNumPixels(20));
+    mHussarFontSize27PotentiallyZoomedScreen =
+        std::make_unique<Pht::Font>(font, renderer.GetAdjustedNumPixels(27));
+    mHussarFontSize35PotentiallyZoomedScreen =
+        std::make_unique<Pht::Font>(font, renderer.GetAdjustedNumPixels(35));
+    mHussarFontSize52PotentiallyZoomedScreen =
+        std::make_unique<Pht::Font>(font, renderer.GetAdjustedNumPixels(52));
 
     mOrthographicFrustumSizePotentiallyZoomedScreen = renderer.GetOrthographicFrustumSize();
     mHudFrustumSizePotentiallyZoomedScreen = renderer.GetHudFrustumSize();
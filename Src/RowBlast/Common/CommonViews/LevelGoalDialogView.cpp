@@ -1,5 +1,7 @@
 #include "LevelGoalDialogView.hpp"
 
+#include <limits>
+
 // Engine includes.
 #include "TextComponent.hpp"
 #include "IEngine.hpp"
@@ -161,8 +163,8 @@ void LevelGoalDialogView::CreateGlowEffectsBehindPieces(Pht::SceneObject& parent
         .mZAngularVelocity = 00.0f,
         .mSize = Pht::Vec2{15.0f, 15.0f},
         .mSizeRandomPart = 0.0f,
-        .mShrinkDuration = 0.0f,
-        .mGrowDuration = 0.75f
+        .mGrowDuration = 0.75f,
+        .mShrinkDuration = 0.0f
     };
     
     auto& particleSystem = mEngine.GetParticleSystem();
@@ -187,8 +189,8 @@ void LevelGoalDialogView::CreateGlowEffectsBehindPieces(Pht::SceneObject& parent
         .mZAngularVelocity = 20.0f,
         .mSize = Pht::Vec2{22.0f, 22.0f},
         .mSizeRandomPart = 0.0f,
-        .mShrinkDuration = 0.0f,
-        .mGrowDuration = 0.2f
+        .mGrowDuration = 0.2f,
+        .mShrinkDuration = 0.0f
     };
     
     mRoundGlowEffect = particleSystem.CreateParticleEffectSceneObject(particleSettings2,
@@ -349,8 +351,8 @@ void LevelGoalDialogView::CreateGlowEffectsBehindGoal(Pht::SceneObject& parentOb
         .mZAngularVelocityRandomPart = 10.0f,
         .mSize = Pht::Vec2{11.25f, 11.25f},
         .mSizeRandomPart = 0.0f,
-        .mShrinkDuration = 0.0f,
-        .mGrowDuration = 0.5f
+        .mGrowDuration = 0.5f,
+        .mShrinkDuration = 0.0f
     };
     
     auto& particleSystem = mEngine.GetParticleSystem();
@@ -1,5 +1,7 @@
 #include "NoLivesDialogView.hpp"
 
+#include <cstring>
+
 // Engine includes.
 #include "IEngine.hpp"
 #include "TextComponent.hpp"
@@ -177,8 +179,8 @@ void NoLivesDialogView::CreateGlowEffect(Pht::SceneObject& parentObject, float s
         .mZAngularVelocityRandomPart = 10.0f,
         .mSize = Pht::Vec2{11.25f, 11.25f},
         .mSizeRandomPart = 0.0f,
-        .mShrinkDuration = 0.0f,
-        .mGrowDuration = 0.5f
+        .mGrowDuration = 0.5f,
+        .mShrinkDuration = 0.0f
     };
     
     auto& particleSystem = mEngine.GetParticleSystem();
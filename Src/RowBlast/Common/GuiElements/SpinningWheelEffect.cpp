@@ -1,5 +1,7 @@
 #include "SpinningWheelEffect.hpp"
 
+#include <limits>
+
 // Engine includes.
 #include "IEngine.hpp"
 #include "ParticleEffect.hpp"
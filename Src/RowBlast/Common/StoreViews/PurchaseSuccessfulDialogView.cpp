@@ -1,5 +1,7 @@
 #include "PurchaseSuccessfulDialogView.hpp"
 
+#include <limits>
+
 // Engine includes.
 #include "IEngine.hpp"
 #include "ObjMesh.hpp"
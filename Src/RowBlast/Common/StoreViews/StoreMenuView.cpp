@@ -1,5 +1,7 @@
 #include "StoreMenuView.hpp"
 
+#include <algorithm>
+
 // Engine includes.
 #include "IEngine.hpp"
 #include "ISceneManager.hpp"
@@ -379,8 +381,8 @@ void StoreMenuView::CreateGlowEffect(Pht::IEngine& engine,
         .mZAngularVelocityRandomPart = 10.0f,
         .mSize = size,
         .mSizeRandomPart = 0.0f,
-        .mShrinkDuration = 0.0f,
-        .mGrowDuration = 0.1f
+        .mGrowDuration = 0.1f,
+        .mShrinkDuration = 0.0f
     };
     
     auto& particleSystem = engine.GetParticleSystem();
@@ -1,5 +1,7 @@
 #include "PurchasingService.hpp"
 
+#include <algorithm>
+
 // Engine includes.
 #include "IEngine.hpp"
 #include "JsonUtil.hpp"
@@ -1,5 +1,6 @@
 #include "StringUtils.hpp"
 
+#include <cstring>
 #include <cstdio>
 #include <string>
 
@@ -1,6 +1,7 @@
 #ifndef StringUtils_hpp
 #define StringUtils_hpp
 
+#include <string>
 #include <array>
 #include <chrono>
 #include <assert.h>
@@ -8,19 +8,19 @@ using namespace RowBlast;
 namespace {
     constexpr auto scaleSpeed = 3.2f;
     
-    bool IsSubCellOrNeighbourBouncing(const SubCell& subCell, const Cell& neighbour) {
-        auto subCellIsBouncing =
-            subCell.mFallingBlockAnimation.mState == FallingBlockAnimationComponent::State::Bouncing;
-
-        auto neighbourIsBouncing =
-            neighbour.mFirstSubCell.mFallingBlockAnimation.mState == FallingBlockAnimationComponent::State::Bouncing ||
-            neighbour.mSecondSubCell.mFallingBlockAnimation.mState == FallingBlockAnimationComponent::State::Bouncing;
+    bool IsSubCellBouncing(const SubCellAnimations& subCell) {
+        return subCell.mFallingBlockAnimation.mState == FallingBlockAnimationComponent::State::Bouncing;
+    }
 
-        return subCellIsBouncing || neighbourIsBouncing;
+    bool IsSubCellOrNeighbourBouncing(const SubCellAnimations& subCell,
+                                      const CellAnimations& neighbour) {
+        return IsSubCellBouncing(subCell) || IsSubCellBouncing(neighbour.mFirstSubCell) ||
+               IsSubCellBouncing(neighbour.mSecondSubCell);
     }
     
-    bool IsSubCellBouncing(const SubCell& subCell) {
-        return subCell.mFallingBlockAnimation.mState == FallingBlockAnimationComponent::State::Bouncing;
+    bool IsCellFlashing(const CellAnimations& cell) {
+        return cell.mFirstSubCell.mFlashingBlockAnimation.IsActive() ||
+               cell.mSecondSubCell.mFlashingBlockAnimation.IsActive();
     }
 }
 
@@ -36,31 +36,28 @@ void BondsAnimationSystem::Update(float dt) {
             }
             
             Pht::IVec2 position {column, row};
+            auto& cellAnimations = mField.GetCellAnimations(row, column);
             
-            AnimateBlockBonds(cell.mFirstSubCell, position, dt);
-            AnimateBlockBonds(cell.mSecondSubCell, position, dt);
+            AnimateBlockBonds(cellAnimations.mFirstSubCell, position, dt);
+            AnimateBlockBonds(cellAnimations.mSecondSubCell, position, dt);
             
-            auto& diagonalAnimation = cell.mSecondSubCell.mBondAnimations.mDiagonal;
-            if (diagonalAnimation.IsActive() && !IsSubCellBouncing(cell.mFirstSubCell) &&
-                !IsSubCellBouncing(cell.mSecondSubCell)) {
+            auto& diagonalAnimation = cellAnimations.mSecondSubCell.mBondAnimations.mDiagonal;
+            if (diagonalAnimation.IsActive() && !IsSubCellBouncing(cellAnimations.mFirstSubCell) &&
+                !IsSubCellBouncing(cellAnimations.mSecondSubCell)) {
                 
                 if (diagonalAnimation.mState == BondAnimation::State::BondAtFullScale) {
                     diagonalAnimation.mState = BondAnimation::State::Inactive;
                     mField.MergeTriangleBlocksIntoCube(position);
                     mField.SetChanged();
                 } else {
-                    auto cellIsFlashing =
-                        cell.mFirstSubCell.mFlashingBlockAnimation.IsActive() ||
-                        cell.mSecondSubCell.mFlashingBlockAnimation.IsActive();
-                    
-                    AnimateBond(diagonalAnimation, cellIsFlashing, false, dt);
+                    AnimateBond(diagonalAnimation, IsCellFlashing(cellAnimations), false, dt);
                 }
             }
         }
     }
 }
 
-void BondsAnimationSystem::AnimateBlockBonds(SubCell& subCell,
+void BondsAnimationSystem::AnimateBlockBonds(SubCellAnimations& subCell,
                                              const Pht::IVec2& position,
                                              float dt) {
     auto& animations = subCell.mBondAnimations;
@@ -76,14 +73,14 @@ void BondsAnimationSystem::AnimateBlockBonds(SubCell& subCell,
     auto isThisOrUpLeftBouncing = false;
     
     if (position.y + 1 < mField.GetNumRows() && position.x + 1 < mField.GetNumColumns()) {
-        auto& upperRightCell = mField.GetCell(position + Pht::IVec2{1, 1});
+        auto& upperRightCell = mField.GetCellAnimations(position.y + 1, position.x + 1);
         isThisOrUpRightBouncing = IsSubCellOrNeighbourBouncing(subCell, upperRightCell);
     } else {
         isThisOrUpRightBouncing = IsSubCellBouncing(subCell);
     }
 
     if (position.y + 1 < mField.GetNumRows() && position.x - 1 >= 0) {
-        auto& upperLeftCell = mField.GetCell(position + Pht::IVec2{-1, 1});
+        auto& upperLeftCell = mField.GetCellAnimations(position.y + 1, position.x - 1);
         isThisOrUpLeftBouncing = IsSubCellOrNeighbourBouncing(subCell, upperLeftCell);
     } else {
         isThisOrUpLeftBouncing = IsSubCellBouncing(subCell);
@@ -93,18 +90,16 @@ void BondsAnimationSystem::AnimateBlockBonds(SubCell& subCell,
     AnimateBond(animations.mUpLeft, false, isThisOrUpLeftBouncing, dt);
 }
 
-void BondsAnimationSystem::AnimateUpBond(SubCell& subCell, const Pht::IVec2& position, float dt) {
+void BondsAnimationSystem::AnimateUpBond(SubCellAnimations& subCell,
+                                         const Pht::IVec2& position,
+                                         float dt) {
     auto subCellIsFlashing = subCell.mFlashingBlockAnimation.IsActive();
     
     if (position.y + 1 < mField.GetNumRows()) {
-        auto& upperCell = mField.GetCell(position + Pht::IVec2{0, 1});
-
-        auto upperCellIsFlashing =
-            upperCell.mFirstSubCell.mFlashingBlockAnimation.IsActive() ||
-            upperCell.mSecondSubCell.mFlashingBlockAnimation.IsActive();
+        auto& upperCell = mField.GetCellAnimations(position.y + 1, position.x);
         
         AnimateBond(subCell.mBondAnimations.mUp,
-                    subCellIsFlashing || upperCellIsFlashing,
+                    subCellIsFlashing || IsCellFlashing(upperCell),
                     IsSubCellOrNeighbourBouncing(subCell, upperCell),
                     dt);
     } else {
@@ -112,20 +107,16 @@ void BondsAnimationSystem::AnimateUpBond(SubCell& subCell, const Pht::IVec2& pos
     }
 }
 
-void BondsAnimationSystem::AnimateRightBond(SubCell& subCell,
+void BondsAnimationSystem::AnimateRightBond(SubCellAnimations& subCell,
                                             const Pht::IVec2& position,
                                             float dt) {
     auto subCellIsFlashing = subCell.mFlashingBlockAnimation.IsActive();
     
     if (position.x + 1 < mField.GetNumColumns()) {
-        auto& cellToTheRight = mField.GetCell(position + Pht::IVec2{1, 0});
-        
-        auto cellToTheRightIsFlashing =
-            cellToTheRight.mFirstSubCell.mFlashingBlockAnimation.IsActive() ||
-            cellToTheRight.mSecondSubCell.mFlashingBlockAnimation.IsActive();
+        auto& cellToTheRight = mField.GetCellAnimations(position.y, position.x + 1);
         
         AnimateBond(subCell.mBondAnimations.mRight,
-                    subCellIsFlashing || cellToTheRightIsFlashing,
+                    subCellIsFlashing || IsCellFlashing(cellToTheRight),
                     IsSubCellOrNeighbourBouncing(subCell, cellToTheRight),
                     dt);
     } else {
@@ -6,7 +6,7 @@
 
 namespace RowBlast {
     class Field;
-    class SubCell;
+    struct SubCellAnimations;
     class BondAnimation;
     
     class BondsAnimationSystem {
@@ -19,9 +19,9 @@ namespace RowBlast {
         static void StartBondDisappearingAnimation(BondAnimation& animation);
         
     private:
-        void AnimateBlockBonds(SubCell& subCell, const Pht::IVec2& position, float dt);
-        void AnimateUpBond(SubCell& subCell, const Pht::IVec2& position, float dt);
-        void AnimateRightBond(SubCell& subCell, const Pht::IVec2& position, float dt);
+        void AnimateBlockBonds(SubCellAnimations& subCell, const Pht::IVec2& position, float dt);
+        void AnimateUpBond(SubCellAnimations& subCell, const Pht::IVec2& position, float dt);
+        void AnimateRightBond(SubCellAnimations& subCell, const Pht::IVec2& position, float dt);
         void AnimateBondAppearing(BondAnimation& animation, float dt);
         void AnimateBondDisappearing(BondAnimation& animation, float dt);
         void AnimateBond(BondAnimation& animation, bool cellIsFlashing, bool anyBouncing, float dt);
@@ -13,10 +13,12 @@ namespace {
     constexpr auto fallingStateFixedTimeStep = 0.016f;
     constexpr auto bouncingStateFixedTimeStep = 0.002f;
     
-    void UpdateBlockWhileTouchingSpring(SubCell& subCell, int row, float dt) {
+    void UpdateBlockWhileTouchingSpring(SubCell& subCell,
+                                        FallingBlockAnimationComponent& animation,
+                                        int row,
+                                        float dt) {
         auto springBoundry = static_cast<float>(row);
         auto& blockPosition = subCell.mPosition;
-        auto& animation = subCell.mFallingBlockAnimation;
         auto springDisplacement = springBoundry - blockPosition.y;
         
         auto acceleration =
@@ -36,15 +38,16 @@ namespace {
         }
     }
 
-    void UpdateBlockInBouncingStateFixedTimeStep(SubCell& subCell, int row, float dt) {
+    void UpdateBlockInBouncingStateFixedTimeStep(SubCell& subCell,
+                                                 FallingBlockAnimationComponent& animation,
+                                                 int row,
+                                                 float dt) {
         auto springBoundry = static_cast<float>(row);
         auto& blockPosition = subCell.mPosition;
 
         if (blockPosition.y <= springBoundry) {
-            UpdateBlockWhileTouchingSpring(subCell, row, dt);
+            UpdateBlockWhileTouchingSpring(subCell, animation, row, dt);
         } else {
-            auto& animation = subCell.mFallingBlockAnimation;
-            
             animation.mVelocity += gravitationalAcceleration * dt;
             blockPosition.y += animation.mVelocity * dt;
         
@@ -55,9 +58,12 @@ namespace {
         }
     }
     
-    void UpdateBlockInBouncingState(SubCell& subCell, int row, float frameDuration) {
+    void UpdateBlockInBouncingState(SubCell& subCell,
+                                    FallingBlockAnimationComponent& animation,
+                                    int row,
+                                    float frameDuration) {
         if (frameDuration <= bouncingStateFixedTimeStep) {
-            UpdateBlockInBouncingStateFixedTimeStep(subCell, row, frameDuration);
+            UpdateBlockInBouncingStateFixedTimeStep(subCell, animation, row, frameDuration);
             return;
         }
         
@@ -68,25 +74,27 @@ namespace {
                 frameTimeLeft > bouncingStateFixedTimeStep ? bouncingStateFixedTimeStep :
                 frameTimeLeft;
             
-            UpdateBlockInBouncingStateFixedTimeStep(subCell, row, timeStep);
+            UpdateBlockInBouncingStateFixedTimeStep(subCell, animation, row, timeStep);
             frameTimeLeft -= bouncingStateFixedTimeStep;
             
             if (frameTimeLeft <= 0.0f ||
-                subCell.mFallingBlockAnimation.mState == FallingBlockAnimationComponent::State::Inactive) {
+                animation.mState == FallingBlockAnimationComponent::State::Inactive) {
                 break;
             }
         }
     }
 
-    void UpdateBlockInFallingStateFixedTimeStep(SubCell& subCell, int row, float dt) {
+    void UpdateBlockInFallingStateFixedTimeStep(SubCell& subCell,
+                                                FallingBlockAnimationComponent& animation,
+                                                int row,
+                                                float dt) {
         auto& blockPosition = subCell.mPosition;
-        auto& animation = subCell.mFallingBlockAnimation;
         auto newVelocity = gravitationalAcceleration * dt + animation.mVelocity;
         auto dy = newVelocity * dt;
         auto newYPosition = blockPosition.y + dy;
         
         if (newYPosition < row) {
-            if (animation.mShouldBounce) {
+            if (subCell.mShouldBounce) {
                 animation.mState = FallingBlockAnimationComponent::State::Bouncing;
                 
                 auto springBoundry = static_cast<float>(row);
@@ -95,7 +103,7 @@ namespace {
                 
                 auto frameTimeTouchingSpring = dt * (springBoundry - newYPosition) / -dy;
                 blockPosition.y = row;
-                UpdateBlockInBouncingState(subCell, row, frameTimeTouchingSpring);
+                UpdateBlockInBouncingState(subCell, animation, row, frameTimeTouchingSpring);
             } else {
                 blockPosition.y = row;
                 animation = FallingBlockAnimationComponent {};
@@ -106,9 +114,12 @@ namespace {
         }
     }
 
-    void UpdateBlockInFallingState(SubCell& subCell, int row, float frameDuration) {
+    void UpdateBlockInFallingState(SubCell& subCell,
+                                   FallingBlockAnimationComponent& animation,
+                                   int row,
+                                   float frameDuration) {
         if (frameDuration <= fallingStateFixedTimeStep) {
-            UpdateBlockInFallingStateFixedTimeStep(subCell, row, frameDuration);
+            UpdateBlockInFallingStateFixedTimeStep(subCell, animation, row, frameDuration);
             return;
         }
         
@@ -119,40 +130,43 @@ namespace {
                 frameTimeLeft > fallingStateFixedTimeStep ? fallingStateFixedTimeStep :
                 frameTimeLeft;
             
-            UpdateBlockInFallingStateFixedTimeStep(subCell, row, timeStep);
+            UpdateBlockInFallingStateFixedTimeStep(subCell, animation, row, timeStep);
             frameTimeLeft -= fallingStateFixedTimeStep;
             
             if (frameTimeLeft <= 0.0f ||
-                subCell.mFallingBlockAnimation.mState == FallingBlockAnimationComponent::State::Inactive) {
+                animation.mState == FallingBlockAnimationComponent::State::Inactive) {
                 break;
-            } else if (subCell.mFallingBlockAnimation.mState == FallingBlockAnimationComponent::State::Bouncing) {
-                UpdateBlockInBouncingState(subCell, row, frameTimeLeft);
+            } else if (animation.mState == FallingBlockAnimationComponent::State::Bouncing) {
+                UpdateBlockInBouncingState(subCell, animation, row, frameTimeLeft);
                 break;
             }
         }
     }
 
-    FallingBlockAnimationComponent::State UpdateBlock(SubCell& subCell, int row, float dt) {
-        switch (subCell.mFallingBlockAnimation.mState) {
+    FallingBlockAnimationComponent::State UpdateBlock(SubCell& subCell,
+                                                      FallingBlockAnimationComponent& animation,
+                                                      int row,
+                                                      float dt) {
+        switch (animation.mState) {
             case FallingBlockAnimationComponent::State::Falling:
-                UpdateBlockInFallingState(subCell, row, dt);
+                UpdateBlockInFallingState(subCell, animation, row, dt);
                 break;
             case FallingBlockAnimationComponent::State::Bouncing:
-                UpdateBlockInBouncingState(subCell, row, dt);
+                UpdateBlockInBouncingState(subCell, animation, row, dt);
                 break;
             case FallingBlockAnimationComponent::State::Inactive:
                 if (subCell.mPosition.y > row) {
-                    subCell.mFallingBlockAnimation.mState = FallingBlockAnimationComponent::State::Falling;
+                    animation.mState = FallingBlockAnimationComponent::State::Falling;
                 }
                 break;
         }
         
-        return subCell.mFallingBlockAnimation.mState;
+        return animation.mState;
     }
     
-    void TransitionWronglyBouncingBlockToFalling(SubCell& subCell, int row) {
-        auto& animation = subCell.mFallingBlockAnimation;
-        
+    void TransitionWronglyBouncingBlockToFalling(const SubCell& subCell,
+                                                 FallingBlockAnimationComponent& animation,
+                                                 int row) {
         if (animation.mState == FallingBlockAnimationComponent::State::Bouncing &&
             animation.mVelocity == FallingBlockAnimationComponent::fallingPieceBounceVelocity &&
             subCell.mPosition.y - static_cast<float>(row) >= 1.0f) {
@@ -201,7 +215,11 @@ void CollapsingFieldAnimationSystem::UpdateInActiveState(float dt) {
                 continue;
             }
             
-            switch (UpdateBlock(cell.mFirstSubCell, row, dt)) {
+            auto& cellAnimations = mField.GetCellAnimations(row, column);
+            auto& firstAnimation = cellAnimations.mFirstSubCell.mFallingBlockAnimation;
+            auto& secondAnimation = cellAnimations.mSecondSubCell.mFallingBlockAnimation;
+            
+            switch (UpdateBlock(cell.mFirstSubCell, firstAnimation, row, dt)) {
                 case FallingBlockAnimationComponent::State::Falling:
                     anyFallingBlocks = true;
                     break;
@@ -212,7 +230,7 @@ void CollapsingFieldAnimationSystem::UpdateInActiveState(float dt) {
                     break;
             }
 
-            switch (UpdateBlock(cell.mSecondSubCell, row, dt)) {
+            switch (UpdateBlock(cell.mSecondSubCell, secondAnimation, row, dt)) {
                 case FallingBlockAnimationComponent::State::Falling:
                     anyFallingBlocks = true;
                     break;
@@ -260,9 +278,9 @@ void CollapsingFieldAnimationSystem::GoToWaitingState() {
 void CollapsingFieldAnimationSystem::ResetBlockAnimations() {
     for (auto row = 0; row < mField.GetNumRows(); ++row) {
         for (auto column = 0; column < mField.GetNumColumns(); ++column) {
-            auto& cell = mField.GetCell(row, column);
-            cell.mFirstSubCell.mFallingBlockAnimation = FallingBlockAnimationComponent {};
-            cell.mSecondSubCell.mFallingBlockAnimation = FallingBlockAnimationComponent {};
+            auto& animations = mField.GetCellAnimations(row, column);
+            animations.mFirstSubCell.mFallingBlockAnimation = FallingBlockAnimationComponent {};
+            animations.mSecondSubCell.mFallingBlockAnimation = FallingBlockAnimationComponent {};
         }
     }
 }
@@ -271,8 +289,11 @@ void CollapsingFieldAnimationSystem::TransitionWronglyBouncingBlocksToFalling()
     for (auto row = 0; row < mField.GetNumRows(); ++row) {
         for (auto column = 0; column < mField.GetNumColumns(); ++column) {
             auto& cell = mField.GetCell(row, column);
-            TransitionWronglyBouncingBlockToFalling(cell.mFirstSubCell, row);
-            TransitionWronglyBouncingBlockToFalling(cell.mSecondSubCell, row);
+            auto& cellAnimations = mField.GetCellAnimations(row, column);
+            auto& firstAnimation = cellAnimations.mFirstSubCell.mFallingBlockAnimation;
+            auto& secondAnimation = cellAnimations.mSecondSubCell.mFallingBlockAnimation;
+            TransitionWronglyBouncingBlockToFalling(cell.mFirstSubCell, firstAnimation, row);
+            TransitionWronglyBouncingBlockToFalling(cell.mSecondSubCell, secondAnimation, row);
         }
     }
 }
@@ -66,7 +66,8 @@ void FlashingBlocksAnimationSystem::UpdateInWaitingState() {
 }
 
 void FlashingBlocksAnimationSystem::ActivateWaitingBlock(SubCell& subCell, int row, int column) {
-    auto& flashingBlockAnimation = subCell.mFlashingBlockAnimation;
+    auto& flashingBlockAnimation =
+        mField.GetAnimations(row, column, subCell).mFlashingBlockAnimation;
     if (flashingBlockAnimation.mState == FlashingBlockAnimationComponent::State::Waiting) {
         if (mState == State::Waiting) {
             mState = State::Active;
@@ -112,9 +113,9 @@ void FlashingBlocksAnimationSystem::UpdateFlash(float dt) {
 void FlashingBlocksAnimationSystem::ResetFlashingBlockAnimations() {
     for (auto row = 0; row < mField.GetNumRows(); ++row) {
         for (auto column = 0; column < mField.GetNumColumns(); ++column) {
-            auto& cell = mField.GetCell(row, column);
-            cell.mFirstSubCell.mFlashingBlockAnimation = FlashingBlockAnimationComponent {};
-            cell.mSecondSubCell.mFlashingBlockAnimation = FlashingBlockAnimationComponent {};
+            auto& animations = mField.GetCellAnimations(row, column);
+            animations.mFirstSubCell.mFlashingBlockAnimation = FlashingBlockAnimationComponent {};
+            animations.mSecondSubCell.mFlashingBlockAnimation = FlashingBlockAnimationComponent {};
         }
     }
 }
@@ -121,9 +121,9 @@ void LaserParticleEffect::CreateParticles(Pht::IEngine& engine) {
     Pht::EmitterSettings particleEmitterSettings {
         .mPosition = Pht::Vec3{0.0f, 0.0f, 0.0f},
         .mSize = Pht::Vec3{22.0f, 1.0f, 0.0f},
-        .mBurst = 50,
         .mTimeToLive = 0.4f,
-        .mFrequency = 10.0f
+        .mFrequency = 10.0f,
+        .mBurst = 50
     };
     
     Pht::ParticleSettings particleSettings {
@@ -1,5 +1,10 @@
 #include "Ai.hpp"
 
+#include <algorithm>
+
+// Engine includes.
+#include "Profiler.hpp"
+
 // Game includes.
 #include "FallingPiece.hpp"
 #include "DraggedPiece.hpp"
@@ -7,6 +12,18 @@
 using namespace RowBlast;
 
 namespace {
+    constexpr auto maxNumWorkers = 4;
+    constexpr auto minNumMovesPerWorker = 16;
+    
+    int CalculateNumWorkers() {
+        auto numHardwareThreads = static_cast<int>(std::thread::hardware_concurrency());
+        if (numHardwareThreads <= 1) {
+            return 0;
+        }
+        
+        return std::min(numHardwareThreads, maxNumWorkers);
+    }
+
     bool CompareMoves(const Move* a, const Move* b) {
         return a->mScore > b->mScore;
     }
@@ -25,17 +42,49 @@ namespace {
     }
 }
 
+Ai::Worker::Worker() :
+    mMoveEvaluator {mField} {}
+
 Ai::Ai(Field& field) :
     mField {field},
-    mFieldAnalyzer {field},
-    mValidMovesSearch {field} {}
+    mMoveEvaluator {field},
+    mValidMovesSearch {field, ValidMovesSearch::UseCache::Yes},
+    mLookaheadSearch {field} {
+    
+    auto numWorkers = CalculateNumWorkers();
+    
+    for (auto i = 0; i < numWorkers; ++i) {
+        mWorkers.push_back(std::make_unique<Worker>());
+    }
+    
+    mThreadPool = std::make_unique<Pht::ThreadPool>(numWorkers);
+}
 
 void Ai::Init(const Level& level) {
     mLevel = &level;
+    mMoveEvaluator.Init(level);
     mValidMovesSearch.Init();
+    mLookaheadSearch.Init(level);
+    
+    for (auto& worker: mWorkers) {
+        worker->mField.Init(level);
+        worker->mMoveEvaluator.Init(level);
+    }
 }
 
-Ai::MovePtrs& Ai::CalculateMoves(const FallingPiece& fallingPiece, int movesUsed) {
+void Ai::SetEvaluationMode(EvaluationMode evaluationMode) {
+    mEvaluationMode = evaluationMode;
+}
+
+void Ai::SetLookaheadSettings(const LookaheadSearch::Settings& settings) {
+    mLookaheadSearch.SetSettings(settings);
+}
+
+Ai::MovePtrs& Ai::CalculateMoves(const FallingPiece& fallingPiece,
+                                 int movesUsed,
+                                 const TwoPieces* nextPieces) {
+    PHT_PROFILE_ZONE("Ai::CalculateMoves");
+    
     mValidMoves.Clear();
     
     MovingPiece piece {
@@ -51,6 +100,11 @@ Ai::MovePtrs& Ai::CalculateMoves(const FallingPiece& fallingPiece, int movesUsed
     EvaluateMoves(fallingPiece, movesUsed);
     SortMoves();
     
+    // Tutorial moves have fixed scores, so the lookahead must not reorder them.
+    if (nextPieces && predeterminedMove == nullptr && suggestedMoves == nullptr) {
+        mLookaheadSearch.ReorderMoves(mSortedMoves, fallingPiece, *nextPieces);
+    }
+    
     return mSortedMoves;
 }
 
@@ -91,15 +145,54 @@ const std::vector<Level::TutorialMove>* Ai::GetSuggestedMoves(const FallingPiece
 }
 
 void Ai::EvaluateMoves(const FallingPiece& fallingPiece, int movesUsed) {
-    auto& pieceType = fallingPiece.GetPieceType();
-    auto pieceId = fallingPiece.GetId();
-    auto pieceNumRows = pieceType.GetGridNumRows();
-    auto pieceNumcolumns = pieceType.GetGridNumColumns();
-    auto& moves = mValidMoves.mMoves;
-    auto numMoves = moves.Size();
+    auto numMoves = mValidMoves.mMoves.Size();
     auto* suggestedTutorialMoves = GetSuggestedMoves(fallingPiece, movesUsed);
     
-    for (auto i = 0; i < numMoves; ++i) {
+    if (mEvaluationMode == EvaluationMode::Parallel && !mWorkers.empty() &&
+        numMoves >= 2 * minNumMovesPerWorker) {
+
+        EvaluateMovesInParallel(fallingPiece, suggestedTutorialMoves);
+    } else {
+        EvaluateMoveRange(mMoveEvaluator, 0, numMoves, fallingPiece, suggestedTutorialMoves);
+    }
+}
+
+void Ai::EvaluateMovesInParallel(const FallingPiece& fallingPiece,
+                                 const std::vector<Level::TutorialMove>* suggestedTutorialMoves) {
+    auto numMoves = mValidMoves.mMoves.Size();
+    auto numWorkers = std::min(static_cast<int>(mWorkers.size()), numMoves / minNumMovesPerWorker);
+    auto numMovesPerWorker = (numMoves + numWorkers - 1) / numWorkers;
+    
+    for (auto i = 0; i < numWorkers; ++i) {
+        mWorkers[i]->mField.CopyCellsFrom(mField);
+    }
+    
+    // Each worker lands the moves in its own copy of the field and writes the scores into its own
+    // range of moves, so the result is the same as when evaluating serially.
+    mThreadPool->Run([&] (int threadIndex) {
+        if (threadIndex >= numWorkers) {
+            return;
+        }
+        
+        auto begin = threadIndex * numMovesPerWorker;
+        auto end = std::min(begin + numMovesPerWorker, numMoves);
+        
+        EvaluateMoveRange(mWorkers[threadIndex]->mMoveEvaluator,
+                          begin,
+                          end,
+                          fallingPiece,
+                          suggestedTutorialMoves);
+    });
+}
+
+void Ai::EvaluateMoveRange(MoveEvaluator& moveEvaluator,
+                           int begin,
+                           int end,
+                           const FallingPiece& fallingPiece,
+                           const std::vector<Level::TutorialMove>* suggestedTutorialMoves) {
+    auto& moves = mValidMoves.mMoves;
+    
+    for (auto i = begin; i < end; ++i) {
         auto& move = moves.At(i);
         
         auto* suggestedTutorialMove =
@@ -109,102 +202,11 @@ void Ai::EvaluateMoves(const FallingPiece& fallingPiece, int movesUsed) {
             assert(suggestedTutorialMove->mScore.HasValue());
             move.mScore = suggestedTutorialMove->mScore.GetValue();
         } else {
-            PieceBlocks pieceBlocks {
-                pieceType.GetGrid(move.mRotation),
-                pieceNumRows,
-                pieceNumcolumns
-            };
-            
-            mField.LandPieceBlocks(pieceBlocks, pieceId, move.mPosition, false, false, false);
-            EvaluateMove(move, fallingPiece);
-            mField.RemovePiece(pieceId, move.mPosition, pieceNumRows, pieceNumcolumns);
+            moveEvaluator.EvaluateMove(move, fallingPiece);
         }
     }
 }
 
-void Ai::EvaluateMove(Move& move, const FallingPiece& fallingPiece) {
-    switch (mLevel->GetObjective()) {
-        case Level::Objective::Clear:
-            EvaluateMoveForClearObjective(move, fallingPiece);
-            break;
-        case Level::Objective::BringDownTheAsteroid:
-            EvaluateMoveForAsteroidObjective(move, fallingPiece);
-            break;
-        case Level::Objective::Build:
-            EvaluateMoveForBuildObjective(move, fallingPiece);
-            break;
-    }
-}
-
-void Ai::EvaluateMoveForClearObjective(Move& move, const FallingPiece& fallingPiece) {
-    auto landingHeight =
-        static_cast<float>(move.mPosition.y - mField.GetLowestVisibleRow()) +
-        fallingPiece.GetPieceType().GetCenterPosition(move.mRotation).y;
-
-    auto filledRowsResult = mField.MarkFilledRowsAndCountGrayLevelCellsInFilledRows();
-    auto numFilledRows = filledRowsResult.mFilledRowIndices.Size();
-    auto burriedHolesArea = CalculateBurriedHolesArea(numFilledRows, fallingPiece);
-    auto wellsArea = mFieldAnalyzer.CalculateWellsAreaInVisibleRows();
-    auto numTransitions = static_cast<float>(mFieldAnalyzer.CalculateNumTransitionsInVisibleRows());
-    
-    move.mScore = -landingHeight
-                  + 2.0f * numFilledRows
-                  + filledRowsResult.mGrayLevelCellsInFilledRows
-                  - 4.1f * burriedHolesArea
-                  - 0.6f * wellsArea
-                  - 0.6f * numTransitions;
-
-    mField.UnmarkFilledRows(filledRowsResult.mFilledRowIndices);
-}
-
-float Ai::CalculateBurriedHolesArea(int numFilledRows, const FallingPiece& fallingPiece) {
-    if (numFilledRows == 0) {
-        return mFieldAnalyzer.CalculateBurriedHolesAreaInVisibleRows();
-    }
-    
-    return mFieldAnalyzer.CalculateBurriedHolesAreaInVisibleRowsWithGravity(fallingPiece.GetId());
-}
-
-void Ai::EvaluateMoveForAsteroidObjective(Move& move, const FallingPiece& fallingPiece) {
-    auto landingHeight =
-        static_cast<float>(move.mPosition.y - mField.GetLowestVisibleRow()) +
-        fallingPiece.GetPieceType().GetCenterPosition(move.mRotation).y;
-
-    auto filledRowsResult =
-        mField.MarkFilledRowsAndCountPieceCellsInFilledRows(fallingPiece.GetId());
-    
-    auto numFilledRows = filledRowsResult.mFilledRowIndices.Size();
-    auto burriedHolesArea = CalculateBurriedHolesArea(numFilledRows, fallingPiece);
-    auto wellsArea = mFieldAnalyzer.CalculateWellsAreaInVisibleRows();
-    auto numTransitions = static_cast<float>(mFieldAnalyzer.CalculateNumTransitionsInVisibleRows());
-    
-    move.mScore = -landingHeight
-                  + 2.0f * numFilledRows
-                  + filledRowsResult.mPieceCellsInFilledRows
-                  - 4.1f * burriedHolesArea
-                  - 0.6f * wellsArea
-                  - 0.6f * numTransitions;
-    
-    mField.UnmarkFilledRows(filledRowsResult.mFilledRowIndices);
-}
-
-void Ai::EvaluateMoveForBuildObjective(Move& move, const FallingPiece& fallingPiece) {
-    auto landingHeight =
-        static_cast<float>(move.mPosition.y - mField.GetLowestVisibleRow()) +
-        fallingPiece.GetPieceType().GetCenterPosition(move.mRotation).y;
-    
-    auto numCellsAccordingToBlueprint =
-        static_cast<float>(mFieldAnalyzer.CalculateNumCellsAccordingToBlueprintInVisibleRows());
-
-    auto buildHolesArea = mFieldAnalyzer.CalculateBuildHolesAreaInVisibleRows();
-    auto buildWellsArea = mFieldAnalyzer.CalculateBuildWellsAreaInVisibleRows();
-    
-    move.mScore = -landingHeight
-                  + 2.0f * numCellsAccordingToBlueprint
-                  - 4.0f * buildHolesArea
-                  - 0.25f * buildWellsArea;
-}
-
 void Ai::SortMoves() {
     mSortedMoves.Clear();
     
@@ -1,9 +1,16 @@
 #ifndef Ai_hpp
 #define Ai_hpp
 
+#include <memory>
+#include <vector>
+
+// Engine includes.
+#include "ThreadPool.hpp"
+
 // Game includes.
 #include "ValidMovesSearch.hpp"
-#include "FieldAnalyzer.hpp"
+#include "MoveEvaluator.hpp"
+#include "LookaheadSearch.hpp"
 #include "Field.hpp"
 #include "Level.hpp"
 
@@ -14,30 +21,52 @@ namespace RowBlast {
     
     class Ai {
     public:
-        using MovePtrs = Pht::StaticVector<Move*, Field::maxNumColumns * Field::maxNumRows * 4>;
+        using MovePtrs = RowBlast::MovePtrs;
+        
+        enum class EvaluationMode {
+            Serial,
+            Parallel
+        };
         
         explicit Ai(Field& field);
         
         void Init(const Level& level);
-        MovePtrs& CalculateMoves(const FallingPiece& fallingPiece, int movesUsed);
+        void SetEvaluationMode(EvaluationMode evaluationMode);
+        void SetLookaheadSettings(const LookaheadSearch::Settings& settings);
+        MovePtrs& CalculateMoves(const FallingPiece& fallingPiece,
+                                 int movesUsed,
+                                 const TwoPieces* nextPieces = nullptr);
         ValidMoves& FindValidMoves(const FallingPiece& fallingPiece, int movesUsed);
         
     private:
+        struct Worker {
+            Worker();
+            
+            Field mField;
+            MoveEvaluator mMoveEvaluator;
+        };
+        
         const Level::TutorialMove* GetPredeterminedMove(const FallingPiece& fallingPiece,
                                                         int movesUsed);
         const std::vector<Level::TutorialMove>* GetSuggestedMoves(const FallingPiece& fallingPiece,
                                                                   int movesUsed);
         void EvaluateMoves(const FallingPiece& fallingPiece, int movesUsed);
-        void EvaluateMove(Move& move, const FallingPiece& fallingPiece);
-        void EvaluateMoveForClearObjective(Move& move, const FallingPiece& fallingPiece);
-        void EvaluateMoveForAsteroidObjective(Move& move, const FallingPiece& fallingPiece);
-        void EvaluateMoveForBuildObjective(Move& move, const FallingPiece& fallingPiece);
-        float CalculateBurriedHolesArea(int numFilledRows, const FallingPiece& fallingPiece);
+        void EvaluateMovesInParallel(const FallingPiece& fallingPiece,
+                                     const std::vector<Level::TutorialMove>* suggestedTutorialMoves);
+        void EvaluateMoveRange(MoveEvaluator& moveEvaluator,
+                               int begin,
+                               int end,
+                               const FallingPiece& fallingPiece,
+                               const std::vector<Level::TutorialMove>* suggestedTutorialMoves);
         void SortMoves();
         
         Field& mField;
-        FieldAnalyzer mFieldAnalyzer;
+        MoveEvaluator mMoveEvaluator;
         ValidMovesSearch mValidMovesSearch;
+        LookaheadSearch mLookaheadSearch;
+        EvaluationMode mEvaluationMode {EvaluationMode::Parallel};
+        std::vector<std::unique_ptr<Worker>> mWorkers;
+        std::unique_ptr<Pht::ThreadPool> mThreadPool;
         const Level* mLevel {nullptr};
         ValidMoves mValidMoves;
         ValidMoves mUpdatedValidMoves;
@@ -94,59 +94,39 @@ FieldAnalyzer::FieldAnalyzer(const Field& field) :
     mField {field} {}
 
 float FieldAnalyzer::CalculateBurriedHolesAreaInVisibleRows() const {
-    auto area = 0.0f;
-    auto numColumns = mField.GetNumColumns();
+    auto& bitboard = mField.mBitboard;
     auto lowestVisibleRow = mField.GetLowestVisibleRow();
+    auto highestRow = lowestVisibleRow + mField.GetNumRowsInOneScreen() - 1;
+    auto highestOccupiedRow = bitboard.CalculateHighestOccupiedRow();
     
-    for (auto column = 0; column < numColumns; ++column) {
-        auto aboveIsFilled = false;
-        
-        for (auto row = lowestVisibleRow + mField.GetNumRowsInOneScreen() - 1;
-             row >= lowestVisibleRow;
-             --row) {
-            auto& cell = mField.mGrid[row][column];
-            if (cell.mIsInFilledRow) {
-                continue;
-            }
-            
-            if (cell.IsEmpty()) {
-                if (aboveIsFilled) {
-                    area += 1.0f;
-                }
-                
-                continue;
-            }
-            
-            if (cell.IsFull()) {
-                aboveIsFilled = true;
-                continue;
-            }
-            
-            auto fill =
-                cell.mSecondSubCell.IsEmpty() ? cell.mFirstSubCell.mFill : cell.mSecondSubCell.mFill;
-            
-            switch (fill) {
-                case Fill::UpperLeftHalf:
-                case Fill::UpperRightHalf:
-                    area += 1.0f;
-                    break;
-                case Fill::LowerLeftHalf:
-                case Fill::LowerRightHalf:
-                    if (aboveIsFilled) {
-                        area += 1.0f;
-                    }
-                    break;
-                case Fill::Empty:
-                case Fill::Full:
-                    assert(false);
-                    break;
-            }
-            
-            aboveIsFilled = true;
+    // The rows above the highest block are empty and do not contribute to the area.
+    if (highestRow > highestOccupiedRow) {
+        highestRow = highestOccupiedRow;
+    }
+    
+    // The columns are scanned from the top in parallel, one bit per column.
+    auto area = 0;
+    auto aboveIsFilled = 0u;
+    
+    for (auto row = highestRow; row >= lowestVisibleRow; --row) {
+        if (IsInFilledRow(row)) {
+            continue;
         }
+        
+        auto& bitboardRow = bitboard.GetRow(row);
+        auto halfCells = bitboardRow.mOccupied & ~bitboardRow.mFull;
+        auto upperHalfCells = halfCells & (bitboardRow.GetFillMask(Fill::UpperLeftHalf) |
+                                           bitboardRow.GetFillMask(Fill::UpperRightHalf));
+        auto lowerHalfCells = halfCells & (bitboardRow.GetFillMask(Fill::LowerLeftHalf) |
+                                           bitboardRow.GetFillMask(Fill::LowerRightHalf));
+        
+        area += CountBits(bitboard.GetEmpty(row) & aboveIsFilled) + CountBits(upperHalfCells) +
+                CountBits(lowerHalfCells & aboveIsFilled);
+        
+        aboveIsFilled |= bitboardRow.mOccupied;
     }
     
-    return area;
+    return static_cast<float>(area);
 }
 
 float FieldAnalyzer::CalculateBurriedHolesAreaInVisibleRowsWithGravity(int landedPieceId) const {
@@ -243,34 +223,25 @@ float FieldAnalyzer::CalculateBurriedHolesAreaInVisibleRowsWithGravity(int lande
 }
 
 float FieldAnalyzer::CalculateWellsAreaInVisibleRows() const {
-    auto area = 0.0f;
+    auto& bitboard = mField.mBitboard;
     auto lowestVisibleRow = mField.GetLowestVisibleRow();
     auto pastHighestVisibleRow = lowestVisibleRow + mField.GetNumRowsInOneScreen();
-    auto numColumns = mField.GetNumColumns();
+    auto area = 0;
     
-    for (auto column = 0; column < numColumns; ++column) {
-        auto leftColumnIndex = column - 1;
-        auto rightColumnIndex = column + 1;
-        
-        for (auto row = lowestVisibleRow; row < pastHighestVisibleRow; ++row) {
-            auto& cell = mField.mGrid[row][column];
-            if (!cell.IsEmpty() || cell.mIsInFilledRow) {
-                continue;
-            }
-            
-            auto leftIsEmpty =
-                leftColumnIndex >= 0 ? mField.mGrid[row][leftColumnIndex].IsEmpty() : false;
-            
-            auto rightIsEmpty =
-                rightColumnIndex < numColumns ? mField.mGrid[row][rightColumnIndex].IsEmpty() : false;
-            
-            if (!leftIsEmpty && !rightIsEmpty) {
-                area += 1.0f;
-            }
+    for (auto row = lowestVisibleRow; row < pastHighestVisibleRow; ++row) {
+        if (IsInFilledRow(row)) {
+            continue;
         }
+        
+        // The field walls count as non-empty neighbours.
+        auto empty = static_cast<unsigned int>(bitboard.GetEmpty(row));
+        auto leftIsNotEmpty = ~(empty << 1);
+        auto rightIsNotEmpty = ~(empty >> 1);
+        
+        area += CountBits(empty & leftIsNotEmpty & rightIsNotEmpty);
     }
     
-    return area;
+    return static_cast<float>(area);
 }
 
 int FieldAnalyzer::CalculateNumTransitionsInVisibleRows() const {
@@ -278,65 +249,52 @@ int FieldAnalyzer::CalculateNumTransitionsInVisibleRows() const {
 }
 
 int FieldAnalyzer::CalculateNumTransitionsInColumns() const {
-    auto numTransitions = 0;
+    auto& bitboard = mField.mBitboard;
     auto lowestVisibleRow = mField.GetLowestVisibleRow();
     auto pastHighestVisibleRow = lowestVisibleRow + mField.GetNumRowsInOneScreen();
-    auto numColumns = mField.GetNumColumns();
+    auto numTransitions = 0;
+    auto previousCellIsEmpty = 0u;
     
-    for (auto column = 0; column < numColumns; ++column) {
-        auto previousCellIsEmpty = false;
-        
-        for (auto row = lowestVisibleRow; row < pastHighestVisibleRow - 1; ++row) {
-            auto& cell = mField.mGrid[row][column];
-            if (cell.mIsInFilledRow) {
-                continue;
-            }
-            
-            auto thisCellIsEmpty = cell.IsEmpty();
-            if (thisCellIsEmpty != previousCellIsEmpty) {
-                ++numTransitions;
-            }
-            
-            previousCellIsEmpty = thisCellIsEmpty;
+    for (auto row = lowestVisibleRow; row < pastHighestVisibleRow - 1; ++row) {
+        if (IsInFilledRow(row)) {
+            continue;
         }
+        
+        auto thisCellIsEmpty = static_cast<unsigned int>(bitboard.GetEmpty(row));
+        numTransitions += CountBits(thisCellIsEmpty ^ previousCellIsEmpty);
+        previousCellIsEmpty = thisCellIsEmpty;
     }
     
     return numTransitions;
 }
 
 int FieldAnalyzer::CalculateNumTransitionsInRows() const {
-    auto numTransitions = 0;
+    auto& bitboard = mField.mBitboard;
     auto lowestVisibleRow = mField.GetLowestVisibleRow();
     auto pastHighestVisibleRow = lowestVisibleRow + mField.GetNumRowsInOneScreen();
-    auto numColumns = mField.GetNumColumns();
+    auto lastColumn = mField.GetNumColumns() - 1;
+    auto innerColumnsMask = (1u << lastColumn) - 1u;
+    auto numTransitions = 0;
     
     for (auto row = lowestVisibleRow; row < pastHighestVisibleRow; ++row) {
-        if (mField.mGrid[row][0].mIsInFilledRow) {
+        if (IsInFilledRow(row)) {
             continue;
         }
         
-        for (auto column = 0; column < numColumns - 1; ++column) {
-            auto thisCellIsEmpty = mField.mGrid[row][column].IsEmpty();
-            auto nextCellIsEmpty = mField.mGrid[row][column + 1].IsEmpty();
-            if (thisCellIsEmpty != nextCellIsEmpty) {
-                ++numTransitions;
-            }
-        }
-        
-        auto leftCellIsEmpty = mField.mGrid[row][0].IsEmpty();
-        if (leftCellIsEmpty) {
-            ++numTransitions;
-        }
+        auto empty = static_cast<unsigned int>(bitboard.GetEmpty(row));
         
-        auto rightCellIsEmpty = mField.mGrid[row][numColumns - 1].IsEmpty();
-        if (rightCellIsEmpty) {
-            ++numTransitions;
-        }
+        // Transitions between neighbouring cells and between the walls and empty edge cells.
+        numTransitions += CountBits((empty ^ (empty >> 1)) & innerColumnsMask) + (empty & 1u) +
+                          ((empty >> lastColumn) & 1u);
     }
     
     return numTransitions;
 }
 
+bool FieldAnalyzer::IsInFilledRow(int row) const {
+    return mField.mGrid[row][0].mIsInFilledRow;
+}
+
 int FieldAnalyzer::CalculateNumCellsAccordingToBlueprintInVisibleRows() const {
     assert(mField.mBlueprintGrid);
     
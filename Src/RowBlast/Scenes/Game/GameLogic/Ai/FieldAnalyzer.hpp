@@ -19,6 +19,7 @@ namespace RowBlast {
     private:
         int CalculateNumTransitionsInColumns() const;
         int CalculateNumTransitionsInRows() const;
+        bool IsInFilledRow(int row) const;
         
         const Field& mField;
     };
@@ -0,0 +1,242 @@
+#include "LookaheadSearch.hpp"
+
+#include <algorithm>
+#include <limits>
+
+// Game includes.
+#include "Level.hpp"
+
+using namespace RowBlast;
+
+namespace {
+    constexpr auto maxDepth = 2;
+    
+    bool CompareMoves(const Move* a, const Move* b) {
+        return a->mScore > b->mScore;
+    }
+}
+
+LookaheadSearch::Ply::Ply() :
+    mFieldGravity {mField},
+    mValidMovesSearch {mField, ValidMovesSearch::UseCache::No},
+    mMoveEvaluator {mField} {}
+
+LookaheadSearch::LookaheadSearch(const Field& field) :
+    mField {field} {
+    
+    for (auto i = 0; i < maxDepth; ++i) {
+        mPlies.push_back(std::make_unique<Ply>());
+    }
+}
+
+void LookaheadSearch::Init(const Level& level) {
+    mLevel = &level;
+    
+    for (auto& ply: mPlies) {
+        ply->mField.Init(level);
+        ply->mFieldGravity.Init();
+        ply->mValidMovesSearch.Init();
+        ply->mMoveEvaluator.Init(level);
+    }
+}
+
+void LookaheadSearch::SetSettings(const Settings& settings) {
+    mSettings = settings;
+    mSettings.mDepth = std::min(mSettings.mDepth, maxDepth);
+}
+
+void LookaheadSearch::ReorderMoves(MovePtrs& sortedMoves,
+                                   const FallingPiece& fallingPiece,
+                                   const TwoPieces& nextPieces) {
+    if (mSettings.mDepth <= 0 || sortedMoves.Size() < 2) {
+        return;
+    }
+    
+    auto timeBudget = std::chrono::duration<float, std::milli> {mSettings.mTimeBudgetMs};
+    mDeadline = Clock::now() + std::chrono::duration_cast<Clock::duration>(timeBudget);
+    mIsOutOfTime = false;
+    mSpawnPosition = fallingPiece.GetIntPosition();
+    mSpawnPieceNumRows = fallingPiece.GetPieceType().GetGridNumRows();
+    mPieceId = fallingPiece.GetId();
+    mScoredMoves.clear();
+    
+    auto& firstPly = *mPlies.front();
+    auto numCandidates = std::min(mSettings.mBeamWidth, sortedMoves.Size());
+    
+    for (auto i = 0; i < numCandidates; ++i) {
+        if (IsOutOfTime()) {
+            break;
+        }
+        
+        auto* move = sortedMoves.At(i);
+        
+        firstPly.mField.CopyCellsFrom(mField);
+        ApplyMove(firstPly, *move, fallingPiece);
+        
+        auto followUpScore = CalculateBestFollowUpScore(0, nextPieces);
+        if (mIsOutOfTime) {
+            break;
+        }
+        
+        auto score = move->mScore + mSettings.mFollowUpWeight * followUpScore;
+        mScoredMoves.push_back(ScoredMove {move, score});
+    }
+    
+    // Only the candidates that were fully searched are reordered. They were the best ones before the
+    // lookahead so they stay in front of the rest of the moves.
+    std::stable_sort(mScoredMoves.begin(),
+                     mScoredMoves.end(),
+                     [] (const ScoredMove& a, const ScoredMove& b) { return a.mScore > b.mScore; });
+    
+    for (auto i = 0; i < mScoredMoves.size(); ++i) {
+        sortedMoves.At(i) = mScoredMoves[i].mMove;
+    }
+}
+
+void LookaheadSearch::ApplyMove(Ply& ply, const Move& move, const FallingPiece& fallingPiece) {
+    auto& pieceType = fallingPiece.GetPieceType();
+    
+    PieceBlocks pieceBlocks {
+        pieceType.GetGrid(move.mRotation),
+        pieceType.GetGridNumRows(),
+        pieceType.GetGridNumColumns(),
+        &pieceType.GetBitmask(move.mRotation)
+    };
+    
+    auto& field = ply.mField;
+    field.LandPieceBlocks(pieceBlocks, fallingPiece.GetId(), move.mPosition, false, false, false);
+    
+    if (mLevel->GetObjective() == Level::Objective::Build) {
+        return;
+    }
+    
+    while (field.RemoveFilledRowsWithoutAnimation() > 0) {
+        ply.mFieldGravity.PullDownLoosePieces();
+    }
+}
+
+float LookaheadSearch::CalculateBestFollowUpScore(int plyIndex, const TwoPieces& remainingPieces) {
+    auto bestScore = 0.0f;
+    auto anyPieceSearched = false;
+    
+    for (auto i = 0; i < remainingPieces.size(); ++i) {
+        auto* pieceType = remainingPieces[i];
+        if (pieceType == nullptr || pieceType->IsBomb() || pieceType->IsRowBomb() ||
+            (i > 0 && pieceType == remainingPieces[0])) {
+
+            continue;
+        }
+        
+        // The player can choose which of the remaining pieces to place next, so the best one is
+        // used.
+        auto piecesLeft = remainingPieces;
+        piecesLeft[i] = nullptr;
+        
+        auto score = CalculateBestFollowUpScore(plyIndex, *pieceType, piecesLeft);
+        if (mIsOutOfTime) {
+            return 0.0f;
+        }
+        
+        if (!anyPieceSearched || score > bestScore) {
+            bestScore = score;
+            anyPieceSearched = true;
+        }
+    }
+    
+    return bestScore;
+}
+
+float LookaheadSearch::CalculateBestFollowUpScore(int plyIndex,
+                                                  const Piece& pieceType,
+                                                  const TwoPieces& remainingPieces) {
+    if (IsOutOfTime()) {
+        return 0.0f;
+    }
+    
+    auto& ply = *mPlies[plyIndex];
+    ply.mFallingPiece.SetId(mPieceId + plyIndex + 1);
+    FindAndEvaluateMoves(ply, pieceType);
+    
+    auto& sortedMoves = ply.mSortedMoves;
+    if (mIsOutOfTime || sortedMoves.IsEmpty()) {
+        return 0.0f;
+    }
+    
+    auto nextPlyIndex = plyIndex + 1;
+    auto anyPiecesLeft = remainingPieces[0] || remainingPieces[1];
+    
+    if (nextPlyIndex >= mSettings.mDepth || !anyPiecesLeft) {
+        return sortedMoves.Front()->mScore;
+    }
+    
+    auto& nextPly = *mPlies[nextPlyIndex];
+    auto bestScore = std::numeric_limits<float>::lowest();
+    auto numCandidates = std::min(mSettings.mBeamWidth, sortedMoves.Size());
+    
+    for (auto i = 0; i < numCandidates; ++i) {
+        if (IsOutOfTime()) {
+            return 0.0f;
+        }
+        
+        auto& move = *sortedMoves.At(i);
+        
+        nextPly.mField.CopyCellsFrom(ply.mField);
+        ApplyMove(nextPly, move, ply.mFallingPiece);
+        
+        auto followUpScore = CalculateBestFollowUpScore(nextPlyIndex, remainingPieces);
+        if (mIsOutOfTime) {
+            return 0.0f;
+        }
+        
+        bestScore = std::max(bestScore, move.mScore + mSettings.mFollowUpWeight * followUpScore);
+    }
+    
+    return bestScore;
+}
+
+void LookaheadSearch::FindAndEvaluateMoves(Ply& ply, const Piece& pieceType) {
+    auto rotation = pieceType.GetSpawnRotation();
+    
+    Pht::IVec2 spawnPosition {
+        mField.GetNumColumns() / 2 - pieceType.GetGridNumColumns() / 2,
+        mSpawnPosition.y + mSpawnPieceNumRows - pieceType.GetGridNumRows()
+    };
+    
+    Pht::Vec2 fallingPiecePosition {
+        static_cast<float>(spawnPosition.x) + 0.5f,
+        static_cast<float>(spawnPosition.y)
+    };
+    
+    ply.mFallingPiece.Spawn(pieceType, fallingPiecePosition, rotation, 0.0f);
+    
+    MovingPiece piece {spawnPosition, rotation, pieceType};
+    
+    ply.mValidMoves.Clear();
+    ply.mValidMovesSearch.FindValidMoves(ply.mValidMoves, piece, nullptr, nullptr);
+    
+    auto& moves = ply.mValidMoves.mMoves;
+    auto& sortedMoves = ply.mSortedMoves;
+    sortedMoves.Clear();
+    
+    // A ply can have hundreds of moves to evaluate, so the deadline is checked for every move
+    // and not only between the plies.
+    for (auto i = 0; i < moves.Size(); ++i) {
+        if (IsOutOfTime()) {
+            return;
+        }
+        
+        auto& move = moves.At(i);
+        ply.mMoveEvaluator.EvaluateMove(move, ply.mFallingPiece);
+        sortedMoves.PushBack(&move);
+    }
+    
+    sortedMoves.Sort(CompareMoves);
+}
+
+bool LookaheadSearch::IsOutOfTime() {
+    if (!mIsOutOfTime && Clock::now() > mDeadline) {
+        mIsOutOfTime = true;
+    }
+    
+    return mIsOutOfTime;
+}
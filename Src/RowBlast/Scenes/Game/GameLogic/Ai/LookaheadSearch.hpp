@@ -0,0 +1,84 @@
+#ifndef LookaheadSearch_hpp
+#define LookaheadSearch_hpp
+
+#include <memory>
+#include <vector>
+#include <chrono>
+
+// Game includes.
+#include "MoveDefinitions.hpp"
+#include "MoveEvaluator.hpp"
+#include "ValidMovesSearch.hpp"
+#include "FieldGravitySystem.hpp"
+#include "FallingPiece.hpp"
+#include "NextPieceGenerator.hpp"
+
+namespace RowBlast {
+    class Level;
+    
+    // Reorders the best moves of the current piece by also considering how well the next pieces can
+    // be placed afterwards. The next pieces are placed in scratch fields that are not animated and
+    // the search is a beam search that stops when the time budget is used up.
+    class LookaheadSearch {
+    public:
+        struct Settings {
+            int mDepth {2};
+            int mBeamWidth {4};
+            float mFollowUpWeight {0.5f};
+            float mTimeBudgetMs {8.0f};
+        };
+        
+        explicit LookaheadSearch(const Field& field);
+        
+        void Init(const Level& level);
+        void SetSettings(const Settings& settings);
+        void ReorderMoves(MovePtrs& sortedMoves,
+                          const FallingPiece& fallingPiece,
+                          const TwoPieces& nextPieces);
+        
+        const Settings& GetSettings() const {
+            return mSettings;
+        }
+        
+    private:
+        using Clock = std::chrono::steady_clock;
+        
+        struct Ply {
+            Ply();
+            
+            Field mField;
+            FieldGravitySystem mFieldGravity;
+            ValidMovesSearch mValidMovesSearch;
+            MoveEvaluator mMoveEvaluator;
+            FallingPiece mFallingPiece;
+            ValidMoves mValidMoves;
+            MovePtrs mSortedMoves;
+        };
+        
+        struct ScoredMove {
+            Move* mMove {nullptr};
+            float mScore {0.0f};
+        };
+        
+        void ApplyMove(Ply& ply, const Move& move, const FallingPiece& fallingPiece);
+        float CalculateBestFollowUpScore(int plyIndex, const TwoPieces& remainingPieces);
+        float CalculateBestFollowUpScore(int plyIndex,
+                                         const Piece& pieceType,
+                                         const TwoPieces& remainingPieces);
+        void FindAndEvaluateMoves(Ply& ply, const Piece& pieceType);
+        bool IsOutOfTime();
+        
+        const Field& mField;
+        const Level* mLevel {nullptr};
+        Settings mSettings;
+        std::vector<std::unique_ptr<Ply>> mPlies;
+        std::vector<ScoredMove> mScoredMoves;
+        Pht::IVec2 mSpawnPosition;
+        int mSpawnPieceNumRows {0};
+        int mPieceId {0};
+        Clock::time_point mDeadline;
+        bool mIsOutOfTime {false};
+    };
+}
+
+#endif
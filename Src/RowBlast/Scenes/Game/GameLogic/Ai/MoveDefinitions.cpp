@@ -2,6 +2,16 @@
 
 using namespace RowBlast;
 
+namespace {
+    const Movement* Rebase(const Movement* movement, const Movements& from, const Movements& to) {
+        if (movement == nullptr) {
+            return nullptr;
+        }
+        
+        return to.begin() + (movement - from.begin());
+    }
+}
+
 Movement::Movement(const Pht::Vec2& position, Rotation rotation, const Movement* previous) :
     mPosition {position},
     mRotation {rotation},
@@ -30,3 +40,22 @@ void ValidMoves::Clear() {
     mMoves.Clear();
     mMovements.Clear();
 }
+
+void ValidMoves::CopyFrom(const ValidMoves& other) {
+    Clear();
+    
+    // The movements point to each other and the moves point to the movements, so the pointers are
+    // moved over to this instance's movements.
+    for (auto& movement: other.mMovements) {
+        mMovements.PushBack(Movement {
+            movement.GetPosition(),
+            movement.GetRotation(),
+            Rebase(movement.GetPrevious(), other.mMovements, mMovements)
+        });
+    }
+    
+    for (auto& move: other.mMoves) {
+        mMoves.PushBack(move);
+        mMoves.Back().mLastMovement = Rebase(move.mLastMovement, other.mMovements, mMovements);
+    }
+}
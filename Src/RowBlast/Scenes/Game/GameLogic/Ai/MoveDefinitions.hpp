@@ -54,6 +54,7 @@ namespace RowBlast {
     
     using Moves = Pht::StaticVector<Move, Field::maxNumColumns * Field::maxNumRows * 4>;
     using Movements = Pht::StaticVector<Movement, Field::maxNumColumns * Field::maxNumRows * 4 * 2>;
+    using MovePtrs = Pht::StaticVector<Move*, Field::maxNumColumns * Field::maxNumRows * 4>;
     
     struct MovingPiece {
         void RotateClockwise();
@@ -67,6 +68,7 @@ namespace RowBlast {
     
     struct ValidMoves {
         void Clear();
+        void CopyFrom(const ValidMoves& other);
         
         Moves mMoves;
         Movements mMovements;
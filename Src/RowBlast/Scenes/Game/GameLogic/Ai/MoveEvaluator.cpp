@@ -0,0 +1,117 @@
+#include "MoveEvaluator.hpp"
+
+// Game includes.
+#include "Field.hpp"
+#include "FallingPiece.hpp"
+#include "Level.hpp"
+
+using namespace RowBlast;
+
+MoveEvaluator::MoveEvaluator(Field& field) :
+    mField {field},
+    mFieldAnalyzer {field} {}
+
+void MoveEvaluator::Init(const Level& level) {
+    mLevel = &level;
+}
+
+void MoveEvaluator::EvaluateMove(Move& move, const FallingPiece& fallingPiece) {
+    auto& pieceType = fallingPiece.GetPieceType();
+    auto pieceId = fallingPiece.GetId();
+    auto pieceNumRows = pieceType.GetGridNumRows();
+    auto pieceNumcolumns = pieceType.GetGridNumColumns();
+
+    PieceBlocks pieceBlocks {
+        pieceType.GetGrid(move.mRotation),
+        pieceNumRows,
+        pieceNumcolumns,
+        &pieceType.GetBitmask(move.mRotation)
+    };
+    
+    mField.LandPieceBlocks(pieceBlocks, pieceId, move.mPosition, false, false, false);
+    CalculateScore(move, fallingPiece);
+    mField.RemovePiece(pieceId, move.mPosition, pieceNumRows, pieceNumcolumns);
+}
+
+void MoveEvaluator::CalculateScore(Move& move, const FallingPiece& fallingPiece) {
+    switch (mLevel->GetObjective()) {
+        case Level::Objective::Clear:
+            EvaluateMoveForClearObjective(move, fallingPiece);
+            break;
+        case Level::Objective::BringDownTheAsteroid:
+            EvaluateMoveForAsteroidObjective(move, fallingPiece);
+            break;
+        case Level::Objective::Build:
+            EvaluateMoveForBuildObjective(move, fallingPiece);
+            break;
+    }
+}
+
+void MoveEvaluator::EvaluateMoveForClearObjective(Move& move, const FallingPiece& fallingPiece) {
+    auto landingHeight =
+        static_cast<float>(move.mPosition.y - mField.GetLowestVisibleRow()) +
+        fallingPiece.GetPieceType().GetCenterPosition(move.mRotation).y;
+
+    auto filledRowsResult = mField.MarkFilledRowsAndCountGrayLevelCellsInFilledRows();
+    auto numFilledRows = filledRowsResult.mFilledRowIndices.Size();
+    auto burriedHolesArea = CalculateBurriedHolesArea(numFilledRows, fallingPiece);
+    auto wellsArea = mFieldAnalyzer.CalculateWellsAreaInVisibleRows();
+    auto numTransitions = static_cast<float>(mFieldAnalyzer.CalculateNumTransitionsInVisibleRows());
+    
+    move.mScore = -landingHeight
+                  + 2.0f * numFilledRows
+                  + filledRowsResult.mGrayLevelCellsInFilledRows
+                  - 4.1f * burriedHolesArea
+                  - 0.6f * wellsArea
+                  - 0.6f * numTransitions;
+
+    mField.UnmarkFilledRows(filledRowsResult.mFilledRowIndices);
+}
+
+float MoveEvaluator::CalculateBurriedHolesArea(int numFilledRows, const FallingPiece& fallingPiece) {
+    if (numFilledRows == 0) {
+        return mFieldAnalyzer.CalculateBurriedHolesAreaInVisibleRows();
+    }
+    
+    return mFieldAnalyzer.CalculateBurriedHolesAreaInVisibleRowsWithGravity(fallingPiece.GetId());
+}
+
+void MoveEvaluator::EvaluateMoveForAsteroidObjective(Move& move, const FallingPiece& fallingPiece) {
+    auto landingHeight =
+        static_cast<float>(move.mPosition.y - mField.GetLowestVisibleRow()) +
+        fallingPiece.GetPieceType().GetCenterPosition(move.mRotation).y;
+
+    auto filledRowsResult =
+        mField.MarkFilledRowsAndCountPieceCellsInFilledRows(fallingPiece.GetId());
+    
+    auto numFilledRows = filledRowsResult.mFilledRowIndices.Size();
+    auto burriedHolesArea = CalculateBurriedHolesArea(numFilledRows, fallingPiece);
+    auto wellsArea = mFieldAnalyzer.CalculateWellsAreaInVisibleRows();
+    auto numTransitions = static_cast<float>(mFieldAnalyzer.CalculateNumTransitionsInVisibleRows());
+    
+    move.mScore = -landingHeight
+                  + 2.0f * numFilledRows
+                  + filledRowsResult.mPieceCellsInFilledRows
+                  - 4.1f * burriedHolesArea
+                  - 0.6f * wellsArea
+                  - 0.6f * numTransitions;
+    
+    mField.UnmarkFilledRows(filledRowsResult.mFilledRowIndices);
+}
+
+void MoveEvaluator::EvaluateMoveForBuildObjective(Move& move, const FallingPiece& fallingPiece) {
+    auto landingHeight =
+        static_cast<float>(move.mPosition.y - mField.GetLowestVisibleRow()) +
+        fallingPiece.GetPieceType().GetCenterPosition(move.mRotation).y;
+    
+    auto numCellsAccordingToBlueprint =
+        static_cast<float>(mFieldAnalyzer.CalculateNumCellsAccordingToBlueprintInVisibleRows());
+
+    auto buildHolesArea = mFieldAnalyzer.CalculateBuildHolesAreaInVisibleRows();
+    auto buildWellsArea = mFieldAnalyzer.CalculateBuildWellsAreaInVisibleRows();
+    
+    move.mScore = -landingHeight
+                  + 2.0f * numCellsAccordingToBlueprint
+                  - 4.0f * buildHolesArea
+                  - 0.25f * buildWellsArea;
+}
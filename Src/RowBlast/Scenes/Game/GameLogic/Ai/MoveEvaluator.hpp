@@ -0,0 +1,33 @@
+#ifndef MoveEvaluator_hpp
+#define MoveEvaluator_hpp
+
+// Game includes.
+#include "FieldAnalyzer.hpp"
+#include "MoveDefinitions.hpp"
+
+namespace RowBlast {
+    class Field;
+    class FallingPiece;
+    class Level;
+    
+    class MoveEvaluator {
+    public:
+        explicit MoveEvaluator(Field& field);
+        
+        void Init(const Level& level);
+        void EvaluateMove(Move& move, const FallingPiece& fallingPiece);
+        
+    private:
+        void CalculateScore(Move& move, const FallingPiece& fallingPiece);
+        void EvaluateMoveForClearObjective(Move& move, const FallingPiece& fallingPiece);
+        void EvaluateMoveForAsteroidObjective(Move& move, const FallingPiece& fallingPiece);
+        void EvaluateMoveForBuildObjective(Move& move, const FallingPiece& fallingPiece);
+        float CalculateBurriedHolesArea(int numFilledRows, const FallingPiece& fallingPiece);
+        
+        Field& mField;
+        FieldAnalyzer mFieldAnalyzer;
+        const Level* mLevel {nullptr};
+    };
+}
+
+#endif
@@ -0,0 +1,74 @@
+#include "ValidMovesCache.hpp"
+
+using namespace RowBlast;
+
+bool ValidMovesCache::Key::operator==(const Key& other) const {
+    return mFieldStateHash == other.mFieldStateHash &&
+           mLowestVisibleRow == other.mLowestVisibleRow &&
+           mPieceType == other.mPieceType &&
+           mPosition == other.mPosition &&
+           mRotation == other.mRotation &&
+           mPredeterminedMove == other.mPredeterminedMove &&
+           mSuggestedMoves == other.mSuggestedMoves;
+}
+
+ValidMovesCache::ValidMovesCache() :
+    mEntries(maxNumEntries) {}
+
+void ValidMovesCache::Clear() {
+    for (auto& entry: mEntries) {
+        entry.mIsUsed = false;
+    }
+}
+
+bool ValidMovesCache::Find(ValidMoves& validMoves, const Key& key) {
+    ClearIfFieldStateChanged(key.mFieldStateHash);
+    
+    for (auto& entry: mEntries) {
+        if (entry.mIsUsed && entry.mKey == key) {
+            entry.mLastUseTime = ++mTime;
+            validMoves.CopyFrom(*entry.mValidMoves);
+            return true;
+        }
+    }
+    
+    return false;
+}
+
+void ValidMovesCache::Insert(const Key& key, const ValidMoves& validMoves) {
+    ClearIfFieldStateChanged(key.mFieldStateHash);
+    
+    auto& entry = FindEntryToReplace();
+    
+    if (entry.mValidMoves == nullptr) {
+        entry.mValidMoves = std::make_unique<ValidMoves>();
+    }
+    
+    entry.mKey = key;
+    entry.mValidMoves->CopyFrom(validMoves);
+    entry.mIsUsed = true;
+    entry.mLastUseTime = ++mTime;
+}
+
+void ValidMovesCache::ClearIfFieldStateChanged(uint64_t fieldStateHash) {
+    if (fieldStateHash != mFieldStateHash) {
+        Clear();
+        mFieldStateHash = fieldStateHash;
+    }
+}
+
+ValidMovesCache::Entry& ValidMovesCache::FindEntryToReplace() {
+    auto* leastRecentlyUsedEntry = &mEntries.front();
+    
+    for (auto& entry: mEntries) {
+        if (!entry.mIsUsed) {
+            return entry;
+        }
+        
+        if (entry.mLastUseTime < leastRecentlyUsedEntry->mLastUseTime) {
+            leastRecentlyUsedEntry = &entry;
+        }
+    }
+    
+    return *leastRecentlyUsedEntry;
+}
@@ -0,0 +1,54 @@
+#ifndef ValidMovesCache_hpp
+#define ValidMovesCache_hpp
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+// Game includes.
+#include "MoveDefinitions.hpp"
+
+namespace RowBlast {
+    // Keeps the results of recent valid moves searches for the current field state so that
+    // switching back and forth between pieces does not redo the search. All entries are dropped as
+    // soon as a lookup is made with a different field state hash.
+    class ValidMovesCache {
+    public:
+        struct Key {
+            bool operator==(const Key& other) const;
+            
+            uint64_t mFieldStateHash {0};
+            int mLowestVisibleRow {0};
+            const Piece* mPieceType {nullptr};
+            Pht::IVec2 mPosition;
+            Rotation mRotation {Rotation::Deg0};
+            const Level::TutorialMove* mPredeterminedMove {nullptr};
+            const std::vector<Level::TutorialMove>* mSuggestedMoves {nullptr};
+        };
+        
+        ValidMovesCache();
+        
+        void Clear();
+        bool Find(ValidMoves& validMoves, const Key& key);
+        void Insert(const Key& key, const ValidMoves& validMoves);
+        
+    private:
+        struct Entry {
+            Key mKey;
+            std::unique_ptr<ValidMoves> mValidMoves;
+            bool mIsUsed {false};
+            int mLastUseTime {0};
+        };
+        
+        void ClearIfFieldStateChanged(uint64_t fieldStateHash);
+        Entry& FindEntryToReplace();
+        
+        static constexpr int maxNumEntries {4};
+        
+        std::vector<Entry> mEntries;
+        uint64_t mFieldStateHash {0};
+        int mTime {0};
+    };
+}
+
+#endif
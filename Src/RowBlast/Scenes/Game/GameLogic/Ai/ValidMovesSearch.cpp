@@ -35,7 +35,8 @@ namespace {
         return PieceBlocks {
             pieceType.GetGrid(piece.mRotation),
             pieceType.GetGridNumRows(),
-            pieceType.GetGridNumColumns()
+            pieceType.GetGridNumColumns(),
+            &pieceType.GetBitmask(piece.mRotation)
         };
     }
     
@@ -48,8 +49,9 @@ namespace {
     }
 }
 
-ValidMovesSearch::ValidMovesSearch(Field& field) :
-    mField {field} {}
+ValidMovesSearch::ValidMovesSearch(Field& field, UseCache useCache) :
+    mField {field},
+    mUseCache {useCache} {}
 
 void ValidMovesSearch::Init() {
     auto numRows = mField.GetNumRows();
@@ -72,15 +74,43 @@ void ValidMovesSearch::Init() {
     for (auto rowIndex = 0; rowIndex < numRows; ++rowIndex) {
         mValidArea.push_back(validAreaRow);
     }
+    
+    mCache.Clear();
 }
 
 void ValidMovesSearch::FindValidMoves(ValidMoves& validMoves,
                                       MovingPiece piece,
                                       const Level::TutorialMove* predeterminedMove,
                                       const std::vector<Level::TutorialMove>* suggestedMoves) {
+    assert(validMoves.mMoves.IsEmpty() && validMoves.mMovements.IsEmpty());
+    
     mPredeterminedMove = predeterminedMove;
     mSuggestedMoves = suggestedMoves;
+    
+    if (mUseCache == UseCache::No) {
+        SearchValidMoves(validMoves, piece);
+        return;
+    }
+    
+    ValidMovesCache::Key cacheKey {
+        mField.GetStateHash(),
+        mField.GetLowestVisibleRow(),
+        &piece.mPieceType,
+        piece.mPosition,
+        piece.mRotation,
+        predeterminedMove,
+        suggestedMoves
+    };
+    
+    if (mCache.Find(validMoves, cacheKey)) {
+        return;
+    }
+    
+    SearchValidMoves(validMoves, piece);
+    mCache.Insert(cacheKey, validMoves);
+}
 
+void ValidMovesSearch::SearchValidMoves(ValidMoves& validMoves, MovingPiece piece) {
     InitSearchGrid();
     ResetValidArea();
     FindMostValidMovesWithHumanLikeSearch(validMoves, piece);
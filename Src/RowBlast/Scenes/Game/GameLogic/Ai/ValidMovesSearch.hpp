@@ -3,11 +3,19 @@
 
 // Game includes.
 #include "MoveDefinitions.hpp"
+#include "ValidMovesCache.hpp"
 
 namespace RowBlast {
     class ValidMovesSearch {
     public:
-        explicit ValidMovesSearch(Field& field);
+        // Only the search of the field the player sees should be cached. The fields of the
+        // lookahead are searched once each, so caching them would only cost a copy of the moves.
+        enum class UseCache {
+            Yes,
+            No
+        };
+        
+        ValidMovesSearch(Field& field, UseCache useCache);
         
         void Init();
         void FindValidMoves(ValidMoves& validMoves,
@@ -64,6 +72,7 @@ namespace RowBlast {
         
         using SearchGrid = std::vector<std::vector<CellSearchData>>;
         
+        void SearchValidMoves(ValidMoves& validMoves, MovingPiece piece);
         void InitSearchGrid();
         void ResetValidArea();
         void ResetVisitedLocations();
@@ -151,6 +160,8 @@ namespace RowBlast {
         mutable Field::CollisionResult mCollisionResult;
         const Level::TutorialMove* mPredeterminedMove {nullptr};
         const std::vector<Level::TutorialMove>* mSuggestedMoves {nullptr};
+        UseCache mUseCache;
+        ValidMovesCache mCache;
     };
 }
 
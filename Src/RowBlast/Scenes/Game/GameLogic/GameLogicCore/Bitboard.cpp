@@ -0,0 +1,129 @@
+#include "Bitboard.hpp"
+
+#include <assert.h>
+
+using namespace RowBlast;
+
+namespace {
+    void SetSubCellBit(BitboardRow& bitboardRow, const SubCell& subCell, RowBitmask bit) {
+        if (subCell.IsEmpty()) {
+            return;
+        }
+
+        bitboardRow.mFills[static_cast<int>(subCell.mFill)] |= bit;
+        bitboardRow.mOccupied |= bit;
+    }
+
+    void SetCellBits(BitboardRow& bitboardRow, const Cell& cell, RowBitmask bit) {
+        for (auto& fillMask: bitboardRow.mFills) {
+            fillMask &= ~bit;
+        }
+
+        bitboardRow.mOccupied &= ~bit;
+        bitboardRow.mFull &= ~bit;
+        bitboardRow.mNonBlockObjects &= ~bit;
+        bitboardRow.mGrayLevelBlocks &= ~bit;
+
+        SetSubCellBit(bitboardRow, cell.mFirstSubCell, bit);
+        SetSubCellBit(bitboardRow, cell.mSecondSubCell, bit);
+        
+        if (cell.IsFull()) {
+            bitboardRow.mFull |= bit;
+        }
+        
+        if (cell.mFirstSubCell.IsNonBlockObject()) {
+            bitboardRow.mNonBlockObjects |= bit;
+        }
+        
+        if (cell.mFirstSubCell.mIsGrayLevelBlock) {
+            bitboardRow.mGrayLevelBlocks |= bit;
+        }
+    }
+    
+    bool IsOccupied(const BitboardRow& bitboardRow, int column) {
+        return bitboardRow.mOccupied & (1 << column);
+    }
+}
+
+void PieceBitmask::Init(const CellGrid& grid, int numRows, int numColumns) {
+    assert(numRows <= maxRows);
+    assert(numColumns <= maxColumns);
+
+    mNumRows = numRows;
+    mNumColumns = numColumns;
+
+    for (auto row = 0; row < numRows; ++row) {
+        auto& bitboardRow = mRows[row];
+        bitboardRow = BitboardRow {};
+
+        for (auto column = 0; column < numColumns; ++column) {
+            SetCellBits(bitboardRow, grid[row][column], 1 << column);
+        }
+        
+        auto occupied = bitboardRow.mOccupied;
+        mLeftEdges[row] = occupied & ~(occupied << 1);
+        mRightEdges[row] = occupied & ~(occupied >> 1);
+    }
+    
+    for (auto column = 0; column < numColumns; ++column) {
+        mBottomEdges[column] = 0;
+        
+        for (auto row = 0; row < numRows; ++row) {
+            if (IsOccupied(mRows[row], column) &&
+                (row == 0 || !IsOccupied(mRows[row - 1], column))) {
+                
+                mBottomEdges[column] |= 1 << row;
+            }
+        }
+    }
+}
+
+void Bitboard::Init(int numRows, int numColumns) {
+    assert(numColumns <= sizeof(RowBitmask) * 8);
+
+    mRows.resize(numRows);
+    mColumnHeights.resize(numColumns);
+    mColumnsMask = static_cast<RowBitmask>((1u << numColumns) - 1u);
+    Clear();
+}
+
+void Bitboard::Clear() {
+    for (auto& row: mRows) {
+        row = BitboardRow {};
+    }
+    
+    for (auto& columnHeight: mColumnHeights) {
+        columnHeight = 0;
+    }
+}
+
+void Bitboard::UpdateCell(int row, int column, const Cell& cell) {
+    SetCellBits(mRows[row], cell, 1 << column);
+    UpdateColumnHeight(row, column);
+}
+
+void Bitboard::UpdateColumnHeight(int row, int column) {
+    auto& columnHeight = mColumnHeights[column];
+    
+    if (IsOccupied(mRows[row], column)) {
+        if (row >= columnHeight) {
+            columnHeight = row + 1;
+        }
+    } else if (row == columnHeight - 1) {
+        while (columnHeight > 0 && !IsOccupied(mRows[columnHeight - 1], column)) {
+            --columnHeight;
+        }
+    }
+}
+
+int Bitboard::CalculateHighestOccupiedRow() const {
+    auto height = 0;
+    
+    for (auto columnHeight: mColumnHeights) {
+        if (columnHeight > height) {
+            height = columnHeight;
+        }
+    }
+    
+    return height - 1;
+}
@@ -0,0 +1,88 @@
+#ifndef Bitboard_hpp
+#define Bitboard_hpp
+
+#include <cstdint>
+#include <vector>
+
+// Game includes.
+#include "Cell.hpp"
+
+namespace RowBlast {
+    using RowBitmask = uint16_t;
+    
+    inline int CountBits(unsigned int mask) {
+        return __builtin_popcount(mask);
+    }
+
+    // Bit N in a row bitmask corresponds to column N.
+    struct BitboardRow {
+        RowBitmask GetFillMask(Fill fill) const {
+            return mFills[static_cast<int>(fill)];
+        }
+
+        // Indexed by Fill. The Fill::Empty slot is unused.
+        RowBitmask mFills[static_cast<int>(Fill::Full) + 1] {};
+        RowBitmask mOccupied {0};
+        
+        // Cells where Cell::IsFull() is true, i.e. one full sub cell or two half sub cells.
+        RowBitmask mFull {0};
+        RowBitmask mNonBlockObjects {0};
+        RowBitmask mGrayLevelBlocks {0};
+    };
+
+    // Built once per piece rotation. The edges are the occupied cells that lead when the piece
+    // moves in a direction, so a column or row with a gap in it has more than one edge.
+    struct PieceBitmask {
+        static constexpr int maxRows {5};
+        static constexpr int maxColumns {5};
+
+        void Init(const CellGrid& grid, int numRows, int numColumns);
+
+        BitboardRow mRows[maxRows];
+        RowBitmask mLeftEdges[maxRows] {};
+        RowBitmask mRightEdges[maxRows] {};
+        
+        // Indexed by column. Bit N corresponds to row N.
+        RowBitmask mBottomEdges[maxColumns] {};
+        
+        int mNumRows {0};
+        int mNumColumns {0};
+    };
+
+    // Besides the cell bits the bitboard keeps the height of each column up to date so that the
+    // highest block can be found without scanning the empty rows above it.
+    class Bitboard {
+    public:
+        void Init(int numRows, int numColumns);
+        void Clear();
+        void UpdateCell(int row, int column, const Cell& cell);
+        int CalculateHighestOccupiedRow() const;
+
+        const BitboardRow& GetRow(int row) const {
+            return mRows[row];
+        }
+
+        RowBitmask GetOccupied(int row) const {
+            return mRows[row].mOccupied;
+        }
+        
+        RowBitmask GetEmpty(int row) const {
+            return ~mRows[row].mOccupied & mColumnsMask;
+        }
+        
+        // Full rows containing bombs or asteroids are not cleared.
+        bool IsRowFull(int row) const {
+            auto& bitboardRow = mRows[row];
+            return (bitboardRow.mFull & ~bitboardRow.mNonBlockObjects) == mColumnsMask;
+        }
+
+    private:
+        void UpdateColumnHeight(int row, int column);
+        
+        std::vector<BitboardRow> mRows;
+        std::vector<int> mColumnHeights;
+        RowBitmask mColumnsMask {0};
+    };
+}
+
+#endif
@@ -141,7 +141,6 @@ namespace RowBlast {
         
         float mVelocity {0.0f};
         State mState {State::Inactive};
-        bool mShouldBounce {true};
     };
 
     struct SubCell {
@@ -174,9 +173,7 @@ namespace RowBlast {
         bool mIsFound {false};
         ScanDirection mTriedScanDirection {ScanDirection::None};
         bool mIsPulledDown {false};
-        FallingBlockAnimationComponent mFallingBlockAnimation;
-        FlashingBlockAnimationComponent mFlashingBlockAnimation;
-        BondAnimationsComponent mBondAnimations;
+        bool mShouldBounce {true};
     };
     
     struct Cell {
@@ -194,6 +191,19 @@ namespace RowBlast {
     
     using CellGrid = std::vector<std::vector<Cell>>;
     
+    // The animation state of a sub cell is kept apart from the sub cell so that the game logic and
+    // the AI can copy and scan the cells without it.
+    struct SubCellAnimations {
+        FallingBlockAnimationComponent mFallingBlockAnimation;
+        FlashingBlockAnimationComponent mFlashingBlockAnimation;
+        BondAnimationsComponent mBondAnimations;
+    };
+    
+    struct CellAnimations {
+        SubCellAnimations mFirstSubCell;
+        SubCellAnimations mSecondSubCell;
+    };
+    
     struct SlotFillAnimationComponent {
         bool mIsActive {false};
         float mElapsedTime {0.0f};
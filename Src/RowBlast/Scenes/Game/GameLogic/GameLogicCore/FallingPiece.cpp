@@ -6,6 +6,10 @@ void FallingPiece::UpdateId() {
     ++mId;
 }
 
+void FallingPiece::SetId(int id) {
+    mId = id;
+}
+
 void FallingPiece::Spawn(const Piece& pieceType,
                          const Pht::Vec2& position,
                          Rotation rotation,
@@ -19,6 +19,7 @@ namespace RowBlast {
         };
         
         void UpdateId();
+        void SetId(int id);
         void Spawn(const Piece& pieceType,
                    const Pht::Vec2& position,
                    Rotation rotation,
@@ -16,16 +16,6 @@ namespace {
     constexpr auto maxNumRowsInOneScreen = 18;
     const SubCell fullSubCell {Fill::Full};
 
-    bool RowIsFull(const std::vector<Cell>& row) {
-        for (auto& cell: row) {
-            if (!cell.IsFull() || cell.mFirstSubCell.IsNonBlockObject()) {
-                return false;
-            }
-        }
-
-        return true;
-    }
-    
     float CalculatePieceCellContribution(const SubCell& subCell, int pieceId) {
         if (subCell.mPieceId != pieceId) {
             return 0.0f;
@@ -69,25 +59,25 @@ namespace {
         bonds.mDownLeft = false;
     }
     
-    void BreakUpBonds(SubCell& subCell) {
+    void BreakUpBonds(SubCell& subCell, SubCellAnimations& subCellAnimations) {
         auto& bonds = subCell.mBonds;
         bonds.mUpRight = false;
         bonds.mUp = false;
         bonds.mUpLeft = false;
         
-        auto& animations = subCell.mBondAnimations;
+        auto& animations = subCellAnimations.mBondAnimations;
         animations.mUp = BondAnimation {};
         animations.mUpRight = BondAnimation {};
         animations.mUpLeft = BondAnimation {};
     }
     
-    void BreakRightBonds(SubCell& subCell) {
+    void BreakRightBonds(SubCell& subCell, SubCellAnimations& subCellAnimations) {
         auto& bonds = subCell.mBonds;
         bonds.mUpRight = false;
         bonds.mRight = false;
         bonds.mDownRight = false;
         
-        auto& animations = subCell.mBondAnimations;
+        auto& animations = subCellAnimations.mBondAnimations;
         animations.mUpRight = BondAnimation {};
         animations.mRight = BondAnimation {};
     }
@@ -105,28 +95,46 @@ namespace {
         return {
             pieceType.GetGrid(fallingPiece.GetRotation()),
             pieceType.GetGridNumRows(),
-            pieceType.GetGridNumColumns()
+            pieceType.GetGridNumColumns(),
+            &pieceType.GetBitmask(fallingPiece.GetRotation())
         };
     }
+    
+    bool ShiftIntoFieldColumns(unsigned int& result,
+                               RowBitmask pieceRowMask,
+                               int x,
+                               unsigned int columnsMask) {
+        if (x >= 0) {
+            result = static_cast<unsigned int>(pieceRowMask) << x;
+            return (result & ~columnsMask) == 0;
+        }
+        
+        if (pieceRowMask & ((1u << -x) - 1u)) {
+            return false;
+        }
+        
+        result = static_cast<unsigned int>(pieceRowMask) >> -x;
+        return true;
+    }
 }
 
 void Field::Init(const Level& level) {
     mBlueprintGrid = nullptr;
     mNumColumns = level.GetNumColumns();
     mNumRows = level.GetNumRows();
+    mGrid.Init(mNumRows, mNumColumns);
     
     switch (level.GetObjective()) {
         case Level::Objective::Clear: {
             auto* clearGrid = level.GetClearGrid();
             assert(clearGrid);
-            mGrid = *clearGrid;
-            assert(mNumRows - CalculateHighestLevelBlock().GetValue() >= 14);
+            mGrid.Assign(*clearGrid);
             break;
         }
         case Level::Objective::BringDownTheAsteroid: {
             auto* clearGrid = level.GetClearGrid();
             assert(clearGrid);
-            mGrid = *clearGrid;
+            mGrid.Assign(*clearGrid);
             assert(mNumRows - CalculateAsteroidRow().GetValue() >= 13);
             break;
         }
@@ -134,21 +142,30 @@ void Field::Init(const Level& level) {
             auto* blueprintGrid = level.GetBlueprintGrid();
             assert(blueprintGrid);
             mBlueprintGrid = std::make_unique<BlueprintCellGrid>(*blueprintGrid);
-            mGrid.clear();
-            mGrid.reserve(mNumRows);
-            std::vector<Cell> emptyRow(mNumColumns);
-            for (auto rowIndex = 0; rowIndex < mNumRows; ++rowIndex) {
-                mGrid.push_back(emptyRow);
-            }
             break;
         }
     }
     
     mLowestVisibleRow = 0;
     ManageBonds();
-
-    mPreviousGrid = mGrid;
-    mTempGrid = mGrid;
+    
+    mBitboard.Init(mNumRows, mNumColumns);
+    mHash.Init(mNumRows, mNumColumns);
+    RebuildBitboardAndHash();
+    
+    // The level blocks are found through the bitboard, so it has to be built before the height of
+    // the level is checked.
+    assert(level.GetObjective() != Level::Objective::Clear ||
+           mNumRows - CalculateHighestLevelBlock().GetValue() >= 14);
+
+    mPreviousGrid.Init(mNumRows, mNumColumns);
+    mPreviousGrid.CopyCellsFrom(mGrid);
+    mTempGrid.Init(mNumRows, mNumColumns);
+    mTempGrid.CopyFrom(mGrid);
+    mPreviousBitboard = mBitboard;
+    mTempBitboard = mBitboard;
+    mPreviousHash = mHash;
+    mTempHash = mHash;
     SetChanged();
 }
 
@@ -162,30 +179,61 @@ void Field::SetChanged() {
 
 void Field::RestorePreviousState() {
     SetChanged();
-    CopyGridNoAlloc(mGrid, mPreviousGrid);
+    
+    // The saved state is not animated, so the blocks are restored at rest.
+    mGrid.CopyCellsFrom(mPreviousGrid);
+    mGrid.ResetAnimations();
+    mBitboard = mPreviousBitboard;
+    mHash = mPreviousHash;
 }
 
 void Field::SaveState() {
-    CopyGridNoAlloc(mPreviousGrid, mGrid);
+    mPreviousGrid.CopyCellsFrom(mGrid);
+    mPreviousBitboard = mBitboard;
+    mPreviousHash = mHash;
 }
 
 void Field::SaveInTempGrid() {
-    CopyGridNoAlloc(mTempGrid, mGrid);
+    // The pull down between saving and restoring moves the animations along with the blocks, so
+    // they are saved as well.
+    mTempGrid.CopyFrom(mGrid);
+    mTempBitboard = mBitboard;
+    mTempHash = mHash;
 }
 
 void Field::RestoreFromTempGrid() {
     SetChanged();
-    CopyGridNoAlloc(mGrid, mTempGrid);
+    mGrid.CopyFrom(mTempGrid);
+    mBitboard = mTempBitboard;
+    mHash = mTempHash;
+}
+
+void Field::CopyCellsFrom(const Field& other) {
+    assert(other.mNumRows == mNumRows && other.mNumColumns == mNumColumns);
+    
+    mGrid.CopyCellsFrom(other.mGrid);
+    mBitboard = other.mBitboard;
+    mHash = other.mHash;
+    mLowestVisibleRow = other.mLowestVisibleRow;
 }
 
-void Field::CopyGridNoAlloc(CellGrid& to, const CellGrid& from) {
+void Field::RebuildBitboardAndHash() {
+    mBitboard.Clear();
+    mHash.Clear();
+    
     for (auto row = 0; row < mNumRows; ++row) {
         for (auto column = 0; column < mNumColumns; ++column) {
-            to[row][column] = from[row][column];
+            OnCellChanged(row, column);
         }
     }
 }
 
+void Field::OnCellChanged(int row, int column) {
+    auto& cell = mGrid[row][column];
+    mBitboard.UpdateCell(row, column, cell);
+    mHash.UpdateCell(row, column, cell);
+}
+
 int Field::GetNumRowsInOneScreen() const {
     if (mNumRows > maxNumRowsInOneScreen) {
         return maxNumRowsInOneScreen;
@@ -198,7 +246,7 @@ bool Field::AnyFilledRows() const {
     auto pastHighestVisibleRow = mLowestVisibleRow + GetNumRowsInOneScreen();
     
     for (auto rowIndex = mLowestVisibleRow; rowIndex < pastHighestVisibleRow; ++rowIndex) {
-        if (RowIsFull(mGrid[rowIndex])) {
+        if (mBitboard.IsRowFull(rowIndex)) {
             return true;
         }
     }
@@ -238,11 +286,9 @@ int Field::CalculateNumEmptyBlueprintSlots() const {
 }
 
 Pht::Optional<int> Field::CalculateHighestLevelBlock() const {
-    for (auto row = mNumRows - 1; row >= 0; --row) {
-        for (auto column = 0; column < mNumColumns; ++column) {
-            if (mGrid[row][column].mFirstSubCell.mIsGrayLevelBlock) {
-                return row;
-            }
+    for (auto row = mBitboard.CalculateHighestOccupiedRow(); row >= 0; --row) {
+        if (mBitboard.GetRow(row).mGrayLevelBlocks) {
+            return row;
         }
     }
 
@@ -252,12 +298,15 @@ Pht::Optional<int> Field::CalculateHighestLevelBlock() const {
 Pht::Optional<int> Field::CalculateHighestBlockInSpawningArea(int lowestVisibleRow) const {
     auto spawningAreaBottomRow = lowestVisibleRow + numRowsUpToSpawningArea;
     auto spawningAreaTopRow = spawningAreaBottomRow + Piece::maxRows - 1;
+    auto highestOccupiedRow = mBitboard.CalculateHighestOccupiedRow();
+    
+    if (spawningAreaTopRow > highestOccupiedRow) {
+        spawningAreaTopRow = highestOccupiedRow;
+    }
     
     for (auto row = spawningAreaTopRow; row >= spawningAreaBottomRow; --row) {
-        for (auto column = 0; column < mNumColumns; ++column) {
-            if (row <= mNumRows - 1 && !mGrid[row][column].IsEmpty()) {
-                return row;
-            }
+        if (mBitboard.GetOccupied(row)) {
+            return row;
         }
     }
 
@@ -349,6 +398,23 @@ Pht::IVec2 Field::ScanUntilCollision(const PieceBlocks& pieceBlocks,
                                      ValidArea* validArea) const {
     auto isScanStart = true;
     
+    // How far the piece can move before it touches any block is given by the leading edges of the
+    // piece, so only the last positions of the scan need the cell by cell check.
+    if (pieceBlocks.mBitmask && IsFreeOfBlocks(*pieceBlocks.mBitmask, position)) {
+        auto& pieceBitmask = *pieceBlocks.mBitmask;
+        auto freeDistance = CalculateFreeDistance(pieceBitmask, position, step);
+        
+        for (auto i = 0; i <= freeDistance; ++i) {
+            if (validArea) {
+                MarkValidArea(*validArea, pieceBitmask, position);
+            }
+            
+            position += step;
+        }
+        
+        isScanStart = false;
+    }
+    
     for (;;) {
         CheckCollision(mCollisionResult, pieceBlocks, position, step, isScanStart, validArea);
         
@@ -380,6 +446,17 @@ void Field::CheckCollision(CollisionResult& result,
     result.mIsCollision = IsCollision::No;
     result.mCollisionPoints.Clear();
     
+    // Most positions tried by the scans are in free space, which the bitboard can tell with a few
+    // AND operations. The cell by cell check is only needed when the piece overlaps occupied cells
+    // or is outside the field since the half cell rules then have to be applied.
+    if (pieceBlocks.mBitmask && IsFreeOfBlocks(*pieceBlocks.mBitmask, position)) {
+        if (validArea) {
+            MarkValidArea(*validArea, *pieceBlocks.mBitmask, position);
+        }
+        
+        return;
+    }
+    
     auto pieceNumRows = pieceBlocks.mNumRows;
     auto pieceNumColumns = pieceBlocks.mNumColumns;
     auto& pieceGrid = pieceBlocks.mGrid;
@@ -456,6 +533,168 @@ void Field::CheckCollision(CollisionResult& result,
     }
 }
 
+bool Field::IsFreeOfBlocks(const PieceBitmask& pieceBitmask, const Pht::IVec2& position) const {
+    auto columnsMask = (1u << mNumColumns) - 1u;
+    
+    for (auto pieceRow = 0; pieceRow < pieceBitmask.mNumRows; ++pieceRow) {
+        auto pieceRowMask = pieceBitmask.mRows[pieceRow].mOccupied;
+        if (pieceRowMask == 0) {
+            continue;
+        }
+        
+        auto fieldRow = position.y + pieceRow;
+        if (fieldRow < mLowestVisibleRow || fieldRow >= mNumRows) {
+            return false;
+        }
+        
+        auto shiftedPieceRowMask = 0u;
+        if (!ShiftIntoFieldColumns(shiftedPieceRowMask, pieceRowMask, position.x, columnsMask)) {
+            return false;
+        }
+        
+        if (shiftedPieceRowMask & mBitboard.GetOccupied(fieldRow)) {
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+int Field::CalculateFreeDistance(const PieceBitmask& pieceBitmask,
+                                 const Pht::IVec2& position,
+                                 const Pht::IVec2& step) const {
+    if (step == Pht::IVec2{0, -1}) {
+        return CalculateFreeDistanceDown(pieceBitmask, position);
+    }
+    
+    if (step == Pht::IVec2{1, 0}) {
+        return CalculateFreeDistanceRight(pieceBitmask, position);
+    }
+    
+    if (step == Pht::IVec2{-1, 0}) {
+        return CalculateFreeDistanceLeft(pieceBitmask, position);
+    }
+    
+    return 0;
+}
+
+int Field::CalculateFreeDistanceDown(const PieceBitmask& pieceBitmask,
+                                     const Pht::IVec2& position) const {
+    auto freeDistance = mNumRows;
+    
+    for (auto pieceColumn = 0; pieceColumn < pieceBitmask.mNumColumns; ++pieceColumn) {
+        auto bottomEdges = pieceBitmask.mBottomEdges[pieceColumn];
+        if (bottomEdges == 0) {
+            continue;
+        }
+        
+        auto columnBit = 1u << (position.x + pieceColumn);
+        
+        for (auto pieceRow = 0; bottomEdges; ++pieceRow, bottomEdges >>= 1) {
+            if ((bottomEdges & 1) == 0) {
+                continue;
+            }
+            
+            auto distance = 0;
+            
+            for (auto fieldRow = position.y + pieceRow - 1;
+                 distance < freeDistance && fieldRow >= mLowestVisibleRow &&
+                 (mBitboard.GetOccupied(fieldRow) & columnBit) == 0;
+                 --fieldRow) {
+                
+                ++distance;
+            }
+            
+            freeDistance = distance;
+        }
+    }
+    
+    return freeDistance;
+}
+
+int Field::CalculateFreeDistanceRight(const PieceBitmask& pieceBitmask,
+                                      const Pht::IVec2& position) const {
+    auto freeDistance = mNumColumns;
+    
+    for (auto pieceRow = 0; pieceRow < pieceBitmask.mNumRows; ++pieceRow) {
+        auto rightEdges = pieceBitmask.mRightEdges[pieceRow];
+        if (rightEdges == 0) {
+            continue;
+        }
+        
+        auto occupied = mBitboard.GetOccupied(position.y + pieceRow);
+        
+        for (auto pieceColumn = 0; rightEdges; ++pieceColumn, rightEdges >>= 1) {
+            if ((rightEdges & 1) == 0) {
+                continue;
+            }
+            
+            auto distance = 0;
+            
+            for (auto fieldColumn = position.x + pieceColumn + 1;
+                 distance < freeDistance && fieldColumn < mNumColumns &&
+                 (occupied & (1u << fieldColumn)) == 0;
+                 ++fieldColumn) {
+                
+                ++distance;
+            }
+            
+            freeDistance = distance;
+        }
+    }
+    
+    return freeDistance;
+}
+
+int Field::CalculateFreeDistanceLeft(const PieceBitmask& pieceBitmask,
+                                     const Pht::IVec2& position) const {
+    auto freeDistance = mNumColumns;
+    
+    for (auto pieceRow = 0; pieceRow < pieceBitmask.mNumRows; ++pieceRow) {
+        auto leftEdges = pieceBitmask.mLeftEdges[pieceRow];
+        if (leftEdges == 0) {
+            continue;
+        }
+        
+        auto occupied = mBitboard.GetOccupied(position.y + pieceRow);
+        
+        for (auto pieceColumn = 0; leftEdges; ++pieceColumn, leftEdges >>= 1) {
+            if ((leftEdges & 1) == 0) {
+                continue;
+            }
+            
+            auto distance = 0;
+            
+            for (auto fieldColumn = position.x + pieceColumn - 1;
+                 distance < freeDistance && fieldColumn >= 0 &&
+                 (occupied & (1u << fieldColumn)) == 0;
+                 --fieldColumn) {
+                
+                ++distance;
+            }
+            
+            freeDistance = distance;
+        }
+    }
+    
+    return freeDistance;
+}
+
+void Field::MarkValidArea(ValidArea& validArea,
+                          const PieceBitmask& pieceBitmask,
+                          const Pht::IVec2& position) const {
+    for (auto pieceRow = 0; pieceRow < pieceBitmask.mNumRows; ++pieceRow) {
+        auto pieceRowMask = pieceBitmask.mRows[pieceRow].mOccupied;
+        auto fieldRow = position.y + pieceRow;
+        
+        for (auto pieceColumn = 0; pieceRowMask; ++pieceColumn, pieceRowMask >>= 1) {
+            if (pieceRowMask & 1) {
+                validArea[fieldRow][position.x + pieceColumn] = validCell;
+            }
+        }
+    }
+}
+
 int Field::DetectFreeSpaceUp(const PieceBlocks& pieceBlocks, const Pht::IVec2& position) const {
     Pht::IVec2 step {0, 1};
     auto freePosition = ScanUntilNoCollision(pieceBlocks, position, step);
@@ -637,6 +876,12 @@ void Field::LandPieceBlocks(const PieceBlocks& pieceBlocks,
             
             fieldSubCell = pieceSubCell;
             fieldSubCell.mPieceId = pieceId;
+            OnCellChanged(row, column);
+            
+            auto& animations = mGrid.GetAnimations(row, column, fieldSubCell);
+            animations = SubCellAnimations {};
+            animations.mFlashingBlockAnimation.mState =
+                FlashingBlockAnimationComponent::State::Waiting;
 
             if (updateCellPosition) {
                 fieldSubCell.mPosition = Pht::Vec2 {
@@ -653,7 +898,7 @@ void Field::LandPieceBlocks(const PieceBlocks& pieceBlocks,
             }
             
             if (startBounceAnimation) {
-                auto& fallingBlockAnimation = fieldSubCell.mFallingBlockAnimation;
+                auto& fallingBlockAnimation = animations.mFallingBlockAnimation;
                 fallingBlockAnimation.mState = FallingBlockAnimationComponent::State::Bouncing;
                 fallingBlockAnimation.mVelocity = FallingBlockAnimationComponent::fallingPieceBounceVelocity;
             }
@@ -672,7 +917,7 @@ void Field::ManageBonds() {
             auto& cell = mGrid[row][column];
             Pht::IVec2 position {column, row};
             
-            MakeDiagonalBond(cell);
+            MakeDiagonalBond(cell, position);
             MakeBonds(cell.mFirstSubCell, position);
             MakeBonds(cell.mSecondSubCell, position);
         }
@@ -688,7 +933,7 @@ void Field::ManageBonds() {
     }
 }
 
-void Field::MakeDiagonalBond(Cell& cell) {
+void Field::MakeDiagonalBond(Cell& cell, const Pht::IVec2& position) {
     auto& firstSubCell = cell.mFirstSubCell;
     auto& secondSubCell = cell.mSecondSubCell;
 
@@ -698,7 +943,9 @@ void Field::MakeDiagonalBond(Cell& cell) {
 
         firstSubCell.mBonds.mDiagonal = true;
         secondSubCell.mBonds.mDiagonal = true;
-        BondsAnimationSystem::StartBondAppearingAnimation(secondSubCell.mBondAnimations.mDiagonal);
+        auto& animations =
+            mGrid.GetAnimations(position.y, position.x, secondSubCell).mBondAnimations;
+        BondsAnimationSystem::StartBondAppearingAnimation(animations.mDiagonal);
     }
 }
 
@@ -710,12 +957,14 @@ void Field::MakeBonds(SubCell& subCell, const Pht::IVec2& position) {
     auto& bonds = subCell.mBonds;
     if (!bonds.mUp && ShouldBeUpBond(subCell, position)) {
         bonds.mUp = true;
-        BondsAnimationSystem::StartBondAppearingAnimation(subCell.mBondAnimations.mUp);
+        auto& animations = mGrid.GetAnimations(position.y, position.x, subCell).mBondAnimations;
+        BondsAnimationSystem::StartBondAppearingAnimation(animations.mUp);
     }
 
     if (!bonds.mRight && ShouldBeRightBond(subCell, position)) {
         bonds.mRight = true;
-        BondsAnimationSystem::StartBondAppearingAnimation(subCell.mBondAnimations.mRight);
+        auto& animations = mGrid.GetAnimations(position.y, position.x, subCell).mBondAnimations;
+        BondsAnimationSystem::StartBondAppearingAnimation(animations.mRight);
     }
     
     if (!bonds.mDown && ShouldBeDownBond(subCell, position)) {
@@ -839,7 +1088,8 @@ void Field::BreakRedundantBonds(SubCell& subCell, const Pht::IVec2& position) {
     auto& bonds = subCell.mBonds;
     if (bonds.mUpRight && UpRightBondWouldBeRedundant(subCell, position)) {
         bonds.mUpRight = false;
-        BondsAnimationSystem::StartBondDisappearingAnimation(subCell.mBondAnimations.mUpRight);
+        auto& animations = mGrid.GetAnimations(position.y, position.x, subCell).mBondAnimations;
+        BondsAnimationSystem::StartBondDisappearingAnimation(animations.mUpRight);
     }
     
     if (bonds.mDownRight && DownRightBondWouldBeRedundant(subCell, position)) {
@@ -852,7 +1102,8 @@ void Field::BreakRedundantBonds(SubCell& subCell, const Pht::IVec2& position) {
 
     if (bonds.mUpLeft && UpLeftBondWouldBeRedundant(subCell, position)) {
         bonds.mUpLeft = false;
-        BondsAnimationSystem::StartBondDisappearingAnimation(subCell.mBondAnimations.mUpLeft);
+        auto& animations = mGrid.GetAnimations(position.y, position.x, subCell).mBondAnimations;
+        BondsAnimationSystem::StartBondDisappearingAnimation(animations.mUpLeft);
     }
 }
 
@@ -971,8 +1222,9 @@ void Field::MergeTriangleBlocksIntoCube(const Pht::IVec2& position) {
         firstSubCellBonds.mUpRight = true;
     }
     
-    auto& firstSubCellBondAnimations = firstSubCell.mBondAnimations;
-    auto& secondSubCellBondAnimations = cell.mSecondSubCell.mBondAnimations;
+    auto& cellAnimations = mGrid.GetAnimations(position.y, position.x);
+    auto& firstSubCellBondAnimations = cellAnimations.mFirstSubCell.mBondAnimations;
+    auto& secondSubCellBondAnimations = cellAnimations.mSecondSubCell.mBondAnimations;
 
     if (secondSubCellBondAnimations.mUpLeft.IsActive()) {
         firstSubCellBondAnimations.mUpLeft = secondSubCellBondAnimations.mUpLeft;
@@ -991,6 +1243,8 @@ void Field::MergeTriangleBlocksIntoCube(const Pht::IVec2& position) {
     }
 
     cell.mSecondSubCell = SubCell {};
+    cellAnimations.mSecondSubCell = SubCellAnimations {};
+    OnCellChanged(position.y, position.x);
 }
 
 void Field::SetBlocksYPositionAndBounceFlag() {
@@ -1000,11 +1254,11 @@ void Field::SetBlocksYPositionAndBounceFlag() {
             
             auto& firstSubCell = cell.mFirstSubCell;
             firstSubCell.mPosition.y = row;
-            firstSubCell.mFallingBlockAnimation.mShouldBounce = true;
+            firstSubCell.mShouldBounce = true;
 
             auto& secondSubCell = cell.mSecondSubCell;
             secondSubCell.mPosition.y = row;
-            secondSubCell.mFallingBlockAnimation.mShouldBounce = true;
+            secondSubCell.mShouldBounce = true;
         }
     }
 }
@@ -1017,7 +1271,7 @@ Field::RemovedSubCells Field::ClearFilledRows() {
     auto pastHighestVisibleRow {mLowestVisibleRow + GetNumRowsInOneScreen()};
     
     for (auto rowIndex = mLowestVisibleRow; rowIndex < pastHighestVisibleRow; ++rowIndex) {
-        if (RowIsFull(mGrid[rowIndex])) {
+        if (mBitboard.IsRowFull(rowIndex)) {
             for (auto column = 0; column < mNumColumns; ++column) {
                 auto& cell = mGrid[rowIndex][column];
                 auto& firstSubCell = cell.mFirstSubCell;
@@ -1033,6 +1287,8 @@ Field::RemovedSubCells Field::ClearFilledRows() {
                 firstSubCell.mBlockKind = BlockKind::ClearedRowBlock;
                 secondSubCell = SubCell {};
                 secondSubCell.mBlockKind = BlockKind::ClearedRowBlock;
+                mGrid.GetAnimations(rowIndex, column) = CellAnimations {};
+                OnCellChanged(rowIndex, column);
             }
         }
     }
@@ -1055,6 +1311,26 @@ void Field::RemoveClearedRows() {
     }
 }
 
+int Field::RemoveFilledRowsWithoutAnimation() {
+    SetChanged();
+    
+    RemovedSubCells removedSubCells;
+    auto numRemovedRows = 0;
+    auto pastHighestVisibleRow = mLowestVisibleRow + GetNumRowsInOneScreen();
+    
+    for (auto rowIndex = mLowestVisibleRow; rowIndex < pastHighestVisibleRow;) {
+        if (mBitboard.IsRowFull(rowIndex)) {
+            RemoveRowImpl(rowIndex, removedSubCells);
+            removedSubCells.Clear();
+            ++numRemovedRows;
+        } else {
+            ++rowIndex;
+        }
+    }
+    
+    return numRemovedRows;
+}
+
 void Field::RemoveRowImpl(int rowIndex, Field::RemovedSubCells& removedSubCells) {
     for (auto column = 0; column < mNumColumns; ++column) {
         auto& cell = mGrid[rowIndex][column];
@@ -1067,9 +1343,15 @@ void Field::RemoveRowImpl(int rowIndex, Field::RemovedSubCells& removedSubCells)
         
         for (auto row = rowIndex; row < mNumRows - 1; ++row) {
             mGrid[row][column] = mGrid[row + 1][column];
+            mGrid.GetAnimations(row, column) = mGrid.GetAnimations(row + 1, column);
         }
         
         mGrid[mNumRows - 1][column] = Cell {};
+        mGrid.GetAnimations(mNumRows - 1, column) = CellAnimations {};
+        
+        for (auto row = rowIndex; row < mNumRows; ++row) {
+            OnCellChanged(row, column);
+        }
     }
 }
 
@@ -1084,16 +1366,18 @@ void Field::BreakCellDownBonds(int row, int column) {
 void Field::BreakCellUpBonds(int row, int column) {
     if (row >= 0) {
         auto& cell = mGrid[row][column];
-        BreakUpBonds(cell.mFirstSubCell);
-        BreakUpBonds(cell.mSecondSubCell);
+        auto& cellAnimations = mGrid.GetAnimations(row, column);
+        BreakUpBonds(cell.mFirstSubCell, cellAnimations.mFirstSubCell);
+        BreakUpBonds(cell.mSecondSubCell, cellAnimations.mSecondSubCell);
     }
 }
 
 void Field::BreakCellRightBonds(int row, int column) {
     if (column >= 0) {
         auto& cell = mGrid[row][column];
-        BreakRightBonds(cell.mFirstSubCell);
-        BreakRightBonds(cell.mSecondSubCell);
+        auto& cellAnimations = mGrid.GetAnimations(row, column);
+        BreakRightBonds(cell.mFirstSubCell, cellAnimations.mFirstSubCell);
+        BreakRightBonds(cell.mSecondSubCell, cellAnimations.mSecondSubCell);
     }
 }
 
@@ -1211,6 +1495,8 @@ Field::RemovedSubCells Field::RemoveAreaOfSubCells(const Pht::IVec2& areaPos,
                 firstSubCell.mBlockKind != BlockKind::ClearedRowBlock) {
 
                 cell = Cell {};
+                mGrid.GetAnimations(row, column) = CellAnimations {};
+                OnCellChanged(row, column);
             }
         }
     }
@@ -1248,9 +1534,13 @@ Field::RemovedSubCells Field::RemoveAllNonEmptySubCells() {
             ProcessSubCell(removedSubCells, cell.mFirstSubCell, row, column);
             ProcessSubCell(removedSubCells, cell.mSecondSubCell, row, column);
             cell = Cell {};
+            mGrid.GetAnimations(row, column) = CellAnimations {};
         }
     }
     
+    mBitboard.Clear();
+    mHash.Clear();
+    
     return removedSubCells;
 }
 
@@ -1276,7 +1566,9 @@ void Field::RemoveMatchingSubCell(int pieceId,
     if (subCell.mPieceId == pieceId) {
         SaveSubCellAndCancelFill(removedSubCells, subCell, row, column);
         
+        mGrid.GetAnimations(row, column, subCell) = SubCellAnimations {};
         subCell = SubCell {};
+        OnCellChanged(row, column);
     }
 }
 
@@ -1300,18 +1592,22 @@ void Field::SaveSubCellAndCancelFill(Field::RemovedSubCells& removedSubCells,
     if (subCell.mBlockKind != BlockKind::None && subCell.mBlockKind != BlockKind::ClearedRowBlock &&
         row >= mLowestVisibleRow) {
         
+        auto& flashingBlockAnimation =
+            mGrid.GetAnimations(row, column, subCell).mFlashingBlockAnimation;
+        
         RemovedSubCell removedSubCell {
             .mExactPosition = subCell.mPosition,
             .mGridPosition = Pht::IVec2{column, row},
             .mRotation = subCell.mRotation,
             .mBlockKind = subCell.mBlockKind,
             .mColor = subCell.mColor,
-            .mFlashingBlockAnimationState = subCell.mFlashingBlockAnimation.mState,
-            .mPieceId = subCell.mPieceId,
-            .mFlags.mIsGrayLevelBlock = subCell.mIsGrayLevelBlock,
-            .mFlags.mIsAsteroidFragment = subCell.IsAsteroid(),
-            .mFlags.mIsPulledDown = subCell.mIsPulledDown,
+            .mFlashingBlockAnimationState = flashingBlockAnimation.mState,
+            .mPieceId = subCell.mPieceId
         };
+        
+        removedSubCell.mFlags.mIsGrayLevelBlock = subCell.mIsGrayLevelBlock;
+        removedSubCell.mFlags.mIsAsteroidFragment = subCell.IsAsteroid();
+        removedSubCell.mFlags.mIsPulledDown = subCell.mIsPulledDown;
 
         removedSubCells.PushBack(removedSubCell);
     }
@@ -1349,13 +1645,19 @@ void Field::RemovePiece(int pieceId,
                 continue;
             }
             
+            auto& cellAnimations = mGrid.GetAnimations(row, column);
+            
             if (cell.mFirstSubCell.mPieceId == pieceId) {
                 cell.mFirstSubCell = SubCell {};
+                cellAnimations.mFirstSubCell = SubCellAnimations {};
             }
 
             if (cell.mSecondSubCell.mPieceId == pieceId) {
                 cell.mSecondSubCell = SubCell {};
+                cellAnimations.mSecondSubCell = SubCellAnimations {};
             }
+            
+            OnCellChanged(row, column);
         }
     }
 }
@@ -1365,11 +1667,12 @@ FilledRowsResultWithPieceCells Field::MarkFilledRowsAndCountPieceCellsInFilledRo
     auto pastHighestVisibleRow = mLowestVisibleRow + GetNumRowsInOneScreen();
     
     for (auto rowIndex = mLowestVisibleRow; rowIndex < pastHighestVisibleRow; ++rowIndex) {
-        auto& row = mGrid[rowIndex];
-        if (RowIsFull(row)) {
+        auto* row = mGrid[rowIndex];
+        if (mBitboard.IsRowFull(rowIndex)) {
             result.mFilledRowIndices.PushBack(rowIndex);
             
-            for (auto& cell: row) {
+            for (auto column = 0; column < mNumColumns; ++column) {
+                auto& cell = row[column];
                 cell.mIsInFilledRow = true;
                 result.mPieceCellsInFilledRows += CalculatePieceCellContribution(cell.mFirstSubCell,
                                                                                  pieceId);
@@ -1387,11 +1690,12 @@ FilledRowsResultWithGrayLevelCells Field::MarkFilledRowsAndCountGrayLevelCellsIn
     auto pastHighestVisibleRow = mLowestVisibleRow + GetNumRowsInOneScreen();
     
     for (auto rowIndex = mLowestVisibleRow; rowIndex < pastHighestVisibleRow; ++rowIndex) {
-        auto& row = mGrid[rowIndex];
-        if (RowIsFull(row)) {
+        auto* row = mGrid[rowIndex];
+        if (mBitboard.IsRowFull(rowIndex)) {
             result.mFilledRowIndices.PushBack(rowIndex);
             
-            for (auto& cell: row) {
+            for (auto column = 0; column < mNumColumns; ++column) {
+                auto& cell = row[column];
                 cell.mIsInFilledRow = true;
                 result.mGrayLevelCellsInFilledRows += CalculateGrayLevelCellContribution(cell.mFirstSubCell);
                 result.mGrayLevelCellsInFilledRows += CalculateGrayLevelCellContribution(cell.mSecondSubCell);
@@ -1404,9 +1708,9 @@ FilledRowsResultWithGrayLevelCells Field::MarkFilledRowsAndCountGrayLevelCellsIn
 
 void Field::UnmarkFilledRows(const FilledRowIndices& filledRowIndices) {
     for (auto i = 0; i < filledRowIndices.Size(); ++i) {
-        auto& row = mGrid[filledRowIndices.At(i)];
-        for (auto& cell: row) {
-            cell.mIsInFilledRow = false;
+        auto* row = mGrid[filledRowIndices.At(i)];
+        for (auto column = 0; column < mNumColumns; ++column) {
+            row[column].mIsInFilledRow = false;
         }
     }
 }
@@ -2,6 +2,7 @@
 #define Field_hpp
 
 #include <memory>
+#include <cstdint>
 
 // Engine includes.
 #include "Vector.hpp"
@@ -10,6 +11,9 @@
 // Game includes.
 #include "Cell.hpp"
 #include "Piece.hpp"
+#include "Bitboard.hpp"
+#include "FlatCellGrid.hpp"
+#include "ZobristHash.hpp"
 
 namespace RowBlast {
     class Piece;
@@ -48,6 +52,7 @@ namespace RowBlast {
         const CellGrid& mGrid;
         int mNumRows {0};
         int mNumColumns {0};
+        const PieceBitmask* mBitmask {nullptr};
     };
     
     using FilledRowIndices = Pht::StaticVector<int, Piece::maxRows>;
@@ -101,6 +106,7 @@ namespace RowBlast {
         void SetChanged();
         void SaveInTempGrid();
         void RestoreFromTempGrid();
+        void CopyCellsFrom(const Field& other);
         void SetBlocksYPositionAndBounceFlag();
         int DetectCollisionDown(const PieceBlocks& pieceBlocks,
                                 const Pht::IVec2& position,
@@ -145,6 +151,7 @@ namespace RowBlast {
         int AccordingToBlueprintHeight() const;
         RemovedSubCells ClearFilledRows();
         void RemoveClearedRows();
+        int RemoveFilledRowsWithoutAnimation();
         RemovedSubCells RemoveRow(int rowIndex);
         RemovedSubCells RemoveAreaOfSubCells(const Pht::IVec2& areaPos,
                                              const Pht::IVec2& areaSize,
@@ -176,6 +183,26 @@ namespace RowBlast {
             return GetCell(position.y, position.x);
         }
 
+        const CellAnimations& GetCellAnimations(int row, int column) const {
+            assert(row >= 0 && column >= 0 && row < mNumRows && column < mNumColumns);
+            return mGrid.GetAnimations(row, column);
+        }
+
+        CellAnimations& GetCellAnimations(int row, int column) {
+            assert(row >= 0 && column >= 0 && row < mNumRows && column < mNumColumns);
+            return mGrid.GetAnimations(row, column);
+        }
+
+        const SubCellAnimations& GetAnimations(int row, int column, const SubCell& subCell) const {
+            assert(row >= 0 && column >= 0 && row < mNumRows && column < mNumColumns);
+            return mGrid.GetAnimations(row, column, subCell);
+        }
+
+        SubCellAnimations& GetAnimations(int row, int column, const SubCell& subCell) {
+            assert(row >= 0 && column >= 0 && row < mNumRows && column < mNumColumns);
+            return mGrid.GetAnimations(row, column, subCell);
+        }
+
         int GetNumColumns() const {
             return mNumColumns;
         }
@@ -204,11 +231,29 @@ namespace RowBlast {
             return mHasChanged;
         }
         
+        uint64_t GetStateHash() const {
+            return mHash.GetValue();
+        }
+        
     private:
         friend class FieldAnalyzer;
         friend class FieldGravitySystem;
         
-        void CopyGridNoAlloc(CellGrid& to, const CellGrid& from);
+        void RebuildBitboardAndHash();
+        void OnCellChanged(int row, int column);
+        bool IsFreeOfBlocks(const PieceBitmask& pieceBitmask, const Pht::IVec2& position) const;
+        int CalculateFreeDistance(const PieceBitmask& pieceBitmask,
+                                  const Pht::IVec2& position,
+                                  const Pht::IVec2& step) const;
+        int CalculateFreeDistanceDown(const PieceBitmask& pieceBitmask,
+                                      const Pht::IVec2& position) const;
+        int CalculateFreeDistanceRight(const PieceBitmask& pieceBitmask,
+                                       const Pht::IVec2& position) const;
+        int CalculateFreeDistanceLeft(const PieceBitmask& pieceBitmask,
+                                      const Pht::IVec2& position) const;
+        void MarkValidArea(ValidArea& validArea,
+                           const PieceBitmask& pieceBitmask,
+                           const Pht::IVec2& position) const;
         bool IsCellAccordingToBlueprint(int row, int column) const;
         Pht::IVec2 ScanUntilCollision(const PieceBlocks& pieceBlocks,
                                       Pht::IVec2 position,
@@ -217,7 +262,7 @@ namespace RowBlast {
         Pht::IVec2 ScanUntilNoCollision(const PieceBlocks& pieceBlocks,
                                         Pht::IVec2 position,
                                         const Pht::IVec2& step) const;
-        void MakeDiagonalBond(Cell& cell);
+        void MakeDiagonalBond(Cell& cell, const Pht::IVec2& position);
         void MakeBonds(SubCell& subCell, const Pht::IVec2& position);
         bool ShouldBeUpBond(const SubCell& subCell, const Pht::IVec2& position) const;
         bool ShouldBeRightBond(const SubCell& subCell, const Pht::IVec2& position) const;
@@ -252,9 +297,15 @@ namespace RowBlast {
                                       int row,
                                       int column);
 
-        CellGrid mGrid;
-        CellGrid mPreviousGrid;
-        CellGrid mTempGrid;
+        FlatCellGrid mGrid;
+        FlatCellGrid mPreviousGrid;
+        FlatCellGrid mTempGrid;
+        Bitboard mBitboard;
+        Bitboard mPreviousBitboard;
+        Bitboard mTempBitboard;
+        ZobristHash mHash;
+        ZobristHash mPreviousHash;
+        ZobristHash mTempHash;
         std::unique_ptr<BlueprintCellGrid> mBlueprintGrid;
         int mNumColumns {0};
         int mNumRows {0};
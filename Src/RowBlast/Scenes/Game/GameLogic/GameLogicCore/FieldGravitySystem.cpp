@@ -1,8 +1,25 @@
 #include "FieldGravitySystem.hpp"
 
+#include <utility>
+
+// Engine includes.
+#include "Profiler.hpp"
+
 using namespace RowBlast;
 
 namespace {
+    const SubCell fullSubCell {Fill::Full};
+    
+    bool IsBlockingSubCell(const SubCell& lowerSubCell, const SubCell& pieceSubCell) {
+        return !lowerSubCell.IsEmpty() && !lowerSubCell.mIsFound &&
+               (lowerSubCell.IsFull() || pieceSubCell.IsFull());
+    }
+    
+    void SetIsTried(SubCell& subCell, ScanDirection scanDirection) {
+        subCell.mIsFound = false;
+        subCell.mTriedScanDirection = scanDirection;
+    }
+    
     int XMin(const FieldGravitySystem::PieceBlockCoords& pieceBlockCoords) {
         auto xMin = Field::maxNumColumns - 1;
         
@@ -61,21 +78,35 @@ FieldGravitySystem::FieldGravitySystem(Field& field) :
 
 void FieldGravitySystem::Init() {
     mPieceBlockGrid.clear();
+    mPieceBlockAnimations.clear();
     
     std::vector<Cell> emptyRow(mField.GetNumColumns());
+    std::vector<CellAnimations> emptyAnimationsRow(mField.GetNumColumns());
     
     for (auto i = 0; i < mField.GetNumRows(); ++i) {
         mPieceBlockGrid.push_back(emptyRow);
+        mPieceBlockAnimations.push_back(emptyAnimationsRow);
     }
     
     mNumDirtyPieceBlockGridRows = 0;
+    mTriedCells.clear();
 }
 
 void FieldGravitySystem::PullDownLoosePieces() {
+    PHT_PROFILE_ZONE("FieldGravitySystem::PullDownLoosePieces");
+    
     mField.SetChanged();
     mAnyPiecesPulledDown = false;
     
-    for (auto row = mField.mLowestVisibleRow; row < mField.mNumRows; ++row) {
+    // Pieces only move down, so the rows above the highest block stay empty during the pass.
+    auto& bitboard = mField.mBitboard;
+    auto pastHighestOccupiedRow = bitboard.CalculateHighestOccupiedRow() + 1;
+    
+    for (auto row = mField.mLowestVisibleRow; row < pastHighestOccupiedRow; ++row) {
+        if (bitboard.GetOccupied(row) == 0) {
+            continue;
+        }
+        
         for (auto column = 0; column < mField.mNumColumns; ++column) {
             PullDownPiece(row, column, ScanDirection::Right);
         }
@@ -85,7 +116,7 @@ void FieldGravitySystem::PullDownLoosePieces() {
         }
     }
     
-    ResetAllCellsTriedScanDirection();
+    ResetTriedCellsScanDirection();
 }
 
 void FieldGravitySystem::PullDownPiece(int row, int column, ScanDirection scanDirection) {
@@ -105,9 +136,18 @@ void FieldGravitySystem::PullDownPiece(const SubCell& subCell,
         return;
     }
     
+    mPieceBlockCoords.Clear();
+    FindPieceClusterBlocks(subCell.mColor, scanPosition);
+    
+    // Most pieces rest on blocks that cannot move, and those pieces would only be extracted and
+    // landed again at the same position.
+    if (IsPieceBlocksSupported()) {
+        KeepPieceBlocksInPlace(scanDirection);
+        return;
+    }
+    
     Pht::IVec2 piecePosition {0, 0};
-    auto pieceBlocks =
-        ExtractPieceBlocks(piecePosition, subCell.mColor, scanPosition, scanDirection);
+    auto pieceBlocks = ExtractPieceBlocks(piecePosition, scanDirection);
 
     auto isPiecePulledDown = false;
     Pht::IVec2 step {0, -1};
@@ -126,13 +166,80 @@ void FieldGravitySystem::PullDownPiece(const SubCell& subCell,
     }
 }
 
+bool FieldGravitySystem::IsPieceBlocksSupported() const {
+    for (auto i = 0; i < mPieceBlockCoords.Size(); ++i) {
+        auto& position = mPieceBlockCoords.At(i).mPosition;
+        if (position.y - 1 < mField.mLowestVisibleRow) {
+            return true;
+        }
+        
+        auto& cell = mField.mGrid[position.y][position.x];
+        auto& subCell =
+            mPieceBlockCoords.At(i).mIsFirstSubCell ? cell.mFirstSubCell : cell.mSecondSubCell;
+        
+        auto isWholeCell = cell.mFirstSubCell.mIsFound && cell.mSecondSubCell.mIsFound;
+        auto& pieceSubCell = isWholeCell ? fullSubCell : subCell;
+        
+        // The same test as the collision detection does one step down, limited to the cases
+        // where the half cell rules do not apply.
+        auto& lowerCell = mField.mGrid[position.y - 1][position.x];
+        if (IsBlockingSubCell(lowerCell.mFirstSubCell, pieceSubCell) ||
+            IsBlockingSubCell(lowerCell.mSecondSubCell, pieceSubCell)) {
+            
+            return true;
+        }
+    }
+    
+    return false;
+}
+
+void FieldGravitySystem::KeepPieceBlocksInPlace(ScanDirection scanDirection) {
+    // Leaves the field in the same state as ExtractPieceBlocks followed by landing the blocks at
+    // the same position, which can change the order of the sub cells.
+    for (auto i = 0; i < mPieceBlockCoords.Size(); ++i) {
+        auto& coord = mPieceBlockCoords.At(i);
+        auto& position = coord.mPosition;
+        auto& cell = mField.mGrid[position.y][position.x];
+        auto& subCell = coord.mIsFirstSubCell ? cell.mFirstSubCell : cell.mSecondSubCell;
+        if (!subCell.mIsFound) {
+            continue;
+        }
+        
+        auto& otherSubCell = coord.mIsFirstSubCell ? cell.mSecondSubCell : cell.mFirstSubCell;
+        
+        if (otherSubCell.mIsFound) {
+            // The whole cell is landed with the sub cells in the order they were found.
+            if (!coord.mIsFirstSubCell) {
+                auto& cellAnimations = mField.mGrid.GetAnimations(position.y, position.x);
+                std::swap(cell.mFirstSubCell, cell.mSecondSubCell);
+                std::swap(cellAnimations.mFirstSubCell, cellAnimations.mSecondSubCell);
+                mField.OnCellChanged(position.y, position.x);
+            }
+            
+            cell.mIsInFilledRow = false;
+            cell.mIsShiftedDown = false;
+            
+            SetIsTried(cell.mFirstSubCell, scanDirection);
+            SetIsTried(cell.mSecondSubCell, scanDirection);
+        } else {
+            SetIsTried(subCell, scanDirection);
+            
+            if (!coord.mIsFirstSubCell && cell.mFirstSubCell.IsEmpty()) {
+                auto& cellAnimations = mField.mGrid.GetAnimations(position.y, position.x);
+                cellAnimations.mFirstSubCell = cellAnimations.mSecondSubCell;
+                cellAnimations.mSecondSubCell = SubCellAnimations {};
+                cell.mFirstSubCell = subCell;
+                subCell = SubCell {};
+                mField.OnCellChanged(position.y, position.x);
+            }
+        }
+        
+        mTriedCells.push_back(position);
+    }
+}
+
 PieceBlocks FieldGravitySystem::ExtractPieceBlocks(Pht::IVec2& piecePosition,
-                                                   BlockColor color,
-                                                   const Pht::IVec2& scanPosition,
                                                    ScanDirection scanDirection) {
-    mPieceBlockCoords.Clear();
-    FindPieceClusterBlocks(color, scanPosition);
-
     piecePosition.x = XMin(mPieceBlockCoords);
     piecePosition.y = YMin(mPieceBlockCoords);
 
@@ -156,14 +263,21 @@ PieceBlocks FieldGravitySystem::ExtractPieceBlocks(Pht::IVec2& piecePosition,
         fieldSubCell.mIsFound = false;
         fieldSubCell.mTriedScanDirection = scanDirection;
         
+        auto& fieldSubCellAnimations =
+            mField.mGrid.GetAnimations(position.y, position.x, fieldSubCell);
         auto& pieceBlockCell = mPieceBlockGrid[pieceRow][pieceColumn];
+        auto& pieceBlockAnimations = mPieceBlockAnimations[pieceRow][pieceColumn];
         if (pieceBlockCell.mFirstSubCell.IsEmpty()) {
             pieceBlockCell.mFirstSubCell = fieldSubCell;
+            pieceBlockAnimations.mFirstSubCell = fieldSubCellAnimations;
         } else {
             pieceBlockCell.mSecondSubCell = fieldSubCell;
+            pieceBlockAnimations.mSecondSubCell = fieldSubCellAnimations;
         }
         
         fieldSubCell = SubCell {};
+        fieldSubCellAnimations = SubCellAnimations {};
+        mField.OnCellChanged(position.y, position.x);
     }
     
     mNumDirtyPieceBlockGridRows = pieceRowMax + 1;
@@ -247,7 +361,7 @@ void FieldGravitySystem::FindPieceClusterBlocks(BlockColor color, const Pht::IVe
                             }
                             if (!secondUndiscoveredSubCell.IsEmpty() &&
                                 !secondUndiscoveredSubCell.mIsFound) {
-                                FindPieceClusterBlocks(firstUndiscoveredSubCell.mColor,
+                                FindPieceClusterBlocks(secondUndiscoveredSubCell.mColor,
                                                        undiscoveredCellPosition);
                             }
                         }
@@ -350,10 +464,21 @@ void FieldGravitySystem::ResetAllCellsTriedScanDirection() {
     }
 }
 
+void FieldGravitySystem::ResetTriedCellsScanDirection() {
+    for (auto& position: mTriedCells) {
+        auto& cell = mField.mGrid[position.y][position.x];
+        cell.mFirstSubCell.mTriedScanDirection = ScanDirection::None;
+        cell.mSecondSubCell.mTriedScanDirection = ScanDirection::None;
+    }
+    
+    mTriedCells.clear();
+}
+
 void FieldGravitySystem::ClearPieceBlockGrid() {
     for (auto row = 0; row < mNumDirtyPieceBlockGridRows; ++row) {
         for (auto column = 0; column < mField.GetNumColumns(); ++column) {
             mPieceBlockGrid[row][column] = Cell {};
+            mPieceBlockAnimations[row][column] = CellAnimations {};
         }
     }
 }
@@ -371,6 +496,7 @@ void FieldGravitySystem::LandPulledDownPieceBlocks(const PieceBlocks& pieceBlock
             auto row = position.y + pieceRow;
             auto column = position.x + pieceColumn;
             auto& fieldCell = mField.mGrid[row][column];
+            auto& pieceCellAnimations = mPieceBlockAnimations[pieceRow][pieceColumn];
             
             if (pieceCell.mSecondSubCell.IsEmpty()) {
                 auto& fieldSubCell =
@@ -378,15 +504,21 @@ void FieldGravitySystem::LandPulledDownPieceBlocks(const PieceBlocks& pieceBlock
                     fieldCell.mFirstSubCell : fieldCell.mSecondSubCell;
                 
                 fieldSubCell = pieceCell.mFirstSubCell;
+                mField.mGrid.GetAnimations(row, column, fieldSubCell) =
+                    pieceCellAnimations.mFirstSubCell;
                 fieldSubCell.mIsPulledDown = isPieceBlocksPulledDown ? true :
                                              pieceCell.mFirstSubCell.mIsPulledDown;
             } else {
                 fieldCell = pieceCell;
+                mField.mGrid.GetAnimations(row, column) = pieceCellAnimations;
                 fieldCell.mFirstSubCell.mIsPulledDown = isPieceBlocksPulledDown ? true :
                                                         pieceCell.mFirstSubCell.mIsPulledDown;
                 fieldCell.mSecondSubCell.mIsPulledDown = isPieceBlocksPulledDown ? true :
                                                          pieceCell.mSecondSubCell.mIsPulledDown;
             }
+            
+            mField.OnCellChanged(row, column);
+            mTriedCells.push_back(Pht::IVec2 {column, row});
         }
     }
 }
@@ -427,9 +559,16 @@ bool FieldGravitySystem::ShiftGrayBlocksDown(int rowIndex) {
             if (upperCell.mFirstSubCell.mIsGrayLevelBlock && !upperCell.mIsShiftedDown &&
                 lowerCell.IsEmpty()) {
                 
+                auto& lowerCellAnimations = mField.mGrid.GetAnimations(row, column);
+                auto& upperCellAnimations = mField.mGrid.GetAnimations(row + 1, column);
+                
                 lowerCell = upperCell;
                 lowerCell.mIsShiftedDown = true;
                 upperCell = Cell {};
+                lowerCellAnimations = upperCellAnimations;
+                upperCellAnimations = CellAnimations {};
+                mField.OnCellChanged(row, column);
+                mField.OnCellChanged(row + 1, column);
                 anyBlocksShiftedDown = true;
             }
         }
@@ -447,10 +586,12 @@ void FieldGravitySystem::ResetAllCellsShiftedDownFlag() {
 }
 
 void FieldGravitySystem::DetectBlocksThatShouldNotBounce() {
+    PHT_PROFILE_ZONE("FieldGravitySystem::DetectBlocksThatShouldNotBounce");
+    
     for (auto row = mField.mNumRows - 1; row >= mField.mLowestVisibleRow; --row) {
         for (auto column = 0; column < mField.mNumColumns; ++column) {
             auto& subCell = mField.mGrid[row][column].mFirstSubCell;
-            if (subCell.mIsGrayLevelBlock && subCell.mFallingBlockAnimation.mShouldBounce &&
+            if (subCell.mIsGrayLevelBlock && subCell.mShouldBounce &&
                 subCell.mTriedScanDirection == ScanDirection::None && subCell.mPosition.y > row) {
                 
                 Pht::IVec2 gridPosition {column, row};
@@ -474,7 +615,7 @@ FieldGravitySystem::IsBlockStructureFloating(const Pht::IVec2& gridPosition) {
     }
     
     auto& subCell = mField.mGrid[gridPosition.y][gridPosition.x].mFirstSubCell;
-    if (!subCell.mIsGrayLevelBlock || !subCell.mFallingBlockAnimation.mShouldBounce ||
+    if (!subCell.mIsGrayLevelBlock || !subCell.mShouldBounce ||
         subCell.mIsFound || subCell.mTriedScanDirection != ScanDirection::None) {
         
         return IsFloating::Unknown;
@@ -540,13 +681,13 @@ void FieldGravitySystem::SetShouldNotBounce(const Pht::IVec2& gridPosition) {
     }
     
     auto& subCell = mField.mGrid[gridPosition.y][gridPosition.x].mFirstSubCell;
-    if (!subCell.mIsGrayLevelBlock || !subCell.mFallingBlockAnimation.mShouldBounce ||
+    if (!subCell.mIsGrayLevelBlock || !subCell.mShouldBounce ||
         subCell.mTriedScanDirection != ScanDirection::None) {
         
         return;
     }
     
-    subCell.mFallingBlockAnimation.mShouldBounce = false;
+    subCell.mShouldBounce = false;
     
     SetShouldNotBounce(gridPosition + Pht::IVec2 {0, 1});
     SetShouldNotBounce(gridPosition + Pht::IVec2 {1, 0});
@@ -1,6 +1,8 @@
 #ifndef FieldGravitySystem_hpp
 #define FieldGravitySystem_hpp
 
+#include <vector>
+
 // Engine includes.
 #include "Vector.hpp"
 
@@ -40,14 +42,14 @@ namespace RowBlast {
         void PullDownPiece(const SubCell& subCell,
                            const Pht::IVec2& position,
                            ScanDirection scanDirection);
-        PieceBlocks ExtractPieceBlocks(Pht::IVec2& piecePosition,
-                                       BlockColor color,
-                                       const Pht::IVec2& scanPosition,
-                                       ScanDirection scanDirection);
+        bool IsPieceBlocksSupported() const;
+        void KeepPieceBlocksInPlace(ScanDirection scanDirection);
+        PieceBlocks ExtractPieceBlocks(Pht::IVec2& piecePosition, ScanDirection scanDirection);
         void FindPieceClusterBlocks(BlockColor color, const Pht::IVec2& position);
         void FindPieceBlocks(BlockColor color, const Pht::IVec2& position);
         void FindAsteroidCells(const Pht::IVec2& position);
         void ResetAllCellsTriedScanDirection();
+        void ResetTriedCellsScanDirection();
         void ClearPieceBlockGrid();
         void LandPulledDownPieceBlocks(const PieceBlocks& pieceBlocks,
                                        const Pht::IVec2& position,
@@ -62,8 +64,10 @@ namespace RowBlast {
 
         Field& mField;
         CellGrid mPieceBlockGrid;
+        std::vector<std::vector<CellAnimations>> mPieceBlockAnimations;
         int mNumDirtyPieceBlockGridRows {0};
         PieceBlockCoords mPieceBlockCoords;
+        std::vector<Pht::IVec2> mTriedCells;
         bool mAnyPiecesPulledDown {false};
     };
 }
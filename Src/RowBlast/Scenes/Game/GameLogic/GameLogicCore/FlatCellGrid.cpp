@@ -0,0 +1,60 @@
+#include "FlatCellGrid.hpp"
+
+#include <algorithm>
+#include <assert.h>
+
+using namespace RowBlast;
+
+void FlatCellGrid::Init(int numRows, int numColumns) {
+    mNumRows = numRows;
+    mNumColumns = numColumns;
+    mCells.assign(numRows * numColumns, Cell {});
+    mAnimations.assign(numRows * numColumns, CellAnimations {});
+}
+
+void FlatCellGrid::Assign(const CellGrid& cellGrid) {
+    assert(static_cast<int>(cellGrid.size()) == mNumRows);
+    
+    auto* cells = mCells.data();
+    
+    for (auto& row: cellGrid) {
+        assert(static_cast<int>(row.size()) == mNumColumns);
+        cells = std::copy(row.begin(), row.end(), cells);
+    }
+    
+    ResetAnimations();
+}
+
+void FlatCellGrid::CopyFrom(const FlatCellGrid& other) {
+    CopyCellsFrom(other);
+    std::copy(other.mAnimations.begin(), other.mAnimations.end(), mAnimations.begin());
+}
+
+void FlatCellGrid::CopyCellsFrom(const FlatCellGrid& other) {
+    assert(other.mNumRows == mNumRows && other.mNumColumns == mNumColumns);
+    std::copy(other.mCells.begin(), other.mCells.end(), mCells.begin());
+}
+
+void FlatCellGrid::ResetAnimations() {
+    std::fill(mAnimations.begin(), mAnimations.end(), CellAnimations {});
+}
+
+SubCellAnimations& FlatCellGrid::GetAnimations(int row, int column, const SubCell& subCell) {
+    auto cellIndex = row * mNumColumns + column;
+    auto& cell = mCells[cellIndex];
+    auto& animations = mAnimations[cellIndex];
+    assert(&subCell == &cell.mFirstSubCell || &subCell == &cell.mSecondSubCell);
+    
+    return &subCell == &cell.mFirstSubCell ? animations.mFirstSubCell : animations.mSecondSubCell;
+}
+
+const SubCellAnimations& FlatCellGrid::GetAnimations(int row,
+                                                     int column,
+                                                     const SubCell& subCell) const {
+    auto cellIndex = row * mNumColumns + column;
+    auto& cell = mCells[cellIndex];
+    auto& animations = mAnimations[cellIndex];
+    assert(&subCell == &cell.mFirstSubCell || &subCell == &cell.mSecondSubCell);
+    
+    return &subCell == &cell.mFirstSubCell ? animations.mFirstSubCell : animations.mSecondSubCell;
+}
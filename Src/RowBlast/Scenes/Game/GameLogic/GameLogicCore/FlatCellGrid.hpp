@@ -0,0 +1,49 @@
+#ifndef FlatCellGrid_hpp
+#define FlatCellGrid_hpp
+
+#include <vector>
+
+// Game includes.
+#include "Cell.hpp"
+
+namespace RowBlast {
+    // The cells of the field stored row by row in one contiguous buffer. Indexing a row gives a
+    // pointer to its first cell so that cells are accessed as grid[row][column]. The animations of
+    // the cells are stored in a parallel buffer, so copying only the cells leaves them out.
+    class FlatCellGrid {
+    public:
+        void Init(int numRows, int numColumns);
+        void Assign(const CellGrid& cellGrid);
+        void CopyFrom(const FlatCellGrid& other);
+        void CopyCellsFrom(const FlatCellGrid& other);
+        void ResetAnimations();
+        
+        // The sub cell has to be one of the sub cells of the cell at the row and column.
+        SubCellAnimations& GetAnimations(int row, int column, const SubCell& subCell);
+        const SubCellAnimations& GetAnimations(int row, int column, const SubCell& subCell) const;
+        
+        Cell* operator[](int row) {
+            return &mCells[row * mNumColumns];
+        }
+
+        const Cell* operator[](int row) const {
+            return &mCells[row * mNumColumns];
+        }
+        
+        CellAnimations& GetAnimations(int row, int column) {
+            return mAnimations[row * mNumColumns + column];
+        }
+
+        const CellAnimations& GetAnimations(int row, int column) const {
+            return mAnimations[row * mNumColumns + column];
+        }
+        
+    private:
+        std::vector<Cell> mCells;
+        std::vector<CellAnimations> mAnimations;
+        int mNumRows {0};
+        int mNumColumns {0};
+    };
+}
+
+#endif
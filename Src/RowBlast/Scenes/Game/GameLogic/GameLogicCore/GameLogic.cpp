@@ -9,6 +9,7 @@
 #include "InputEvent.hpp"
 #include "MathUtils.hpp"
 #include "IAudio.hpp"
+#include "Profiler.hpp"
 
 // Game includes.
 #include "Level.hpp"
@@ -50,7 +51,8 @@ namespace {
         return {
             pieceType.GetGrid(fallingPiece.GetRotation()),
             pieceType.GetGridNumRows(),
-            pieceType.GetGridNumColumns()
+            pieceType.GetGridNumColumns(),
+            &pieceType.GetBitmask(fallingPiece.GetRotation())
         };
     }
 
@@ -60,7 +62,8 @@ namespace {
         return {
             pieceType.GetGrid(draggedPiece.GetRotation()),
             pieceType.GetGridNumRows(),
-            pieceType.GetGridNumColumns()
+            pieceType.GetGridNumColumns(),
+            &pieceType.GetBitmask(draggedPiece.GetRotation())
         };
     }
 
@@ -188,6 +191,8 @@ void GameLogic::Init(const Level& level) {
 }
 
 GameLogic::Result GameLogic::Update(bool shouldUpdateLogic, bool shouldUndoMove) {
+    PHT_PROFILE_ZONE("GameLogic::Update");
+    
     UpdateInAnyState(shouldUndoMove);
 
     switch (mState) {
@@ -1198,7 +1203,8 @@ void GameLogic::RotateFallingPiece(const Pht::TouchEvent& touchEvent) {
     PieceBlocks pieceBlocks {
         pieceType.GetGrid(newRotation),
         pieceType.GetGridNumRows(),
-        pieceType.GetGridNumColumns()
+        pieceType.GetGridNumColumns(),
+        &pieceType.GetBitmask(newRotation)
     };
     
     auto position = mFallingPiece.GetIntPosition();
@@ -1344,7 +1350,8 @@ bool GameLogic::IsThereRoomToSwitchPiece(const Piece& pieceType, Rotation rotati
     PieceBlocks pieceBlocks {
         pieceType.GetGrid(rotation),
         pieceType.GetGridNumRows(),
-        pieceType.GetGridNumColumns()
+        pieceType.GetGridNumColumns(),
+        &pieceType.GetBitmask(rotation)
     };
  
     auto position = CalculateFallingPieceSpawnPos(pieceType, FallingPieceSpawnReason::Switch);
@@ -0,0 +1,42 @@
+#ifndef GhostPieceBorder_hpp
+#define GhostPieceBorder_hpp
+
+#include <vector>
+
+// Engine includes.
+#include "Vector.hpp"
+
+namespace RowBlast {
+    enum class BorderSegmentKind {
+        Start,
+        Upper,
+        Right,
+        RightForTriangle,
+        Lower,
+        LowerForTriangle,
+        LowerForPyramid,
+        Left,
+        UpperLeftConcaveCorner,
+        LowerLeftConcaveCorner,
+        UpperRightConcaveCorner,
+        LowerRightConcaveCorner,
+        ConnectionForSeven,
+        ConnectionForMirroredSeven,
+        UpperLeftTiltForTriangle,
+        UpperLeftTiltForPyramid,
+        UpperRightTiltForPyramid,
+        LowerRightTiltForDiamond,
+        UpperRightTiltForDiamond,
+        UpperLeftTiltForDiamond,
+        LowerLeftTiltForDiamond
+    };
+    
+    struct GhostPieceBorderSegment {
+        Pht::IVec2 mPosition;
+        BorderSegmentKind mKind;
+    };
+    
+    using GhostPieceBorder = std::vector<GhostPieceBorderSegment>;
+}
+
+#endif
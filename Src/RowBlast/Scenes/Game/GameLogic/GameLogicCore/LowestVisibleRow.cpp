@@ -0,0 +1,79 @@
+#include "LowestVisibleRow.hpp"
+
+// Game includes.
+#include "Field.hpp"
+
+using namespace RowBlast;
+
+namespace {
+    constexpr auto numVisibleLevelRows = 6;
+    constexpr auto numVisibleRowsBelowAsteroid = 7;
+
+    int CalculatePreferredClearObjective(const Field& field) {
+        auto highestLevelBlock = field.CalculateHighestLevelBlock();
+        auto lowestVisibleRowBasedOnLevelBlocks =
+            highestLevelBlock.HasValue() ? highestLevelBlock.GetValue() + 1 - numVisibleLevelRows : 0;
+
+        if (lowestVisibleRowBasedOnLevelBlocks < 0) {
+            lowestVisibleRowBasedOnLevelBlocks = 0;
+        }
+        
+        auto lowestVisibleRowBasedOnBlocksInSpawningArea = lowestVisibleRowBasedOnLevelBlocks;
+        
+        for (;;) {
+            auto highestBlockInSpawningArea =
+                field.CalculateHighestBlockInSpawningArea(lowestVisibleRowBasedOnBlocksInSpawningArea);
+            
+            if (highestBlockInSpawningArea.HasValue()) {
+                lowestVisibleRowBasedOnBlocksInSpawningArea = highestBlockInSpawningArea.GetValue() +
+                                                              1 - Field::numRowsUpToSpawningArea;
+            } else {
+                break;
+            }
+        }
+        
+        auto highestPossibleLowestVisibleRow = field.GetNumRows() - field.GetNumRowsInOneScreen();
+        if (lowestVisibleRowBasedOnBlocksInSpawningArea > highestPossibleLowestVisibleRow) {
+            lowestVisibleRowBasedOnBlocksInSpawningArea = highestPossibleLowestVisibleRow;
+        }
+        
+        if (lowestVisibleRowBasedOnBlocksInSpawningArea > lowestVisibleRowBasedOnLevelBlocks) {
+            return lowestVisibleRowBasedOnBlocksInSpawningArea;
+        }
+        
+        return lowestVisibleRowBasedOnLevelBlocks;
+    }
+
+    int CalculatePreferredAsteroidObjective(const Field& field) {
+        auto asteroidRow = field.CalculateAsteroidRow();
+        auto lowestVisibleRow =
+            asteroidRow.HasValue() ? asteroidRow.GetValue() - numVisibleRowsBelowAsteroid : 0;
+        
+        if (lowestVisibleRow < 0) {
+            lowestVisibleRow = 0;
+        }
+        
+        return lowestVisibleRow;
+    }
+
+    int CalculatePreferredBuildObjective(const Field& field) {
+        auto preferredLowestVisibleRow = field.AccordingToBlueprintHeight();
+        auto lowestVisibleRowMax = field.GetNumRows() - field.GetNumRowsInOneScreen();
+        if (preferredLowestVisibleRow > lowestVisibleRowMax) {
+            preferredLowestVisibleRow = lowestVisibleRowMax;
+        }
+        
+        return preferredLowestVisibleRow;
+    }
+}
+
+int LowestVisibleRow::CalculatePreferred(const Field& field, Level::Objective levelObjective) {
+    switch (levelObjective) {
+        case Level::Objective::Clear:
+            return CalculatePreferredClearObjective(field);
+        case Level::Objective::BringDownTheAsteroid:
+            return CalculatePreferredAsteroidObjective(field);
+        case Level::Objective::Build:
+            return CalculatePreferredBuildObjective(field);
+    }
+}
@@ -0,0 +1,15 @@
+#ifndef LowestVisibleRow_hpp
+#define LowestVisibleRow_hpp
+
+// Game includes.
+#include "Level.hpp"
+
+namespace RowBlast {
+    class Field;
+    
+    namespace LowestVisibleRow {
+        int CalculatePreferred(const Field& field, Level::Objective levelObjective);
+    }
+}
+
+#endif
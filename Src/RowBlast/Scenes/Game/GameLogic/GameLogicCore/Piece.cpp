@@ -5,6 +5,8 @@
 
 using namespace RowBlast;
 
+static_assert(PieceBitmask::maxRows == Piece::maxRows, "Piece bitmask must cover the piece grid");
+
 namespace {
     Fill RotateCellFillClockwise90Deg(Fill fill) {
         switch (fill) {
@@ -69,6 +71,10 @@ const CellGrid& Piece::GetGrid(Rotation rotation) const {
     return mGrids[static_cast<int>(rotation)];
 }
 
+const PieceBitmask& Piece::GetBitmask(Rotation rotation) const {
+    return mBitmasks[static_cast<int>(rotation)];
+}
+
 const ClickGrid& Piece::GetClickGrid(Rotation rotation) const {
     return mClickGrids[static_cast<int>(rotation)];
 }
@@ -146,23 +152,27 @@ bool Piece::NeedsDownAdjustmentInHud() const {
 }
 
 Pht::RenderableObject* Piece::GetDraggedPieceRenderable() const  {
-    return mDraggedPieceRenderable.get();
+    return mRenderables.mDraggedPiece;
 }
 
 Pht::RenderableObject* Piece::GetHighlightedDraggedPieceRenderable() const  {
-    return mHighlightedDraggedPieceRenderable.get();
+    return mRenderables.mHighlightedDraggedPiece;
 }
 
 Pht::RenderableObject* Piece::GetShadowRenderable() const  {
-    return mShadowRenderable.get();
+    return mRenderables.mShadow;
 }
 
 Pht::RenderableObject* Piece::GetGhostPieceRenderable() const {
-    return mGhostPieceRenderable.get();
+    return mRenderables.mGhostPiece;
 }
 
 Pht::RenderableObject* Piece::GetHighlightedGhostPieceRenderable() const {
-    return mHighlightedGhostPieceRenderable.get();
+    return mRenderables.mHighlightedGhostPiece;
+}
+
+void Piece::SetRenderables(const Renderables& renderables) {
+    mRenderables = renderables;
 }
 
 void Piece::InitGrids(const FillGrid& fillGrid,
@@ -180,6 +190,7 @@ void Piece::InitGrids(const FillGrid& fillGrid,
     assert(mClickGridNumRows == 2 * mGridNumRows && mClickGridNumColumns == 2 * mGridNumColumns);
     
     InitCellGrids(fillGrid, blockColor, isIndivisible);
+    InitBitmasks();
     InitClickGrids(clickGrid);
     
     mRightOverhangCheckPositions.resize(4);
@@ -250,7 +261,6 @@ CellGrid Piece::InitCellGrid(const Piece::FillGrid& fillGrid,
             subCell.mBonds = MakeBonds(row, column, fillGrid);
             subCell.mBlockKind = ToBlockKind(subCell.mFill);
             subCell.mColor = blockColor;
-            subCell.mFlashingBlockAnimation.mState = FlashingBlockAnimationComponent::State::Waiting;
             subCell.mIsPartOfIndivisiblePiece = isIndivisible;
         }
     }
@@ -275,6 +285,14 @@ CellGrid Piece::RotateGridClockwise90Deg(const CellGrid& grid, Rotation newRotat
     return result;
 }
 
+void Piece::InitBitmasks() {
+    mBitmasks.resize(4);
+    
+    for (auto rotation = 0; rotation < 4; ++rotation) {
+        mBitmasks[rotation].Init(mGrids[rotation], mGridNumRows, mGridNumColumns);
+    }
+}
+
 void Piece::InitClickGrids(const ClickGrid& clickGrid) {
     auto deg0Grid = clickGrid;
     std::reverse(deg0Grid.begin(), deg0Grid.end());
@@ -315,24 +333,9 @@ void Piece::SetDuplicateMoveCheck(Rotation rotation, const DuplicateMoveCheck& d
     mDuplicateMoveChecks[static_cast<int>(rotation)] = duplicateMoveCheck;
 }
 
-void Piece::SetDraggedPieceRenderable(std::unique_ptr<Pht::RenderableObject> renderable) {
-    mDraggedPieceRenderable = std::move(renderable);
-}
-
-void Piece::SetHighlightedDraggedPieceRenderable(std::unique_ptr<Pht::RenderableObject> renderable) {
-    mHighlightedDraggedPieceRenderable = std::move(renderable);
-}
-
-void Piece::SetShadowRenderable(std::unique_ptr<Pht::RenderableObject> renderable) {
-    mShadowRenderable = std::move(renderable);
-}
-
-void Piece::SetGhostPieceRenderable(std::unique_ptr<Pht::RenderableObject> renderable) {
-    mGhostPieceRenderable = std::move(renderable);
-}
-
-void Piece::SetHighlightedGhostPieceRenderable(std::unique_ptr<Pht::RenderableObject> renderable) {
-    mHighlightedGhostPieceRenderable = std::move(renderable);
+void Piece::SetGhostPieceBorder(const GhostPieceBorder& border, const Pht::IVec2& gridSize) {
+    mGhostPieceBorder = border;
+    mGhostPieceGridSize = gridSize;
 }
 
 Bonds Piece::MakeBonds(int row, int column, const Piece::FillGrid& fillGrid) {
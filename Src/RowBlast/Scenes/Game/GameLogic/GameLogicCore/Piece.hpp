@@ -7,10 +7,15 @@
 // Engine includes.
 #include "Vector.hpp"
 #include "Optional.hpp"
-#include "RenderableObject.hpp"
 
 // Game includes.
 #include "Cell.hpp"
+#include "Bitboard.hpp"
+#include "GhostPieceBorder.hpp"
+
+namespace Pht {
+    class RenderableObject;
+}
 
 namespace RowBlast {
     using ClickGrid = std::vector<std::vector<int>>;
@@ -38,11 +43,22 @@ namespace RowBlast {
             Kind mKind;
             Pht::IVec2 mPosition;
         };
+        
+        // The renderables are owned by LevelResources so that the piece geometry does not depend on
+        // the renderer.
+        struct Renderables {
+            Pht::RenderableObject* mDraggedPiece {nullptr};
+            Pht::RenderableObject* mHighlightedDraggedPiece {nullptr};
+            Pht::RenderableObject* mShadow {nullptr};
+            Pht::RenderableObject* mGhostPiece {nullptr};
+            Pht::RenderableObject* mHighlightedGhostPiece {nullptr};
+        };
 
         Piece();
         virtual ~Piece() {}
         
         const CellGrid& GetGrid(Rotation rotation) const;
+        const PieceBitmask& GetBitmask(Rotation rotation) const;
         const ClickGrid& GetClickGrid(Rotation rotation) const;
         const Pht::IVec2& GetRightOverhangCheckPosition(Rotation rotation) const;
         const Pht::IVec2& GetLeftOverhangCheckPosition(Rotation rotation) const;
@@ -59,6 +75,7 @@ namespace RowBlast {
         Pht::RenderableObject* GetShadowRenderable() const;
         Pht::RenderableObject* GetGhostPieceRenderable() const;
         Pht::RenderableObject* GetHighlightedGhostPieceRenderable() const;
+        void SetRenderables(const Renderables& renderables);
         
         virtual bool IsBomb() const;
         virtual bool IsRowBomb() const;
@@ -101,6 +118,14 @@ namespace RowBlast {
             return mNumRotations > 1;
         }
         
+        const GhostPieceBorder& GetGhostPieceBorder() const {
+            return mGhostPieceBorder;
+        }
+        
+        const Pht::IVec2& GetGhostPieceGridSize() const {
+            return mGhostPieceGridSize;
+        }
+        
         using FillGrid = std::vector<std::vector<Fill>>;
         
         static constexpr int maxRows {5};
@@ -115,11 +140,7 @@ namespace RowBlast {
         void SetPreviewCellSize(float previewCellSize);
         void SetNumRotations(int numRotations);
         void SetDuplicateMoveCheck(Rotation rotation, const DuplicateMoveCheck& duplicateMoveCheck);
-        void SetDraggedPieceRenderable(std::unique_ptr<Pht::RenderableObject> renderable);
-        void SetHighlightedDraggedPieceRenderable(std::unique_ptr<Pht::RenderableObject> renderable);
-        void SetShadowRenderable(std::unique_ptr<Pht::RenderableObject> renderable);
-        void SetGhostPieceRenderable(std::unique_ptr<Pht::RenderableObject> renderable);
-        void SetHighlightedGhostPieceRenderable(std::unique_ptr<Pht::RenderableObject> renderable);
+        void SetGhostPieceBorder(const GhostPieceBorder& border, const Pht::IVec2& gridSize);
         
     private:
         void InitCellGrids(const Piece::FillGrid& fillGrid,
@@ -136,6 +157,7 @@ namespace RowBlast {
         void AddExtremityCheckPositions(Rotation rotation);
         void AddTiltedBondCheck(Rotation rotation);
         void AddDimensions(Rotation rotation);
+        void InitBitmasks();
         void InitClickGrids(const ClickGrid& clickGrid);
         ClickGrid RotateClickGridClockwise90Deg(const ClickGrid& grid, Rotation newRotation);
         void AddButtonPositionAndSize(Rotation rotation);
@@ -143,16 +165,15 @@ namespace RowBlast {
         int mGridNumRows {0};
         int mGridNumColumns {0};
         std::vector<CellGrid> mGrids;
+        std::vector<PieceBitmask> mBitmasks;
         int mClickGridNumRows {0};
         int mClickGridNumColumns {0};
         BlockColor mColor {BlockColor::None};
         std::vector<ClickGrid> mClickGrids;
         int mNumRotations {4};
-        std::unique_ptr<Pht::RenderableObject> mDraggedPieceRenderable;
-        std::unique_ptr<Pht::RenderableObject> mHighlightedDraggedPieceRenderable;
-        std::unique_ptr<Pht::RenderableObject> mShadowRenderable;
-        std::unique_ptr<Pht::RenderableObject> mGhostPieceRenderable;
-        std::unique_ptr<Pht::RenderableObject> mHighlightedGhostPieceRenderable;
+        GhostPieceBorder mGhostPieceBorder;
+        Pht::IVec2 mGhostPieceGridSize {0, 0};
+        Renderables mRenderables;
         float mPreviewCellSize {1.0f};
         std::vector<Pht::IVec2> mRightOverhangCheckPositions;
         std::vector<Pht::IVec2> mLeftOverhangCheckPositions;
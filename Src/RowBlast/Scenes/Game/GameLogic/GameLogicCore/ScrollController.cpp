@@ -7,12 +7,11 @@
 // Game includes.
 #include "Field.hpp"
 #include "IGameLogic.hpp"
+#include "LowestVisibleRow.hpp"
 
 using namespace RowBlast;
 
 namespace {
-    constexpr auto numVisibleLevelRows = 6;
-    constexpr auto numVisibleRowsBelowAsteroid = 7;
     constexpr auto scrollTime = 0.72f;
     constexpr auto deaccelerationStartTime = 0.36f;
     constexpr auto waitTimeClearObjective = 1.0f;
@@ -160,71 +159,7 @@ void ScrollController::UpdateInIdleState() {
 }
 
 int ScrollController::CalculatePreferredLowestVisibleRow() const {
-    switch (mLevelObjective) {
-        case Level::Objective::Clear:
-            return CalculatePreferredLowestVisibleRowClearObjective();
-        case Level::Objective::BringDownTheAsteroid:
-            return CalculatePreferredLowestVisibleRowAsteroidObjective();
-        case Level::Objective::Build:
-            return CalculatePreferredLowestVisibleRowBuildObjective();
-    }
-}
-
-int ScrollController::CalculatePreferredLowestVisibleRowClearObjective() const {
-    auto highestLevelBlock = mField.CalculateHighestLevelBlock();
-    auto lowestVisibleRowBasedOnLevelBlocks =
-        highestLevelBlock.HasValue() ? highestLevelBlock.GetValue() + 1 - numVisibleLevelRows : 0;
-
-    if (lowestVisibleRowBasedOnLevelBlocks < 0) {
-        lowestVisibleRowBasedOnLevelBlocks = 0;
-    }
-    
-    auto lowestVisibleRowBasedOnBlocksInSpawningArea = lowestVisibleRowBasedOnLevelBlocks;
-    
-    for (;;) {
-        auto highestBlockInSpawningArea =
-            mField.CalculateHighestBlockInSpawningArea(lowestVisibleRowBasedOnBlocksInSpawningArea);
-        
-        if (highestBlockInSpawningArea.HasValue()) {
-            lowestVisibleRowBasedOnBlocksInSpawningArea = highestBlockInSpawningArea.GetValue() +
-                                                          1 - Field::numRowsUpToSpawningArea;
-        } else {
-            break;
-        }
-    }
-    
-    auto highestPossibleLowestVisibleRow = mField.GetNumRows() - mField.GetNumRowsInOneScreen();
-    if (lowestVisibleRowBasedOnBlocksInSpawningArea > highestPossibleLowestVisibleRow) {
-        lowestVisibleRowBasedOnBlocksInSpawningArea = highestPossibleLowestVisibleRow;
-    }
-    
-    if (lowestVisibleRowBasedOnBlocksInSpawningArea > lowestVisibleRowBasedOnLevelBlocks) {
-        return lowestVisibleRowBasedOnBlocksInSpawningArea;
-    }
-    
-    return lowestVisibleRowBasedOnLevelBlocks;
-}
-
-int ScrollController::CalculatePreferredLowestVisibleRowAsteroidObjective() const {
-    auto asteroidRow = mField.CalculateAsteroidRow();
-    auto lowestVisibleRow =
-        asteroidRow.HasValue() ? asteroidRow.GetValue() - numVisibleRowsBelowAsteroid : 0;
-    
-    if (lowestVisibleRow < 0) {
-        lowestVisibleRow = 0;
-    }
-    
-    return lowestVisibleRow;
-}
-
-int ScrollController::CalculatePreferredLowestVisibleRowBuildObjective() const {
-    auto preferredLowestVisibleRow = mField.AccordingToBlueprintHeight();
-    auto lowestVisibleRowMax = mField.GetNumRows() - mField.GetNumRowsInOneScreen();
-    if (preferredLowestVisibleRow > lowestVisibleRowMax) {
-        preferredLowestVisibleRow = lowestVisibleRowMax;
-    }
-    
-    return preferredLowestVisibleRow;
+    return LowestVisibleRow::CalculatePreferred(mField, mLevelObjective);
 }
 
 void ScrollController::StartScrollingDown(float preferredLowestVisibleRow) {
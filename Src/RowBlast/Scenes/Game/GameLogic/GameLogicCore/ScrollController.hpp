@@ -59,9 +59,6 @@ namespace RowBlast {
         void UpdateInLevelOverviewScrollStateClearObjective(float dt);
         void UpdateInLevelOverviewScrollStateBuildObjective(float dt);
         void UpdateInIdleState();
-        int CalculatePreferredLowestVisibleRowClearObjective() const;
-        int CalculatePreferredLowestVisibleRowAsteroidObjective() const;
-        int CalculatePreferredLowestVisibleRowBuildObjective() const;
         void StartScrollingDown(float preferredLowestVisibleRow);
         void StartScrollingUp(float preferredLowestVisibleRow);
         void UpdateInScrollingState();
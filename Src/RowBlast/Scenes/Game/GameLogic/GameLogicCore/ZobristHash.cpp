@@ -0,0 +1,59 @@
+#include "ZobristHash.hpp"
+
+#include <algorithm>
+
+using namespace RowBlast;
+
+namespace {
+    constexpr uint64_t keySeed {0x5EED5EED5EED5EED};
+    
+    uint64_t Mix(uint64_t value) {
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+        return value ^ (value >> 31);
+    }
+    
+    uint64_t PackSubCell(const SubCell& subCell) {
+        return static_cast<uint64_t>(subCell.mFill) |
+               static_cast<uint64_t>(subCell.mBlockKind) << 3 |
+               static_cast<uint64_t>(subCell.mColor) << 7 |
+               static_cast<uint64_t>(subCell.mIsGrayLevelBlock) << 10 |
+               static_cast<uint64_t>(static_cast<uint32_t>(subCell.mPieceId)) << 11;
+    }
+    
+    uint64_t CalculateSubCellValue(int subCellIndex, const SubCell& subCell) {
+        if (subCell.IsEmpty()) {
+            return 0;
+        }
+        
+        // The key only depends on the position, so hashes of fields of the same size can be
+        // compared.
+        auto key = Mix(keySeed + static_cast<uint64_t>(subCellIndex));
+        return Mix(key ^ PackSubCell(subCell));
+    }
+}
+
+void ZobristHash::Init(int numRows, int numColumns) {
+    mCellValues.resize(numRows * numColumns);
+    mNumColumns = numColumns;
+    Clear();
+}
+
+void ZobristHash::Clear() {
+    std::fill(mCellValues.begin(), mCellValues.end(), 0);
+    mValue = 0;
+}
+
+void ZobristHash::UpdateCell(int row, int column, const Cell& cell) {
+    auto cellIndex = row * mNumColumns + column;
+    auto& cellValue = mCellValues[cellIndex];
+    
+    mValue ^= cellValue;
+    cellValue = CalculateCellValue(cellIndex, cell);
+    mValue ^= cellValue;
+}
+
+uint64_t ZobristHash::CalculateCellValue(int cellIndex, const Cell& cell) const {
+    return CalculateSubCellValue(cellIndex * 2, cell.mFirstSubCell) ^
+           CalculateSubCellValue(cellIndex * 2 + 1, cell.mSecondSubCell);
+}
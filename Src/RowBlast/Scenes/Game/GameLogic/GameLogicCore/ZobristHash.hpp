@@ -0,0 +1,34 @@
+#ifndef ZobristHash_hpp
+#define ZobristHash_hpp
+
+#include <cstdint>
+#include <vector>
+
+// Game includes.
+#include "Cell.hpp"
+
+namespace RowBlast {
+    // Incrementally maintained hash of the fill, color, block kind, gray level flag and piece ID of
+    // all sub cells in a field. Each sub cell position has a pseudo random key which is combined
+    // with the sub cell contents, and the field hash is the XOR of the resulting values so that a
+    // cell can be updated by XORing out its old value and XORing in the new one.
+    class ZobristHash {
+    public:
+        void Init(int numRows, int numColumns);
+        void Clear();
+        void UpdateCell(int row, int column, const Cell& cell);
+        
+        uint64_t GetValue() const {
+            return mValue;
+        }
+        
+    private:
+        uint64_t CalculateCellValue(int cellIndex, const Cell& cell) const;
+        
+        std::vector<uint64_t> mCellValues;
+        uint64_t mValue {0};
+        int mNumColumns {0};
+    };
+}
+
+#endif
@@ -1,15 +1,8 @@
 #include "BPiece.hpp"
 
-// Engine includes.
-#include "IEngine.hpp"
-
-// Game includes.
-#include "CommonResources.hpp"
-#include "GhostPieceProducer.hpp"
-
 using namespace RowBlast;
 
-BPiece::BPiece(Pht::IEngine& engine, const CommonResources& commonResources) {
+BPiece::BPiece() {
     FillGrid fillGrid = {
         {Fill::Empty, Fill::Full,  Fill::Full},
         {Fill::Full,  Fill::Full,  Fill::Full},
@@ -39,13 +32,7 @@ BPiece::BPiece(Pht::IEngine& engine, const CommonResources& commonResources) {
         {{0, 1}, BorderSegmentKind::Left},
     };
     
-    GhostPieceProducer ghostPieceProducer {engine, Pht::IVec2{3, 3}, commonResources};
-    auto renderables = ghostPieceProducer.DrawRenderables(border, GetColor());
-    SetDraggedPieceRenderable(std::move(renderables.mDraggedPiece));
-    SetHighlightedDraggedPieceRenderable(std::move(renderables.mHighlightedDraggedPiece));
-    SetShadowRenderable(std::move(renderables.mShadow));
-    SetGhostPieceRenderable(std::move(renderables.mGhostPiece));
-    SetHighlightedGhostPieceRenderable(std::move(renderables.mHighlightedGhostPiece));
+    SetGhostPieceBorder(border, Pht::IVec2{3, 3});
 }
 
 bool BPiece::NeedsDownAdjustmentInHud() const {
@@ -4,16 +4,10 @@
 // Game includes.
 #include "Piece.hpp"
 
-namespace Pht {
-    class IEngine;
-}
-
 namespace RowBlast {
-    class CommonResources;
-    
     class BPiece: public Piece {
     public:
-        BPiece(Pht::IEngine& engine, const CommonResources& commonResources);
+        BPiece();
         
         bool NeedsDownAdjustmentInHud() const override;
     };
@@ -1,15 +1,8 @@
 #include "BigLPiece.hpp"
 
-// Engine includes.
-#include "IEngine.hpp"
-
-// Game includes.
-#include "CommonResources.hpp"
-#include "GhostPieceProducer.hpp"
-
 using namespace RowBlast;
 
-BigLPiece::BigLPiece(Pht::IEngine& engine, const CommonResources& commonResources) {
+BigLPiece::BigLPiece() {
     FillGrid fillGrid = {
         {Fill::Empty, Fill::Empty, Fill::Full},
         {Fill::Empty, Fill::Empty, Fill::Full},
@@ -39,11 +32,5 @@ BigLPiece::BigLPiece(Pht::IEngine& engine, const CommonResources& commonResource
         {{0, 0}, BorderSegmentKind::Left},
     };
     
-    GhostPieceProducer ghostPieceProducer {engine, Pht::IVec2{3, 3}, commonResources};
-    auto renderables = ghostPieceProducer.DrawRenderables(border, GetColor());
-    SetDraggedPieceRenderable(std::move(renderables.mDraggedPiece));
-    SetHighlightedDraggedPieceRenderable(std::move(renderables.mHighlightedDraggedPiece));
-    SetShadowRenderable(std::move(renderables.mShadow));
-    SetGhostPieceRenderable(std::move(renderables.mGhostPiece));
-    SetHighlightedGhostPieceRenderable(std::move(renderables.mHighlightedGhostPiece));
+    SetGhostPieceBorder(border, Pht::IVec2{3, 3});
 }
@@ -4,16 +4,10 @@
 // Game includes.
 #include "Piece.hpp"
 
-namespace Pht {
-    class IEngine;
-}
-
 namespace RowBlast {
-    class CommonResources;
-    
     class BigLPiece: public Piece {
     public:
-        BigLPiece(Pht::IEngine& engine, const CommonResources& commonResources);
+        BigLPiece();
     };
 }
 
@@ -1,15 +1,8 @@
 #include "BigTrianglePiece.hpp"
 
-// Engine includes.
-#include "IEngine.hpp"
-
-// Game includes.
-#include "CommonResources.hpp"
-#include "GhostPieceProducer.hpp"
-
 using namespace RowBlast;
 
-BigTrianglePiece::BigTrianglePiece(Pht::IEngine& engine, const CommonResources& commonResources) {
+BigTrianglePiece::BigTrianglePiece() {
     FillGrid fillGrid = {
         {Fill::Empty,          Fill::Empty,          Fill::LowerRightHalf},
         {Fill::Empty,          Fill::LowerRightHalf, Fill::Full},
@@ -35,11 +28,5 @@ BigTrianglePiece::BigTrianglePiece(Pht::IEngine& engine, const CommonResources&
         {{0, 0}, BorderSegmentKind::UpperLeftTiltForTriangle},
     };
     
-    GhostPieceProducer ghostPieceProducer {engine, Pht::IVec2{3, 3}, commonResources};
-    auto renderables = ghostPieceProducer.DrawRenderables(border, GetColor());
-    SetDraggedPieceRenderable(std::move(renderables.mDraggedPiece));
-    SetHighlightedDraggedPieceRenderable(std::move(renderables.mHighlightedDraggedPiece));
-    SetShadowRenderable(std::move(renderables.mShadow));
-    SetGhostPieceRenderable(std::move(renderables.mGhostPiece));
-    SetHighlightedGhostPieceRenderable(std::move(renderables.mHighlightedGhostPiece));
+    SetGhostPieceBorder(border, Pht::IVec2{3, 3});
 }
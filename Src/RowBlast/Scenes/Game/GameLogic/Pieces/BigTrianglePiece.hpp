@@ -4,16 +4,10 @@
 // Game includes.
 #include "Piece.hpp"
 
-namespace Pht {
-    class IEngine;
-}
-
 namespace RowBlast {
-    class CommonResources;
-    
     class BigTrianglePiece: public Piece {
     public:
-        BigTrianglePiece(Pht::IEngine& engine, const CommonResources& commonResources);
+        BigTrianglePiece();
     };
 }
 
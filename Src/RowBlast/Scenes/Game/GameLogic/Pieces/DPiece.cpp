@@ -1,15 +1,8 @@
 #include "DPiece.hpp"
 
-// Engine includes.
-#include "IEngine.hpp"
-
-// Game includes.
-#include "CommonResources.hpp"
-#include "GhostPieceProducer.hpp"
-
 using namespace RowBlast;
 
-DPiece::DPiece(Pht::IEngine& engine, const CommonResources& commonResources) {
+DPiece::DPiece() {
     FillGrid fillGrid = {
         {Fill::Full,  Fill::Full,  Fill::Full},
         {Fill::Empty, Fill::Full,  Fill::Full},
@@ -39,13 +32,7 @@ DPiece::DPiece(Pht::IEngine& engine, const CommonResources& commonResources) {
         {{1, 1}, BorderSegmentKind::Left}
     };
     
-    GhostPieceProducer ghostPieceProducer {engine, Pht::IVec2{3, 3}, commonResources};
-    auto renderables = ghostPieceProducer.DrawRenderables(border, GetColor());
-    SetDraggedPieceRenderable(std::move(renderables.mDraggedPiece));
-    SetHighlightedDraggedPieceRenderable(std::move(renderables.mHighlightedDraggedPiece));
-    SetShadowRenderable(std::move(renderables.mShadow));
-    SetGhostPieceRenderable(std::move(renderables.mGhostPiece));
-    SetHighlightedGhostPieceRenderable(std::move(renderables.mHighlightedGhostPiece));
+    SetGhostPieceBorder(border, Pht::IVec2{3, 3});
 }
 
 bool DPiece::NeedsDownAdjustmentInHud() const {
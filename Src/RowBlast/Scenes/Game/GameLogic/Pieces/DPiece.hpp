@@ -4,16 +4,10 @@
 // Game includes.
 #include "Piece.hpp"
 
-namespace Pht {
-    class IEngine;
-}
-
 namespace RowBlast {
-    class CommonResources;
-    
     class DPiece: public Piece {
     public:
-        DPiece(Pht::IEngine& engine, const CommonResources& commonResources);
+        DPiece();
         
         bool NeedsDownAdjustmentInHud() const override;
     };
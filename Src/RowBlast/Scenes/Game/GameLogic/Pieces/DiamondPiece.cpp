@@ -1,15 +1,8 @@
 #include "DiamondPiece.hpp"
 
-// Engine includes.
-#include "IEngine.hpp"
-
-// Game includes.
-#include "CommonResources.hpp"
-#include "GhostPieceProducer.hpp"
-
 using namespace RowBlast;
 
-DiamondPiece::DiamondPiece(Pht::IEngine& engine, const CommonResources& commonResources) {
+DiamondPiece::DiamondPiece() {
     FillGrid fillGrid = {
         {Fill::LowerRightHalf, Fill::LowerLeftHalf},
         {Fill::UpperRightHalf, Fill::UpperLeftHalf}
@@ -34,11 +27,5 @@ DiamondPiece::DiamondPiece(Pht::IEngine& engine, const CommonResources& commonRe
         {{1, 0}, BorderSegmentKind::LowerLeftTiltForDiamond},
     };
     
-    GhostPieceProducer ghostPieceProducer {engine, Pht::IVec2{2, 2}, commonResources};
-    auto renderables = ghostPieceProducer.DrawRenderables(border, GetColor());
-    SetDraggedPieceRenderable(std::move(renderables.mDraggedPiece));
-    SetHighlightedDraggedPieceRenderable(std::move(renderables.mHighlightedDraggedPiece));
-    SetShadowRenderable(std::move(renderables.mShadow));
-    SetGhostPieceRenderable(std::move(renderables.mGhostPiece));
-    SetHighlightedGhostPieceRenderable(std::move(renderables.mHighlightedGhostPiece));
+    SetGhostPieceBorder(border, Pht::IVec2{2, 2});
 }
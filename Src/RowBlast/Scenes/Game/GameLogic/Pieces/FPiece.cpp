@@ -1,15 +1,8 @@
 #include "FPiece.hpp"
 
-// Engine includes.
-#include "IEngine.hpp"
-
-// Game includes.
-#include "CommonResources.hpp"
-#include "GhostPieceProducer.hpp"
-
 using namespace RowBlast;
 
-FPiece::FPiece(Pht::IEngine& engine, const CommonResources& commonResources) {
+FPiece::FPiece() {
     FillGrid fillGrid = {
         {Fill::Empty, Fill::Empty, Fill::Empty, Fill::Empty},
         {Fill::Empty, Fill::Full,  Fill::Empty, Fill::Empty},
@@ -45,11 +38,5 @@ FPiece::FPiece(Pht::IEngine& engine, const CommonResources& commonResources) {
         {{0, 1}, BorderSegmentKind::Left},
     };
     
-    GhostPieceProducer ghostPieceProducer {engine, Pht::IVec2{4, 4}, commonResources};
-    auto renderables = ghostPieceProducer.DrawRenderables(border, GetColor());
-    SetDraggedPieceRenderable(std::move(renderables.mDraggedPiece));
-    SetHighlightedDraggedPieceRenderable(std::move(renderables.mHighlightedDraggedPiece));
-    SetShadowRenderable(std::move(renderables.mShadow));
-    SetGhostPieceRenderable(std::move(renderables.mGhostPiece));
-    SetHighlightedGhostPieceRenderable(std::move(renderables.mHighlightedGhostPiece));
+    SetGhostPieceBorder(border, Pht::IVec2{4, 4});
 }
@@ -4,16 +4,10 @@
 // Game includes.
 #include "Piece.hpp"
 
-namespace Pht {
-    class IEngine;
-}
-
 namespace RowBlast {
-    class CommonResources;
-    
     class FPiece: public Piece {
     public:
-        FPiece(Pht::IEngine& engine, const CommonResources& commonResources);
+        FPiece();
     };
 }
 
@@ -1,15 +1,8 @@
 #include "LPiece.hpp"
 
-// Engine includes.
-#include "IEngine.hpp"
-
-// Game includes.
-#include "CommonResources.hpp"
-#include "GhostPieceProducer.hpp"
-
 using namespace RowBlast;
 
-LPiece::LPiece(Pht::IEngine& engine, const CommonResources& commonResources) {
+LPiece::LPiece() {
     FillGrid fillGrid = {
         {Fill::Empty, Fill::Full},
         {Fill::Full,  Fill::Full}
@@ -36,11 +29,5 @@ LPiece::LPiece(Pht::IEngine& engine, const CommonResources& commonResources) {
         {{0, 0}, BorderSegmentKind::Left},
     };
     
-    GhostPieceProducer ghostPieceProducer {engine, Pht::IVec2{2, 2}, commonResources};
-    auto renderables = ghostPieceProducer.DrawRenderables(border, GetColor());
-    SetDraggedPieceRenderable(std::move(renderables.mDraggedPiece));
-    SetHighlightedDraggedPieceRenderable(std::move(renderables.mHighlightedDraggedPiece));
-    SetShadowRenderable(std::move(renderables.mShadow));
-    SetGhostPieceRenderable(std::move(renderables.mGhostPiece));
-    SetHighlightedGhostPieceRenderable(std::move(renderables.mHighlightedGhostPiece));
+    SetGhostPieceBorder(border, Pht::IVec2{2, 2});
 }
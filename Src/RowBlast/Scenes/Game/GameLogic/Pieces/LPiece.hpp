@@ -4,16 +4,10 @@
 // Game includes.
 #include "Piece.hpp"
 
-namespace Pht {
-    class IEngine;
-}
-
 namespace RowBlast {
-    class CommonResources;
-    
     class LPiece: public Piece {
     public:
-        LPiece(Pht::IEngine& engine, const CommonResources& commonResources);
+        LPiece();
     };
 }
 
@@ -1,15 +1,8 @@
 #include "LongIPiece.hpp"
 
-// Engine includes.
-#include "IEngine.hpp"
-
-// Game includes.
-#include "CommonResources.hpp"
-#include "GhostPieceProducer.hpp"
-
 using namespace RowBlast;
 
-LongIPiece::LongIPiece(Pht::IEngine& engine, const CommonResources& commonResources) {
+LongIPiece::LongIPiece() {
     FillGrid fillGrid = {
         {Fill::Empty, Fill::Empty, Fill::Full, Fill::Empty, Fill::Empty},
         {Fill::Empty, Fill::Empty, Fill::Full, Fill::Empty, Fill::Empty},
@@ -43,13 +36,7 @@ LongIPiece::LongIPiece(Pht::IEngine& engine, const CommonResources& commonResour
         {{0, 0}, BorderSegmentKind::Left}
     };
 
-    GhostPieceProducer ghostPieceProducer {engine, Pht::IVec2{1, 5}, commonResources};
-    auto renderables = ghostPieceProducer.DrawRenderables(border, GetColor());
-    SetDraggedPieceRenderable(std::move(renderables.mDraggedPiece));
-    SetHighlightedDraggedPieceRenderable(std::move(renderables.mHighlightedDraggedPiece));
-    SetShadowRenderable(std::move(renderables.mShadow));
-    SetGhostPieceRenderable(std::move(renderables.mGhostPiece));
-    SetHighlightedGhostPieceRenderable(std::move(renderables.mHighlightedGhostPiece));
+    SetGhostPieceBorder(border, Pht::IVec2{1, 5});
 }
 
 Rotation LongIPiece::GetSpawnRotation() const {
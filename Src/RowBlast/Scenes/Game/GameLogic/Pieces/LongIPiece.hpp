@@ -4,16 +4,10 @@
 // Game includes.
 #include "Piece.hpp"
 
-namespace Pht {
-    class IEngine;
-}
-
 namespace RowBlast {
-    class CommonResources;
-    
     class LongIPiece: public Piece {
     public:
-        LongIPiece(Pht::IEngine& engine, const CommonResources& commonResources);
+        LongIPiece();
         
         Rotation GetSpawnRotation() const override;
     };
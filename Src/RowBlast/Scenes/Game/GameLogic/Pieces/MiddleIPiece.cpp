@@ -1,15 +1,8 @@
 #include "MiddleIPiece.hpp"
 
-// Engine includes.
-#include "IEngine.hpp"
-
-// Game includes.
-#include "CommonResources.hpp"
-#include "GhostPieceProducer.hpp"
-
 using namespace RowBlast;
 
-MiddleIPiece::MiddleIPiece(Pht::IEngine& engine, const CommonResources& commonResources) {
+MiddleIPiece::MiddleIPiece() {
     FillGrid fillGrid = {
         {Fill::Empty, Fill::Full, Fill::Empty},
         {Fill::Empty, Fill::Full, Fill::Empty},
@@ -37,13 +30,7 @@ MiddleIPiece::MiddleIPiece(Pht::IEngine& engine, const CommonResources& commonRe
         {{0, 0}, BorderSegmentKind::Left}
     };
     
-    GhostPieceProducer ghostPieceProducer {engine, Pht::IVec2{1, 3}, commonResources};
-    auto renderables = ghostPieceProducer.DrawRenderables(border, GetColor());
-    SetDraggedPieceRenderable(std::move(renderables.mDraggedPiece));
-    SetHighlightedDraggedPieceRenderable(std::move(renderables.mHighlightedDraggedPiece));
-    SetShadowRenderable(std::move(renderables.mShadow));
-    SetGhostPieceRenderable(std::move(renderables.mGhostPiece));
-    SetHighlightedGhostPieceRenderable(std::move(renderables.mHighlightedGhostPiece));
+    SetGhostPieceBorder(border, Pht::IVec2{1, 3});
 }
 
 Rotation MiddleIPiece::GetSpawnRotation() const {
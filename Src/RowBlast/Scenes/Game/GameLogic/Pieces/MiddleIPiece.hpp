@@ -4,16 +4,10 @@
 // Game includes.
 #include "Piece.hpp"
 
-namespace Pht {
-    class IEngine;
-}
-
 namespace RowBlast {
-    class CommonResources;
-    
     class MiddleIPiece: public Piece {
     public:
-        MiddleIPiece(Pht::IEngine& engine, const CommonResources& commonResources);
+        MiddleIPiece();
         
         Rotation GetSpawnRotation() const override;
     };
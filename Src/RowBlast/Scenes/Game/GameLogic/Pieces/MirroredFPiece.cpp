@@ -1,15 +1,8 @@
 #include "MirroredFPiece.hpp"
 
-// Engine includes.
-#include "IEngine.hpp"
-
-// Game includes.
-#include "CommonResources.hpp"
-#include "GhostPieceProducer.hpp"
-
 using namespace RowBlast;
 
-MirroredFPiece::MirroredFPiece(Pht::IEngine& engine, const CommonResources& commonResources) {
+MirroredFPiece::MirroredFPiece() {
     FillGrid fillGrid = {
         {Fill::Empty, Fill::Empty, Fill::Empty, Fill::Empty},
         {Fill::Full,  Fill::Full,  Fill::Full,  Fill::Full},
@@ -45,11 +38,5 @@ MirroredFPiece::MirroredFPiece(Pht::IEngine& engine, const CommonResources& comm
         {{0, 2}, BorderSegmentKind::Left}
     };
     
-    GhostPieceProducer ghostPieceProducer {engine, Pht::IVec2{4, 4}, commonResources};
-    auto renderables = ghostPieceProducer.DrawRenderables(border, GetColor());
-    SetDraggedPieceRenderable(std::move(renderables.mDraggedPiece));
-    SetHighlightedDraggedPieceRenderable(std::move(renderables.mHighlightedDraggedPiece));
-    SetShadowRenderable(std::move(renderables.mShadow));
-    SetGhostPieceRenderable(std::move(renderables.mGhostPiece));
-    SetHighlightedGhostPieceRenderable(std::move(renderables.mHighlightedGhostPiece));
+    SetGhostPieceBorder(border, Pht::IVec2{4, 4});
 }
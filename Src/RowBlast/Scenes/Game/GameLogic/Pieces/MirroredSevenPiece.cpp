@@ -1,16 +1,8 @@
 #include "MirroredSevenPiece.hpp"
 
-// Engine includes.
-#include "IEngine.hpp"
-
-// Game includes.
-#include "CommonResources.hpp"
-#include "GhostPieceProducer.hpp"
-
 using namespace RowBlast;
 
-MirroredSevenPiece::MirroredSevenPiece(Pht::IEngine& engine,
-                                       const CommonResources& commonResources) {
+MirroredSevenPiece::MirroredSevenPiece() {
     FillGrid fillGrid = {
         {Fill::Empty, Fill::Empty, Fill::Full},
         {Fill::Empty, Fill::Full,  Fill::Empty},
@@ -43,13 +35,7 @@ MirroredSevenPiece::MirroredSevenPiece(Pht::IEngine& engine,
         {{2, 2}, BorderSegmentKind::ConnectionForMirroredSeven}
     };
     
-    GhostPieceProducer ghostPieceProducer {engine, Pht::IVec2{3, 3}, commonResources};
-    auto renderables = ghostPieceProducer.DrawRenderables(border, GetColor());
-    SetDraggedPieceRenderable(std::move(renderables.mDraggedPiece));
-    SetHighlightedDraggedPieceRenderable(std::move(renderables.mHighlightedDraggedPiece));
-    SetShadowRenderable(std::move(renderables.mShadow));
-    SetGhostPieceRenderable(std::move(renderables.mGhostPiece));
-    SetHighlightedGhostPieceRenderable(std::move(renderables.mHighlightedGhostPiece));
+    SetGhostPieceBorder(border, Pht::IVec2{3, 3});
 }
 
 bool MirroredSevenPiece::NeedsLeftAdjustmentInHud() const {
@@ -4,16 +4,10 @@
 // Game includes.
 #include "Piece.hpp"
 
-namespace Pht {
-    class IEngine;
-}
-
 namespace RowBlast {
-    class CommonResources;
-    
     class MirroredSevenPiece: public Piece {
     public:
-        MirroredSevenPiece(Pht::IEngine& engine, const CommonResources& commonResources);
+        MirroredSevenPiece();
         
         bool NeedsLeftAdjustmentInHud() const override;
         Rotation GetSpawnRotation() const override;
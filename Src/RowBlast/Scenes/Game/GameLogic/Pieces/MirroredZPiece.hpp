@@ -4,16 +4,10 @@
 // Game includes.
 #include "Piece.hpp"
 
-namespace Pht {
-    class IEngine;
-}
-
 namespace RowBlast {
-    class CommonResources;
-    
     class MirroredZPiece: public Piece {
     public:
-        MirroredZPiece(Pht::IEngine& engine, const CommonResources& commonResources);
+        MirroredZPiece();
     };
 }
 
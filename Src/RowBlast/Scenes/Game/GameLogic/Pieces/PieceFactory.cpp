@@ -0,0 +1,95 @@
+#include "PieceFactory.hpp"
+
+#include <assert.h>
+
+// Game includes.
+#include "SmallTrianglePiece.hpp"
+#include "TrianglePiece.hpp"
+#include "BigTrianglePiece.hpp"
+#include "DiamondPiece.hpp"
+#include "PyramidPiece.hpp"
+#include "LongIPiece.hpp"
+#include "MiddleIPiece.hpp"
+#include "ShortIPiece.hpp"
+#include "LPiece.hpp"
+#include "BPiece.hpp"
+#include "DPiece.hpp"
+#include "SevenPiece.hpp"
+#include "MirroredSevenPiece.hpp"
+#include "FPiece.hpp"
+#include "MirroredFPiece.hpp"
+#include "BigLPiece.hpp"
+#include "ZPiece.hpp"
+#include "MirroredZPiece.hpp"
+#include "TPiece.hpp"
+#include "PlusPiece.hpp"
+#include "Bomb.hpp"
+#include "RowBomb.hpp"
+
+using namespace RowBlast;
+
+namespace {
+    template <typename T>
+    std::unique_ptr<Piece> Create() {
+        return std::make_unique<T>();
+    }
+    
+    using CreateFunction = std::unique_ptr<Piece> (*)();
+    
+    const std::map<std::string, CreateFunction> createFunctions {
+        {"LongI", Create<LongIPiece>},
+        {"I", Create<MiddleIPiece>},
+        {"ShortI", Create<ShortIPiece>},
+        {"L", Create<LPiece>},
+        {"B", Create<BPiece>},
+        {"D", Create<DPiece>},
+        {"Seven", Create<SevenPiece>},
+        {"MirroredSeven", Create<MirroredSevenPiece>},
+        {"F", Create<FPiece>},
+        {"MirroredF", Create<MirroredFPiece>},
+        {"BigL", Create<BigLPiece>},
+        {"Z", Create<ZPiece>},
+        {"MirroredZ", Create<MirroredZPiece>},
+        {"T", Create<TPiece>},
+        {"Plus", Create<PlusPiece>},
+        {"SmallTriangle", Create<SmallTrianglePiece>},
+        {"Triangle", Create<TrianglePiece>},
+        {"BigTriangle", Create<BigTrianglePiece>},
+        {"Diamond", Create<DiamondPiece>},
+        {"Pyramid", Create<PyramidPiece>},
+        {"Bomb", Create<Bomb>},
+        {"RowBomb", Create<RowBomb>}
+    };
+    
+    std::vector<std::string> CreatePieceNames() {
+        std::vector<std::string> pieceNames;
+        
+        for (auto& entry: createFunctions) {
+            pieceNames.push_back(entry.first);
+        }
+        
+        return pieceNames;
+    }
+}
+
+const std::vector<std::string>& PieceFactory::GetPieceNames() {
+    static const auto pieceNames = CreatePieceNames();
+    return pieceNames;
+}
+
+std::unique_ptr<Piece> PieceFactory::CreatePiece(const std::string& pieceName) {
+    auto i = createFunctions.find(pieceName);
+    assert(i != std::end(createFunctions));
+    
+    return i->second();
+}
+
+PieceTypes PieceFactory::CreatePieceTypes() {
+    PieceTypes pieceTypes;
+    
+    for (auto& pieceName: GetPieceNames()) {
+        pieceTypes[pieceName] = CreatePiece(pieceName);
+    }
+    
+    return pieceTypes;
+}
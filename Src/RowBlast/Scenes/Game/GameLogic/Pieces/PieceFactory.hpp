@@ -0,0 +1,22 @@
+#ifndef PieceFactory_hpp
+#define PieceFactory_hpp
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Game includes.
+#include "Piece.hpp"
+
+namespace RowBlast {
+    using PieceTypes = std::map<std::string, std::unique_ptr<const Piece>>;
+    
+    namespace PieceFactory {
+        const std::vector<std::string>& GetPieceNames();
+        std::unique_ptr<Piece> CreatePiece(const std::string& pieceName);
+        PieceTypes CreatePieceTypes();
+    }
+}
+
+#endif
@@ -1,15 +1,8 @@
 #include "PlusPiece.hpp"
 
-// Engine includes.
-#include "IEngine.hpp"
-
-// Game includes.
-#include "CommonResources.hpp"
-#include "GhostPieceProducer.hpp"
-
 using namespace RowBlast;
 
-PlusPiece::PlusPiece(Pht::IEngine& engine, const CommonResources& commonResources) {
+PlusPiece::PlusPiece() {
     FillGrid fillGrid = {
         {Fill::Empty, Fill::Full, Fill::Empty},
         {Fill::Full,  Fill::Full, Fill::Full},
@@ -49,11 +42,5 @@ PlusPiece::PlusPiece(Pht::IEngine& engine, const CommonResources& commonResource
         {{1, 0}, BorderSegmentKind::Left}
     };
     
-    GhostPieceProducer ghostPieceProducer {engine, Pht::IVec2{3, 3}, commonResources};
-    auto renderables = ghostPieceProducer.DrawRenderables(border, GetColor());
-    SetDraggedPieceRenderable(std::move(renderables.mDraggedPiece));
-    SetHighlightedDraggedPieceRenderable(std::move(renderables.mHighlightedDraggedPiece));
-    SetShadowRenderable(std::move(renderables.mShadow));
-    SetGhostPieceRenderable(std::move(renderables.mGhostPiece));
-    SetHighlightedGhostPieceRenderable(std::move(renderables.mHighlightedGhostPiece));
+    SetGhostPieceBorder(border, Pht::IVec2{3, 3});
 }
@@ -1,15 +1,8 @@
 #include "PyramidPiece.hpp"
 
-// Engine includes.
-#include "IEngine.hpp"
-
-// Game includes.
-#include "CommonResources.hpp"
-#include "GhostPieceProducer.hpp"
-
 using namespace RowBlast;
 
-PyramidPiece::PyramidPiece(Pht::IEngine& engine, const CommonResources& commonResources) {
+PyramidPiece::PyramidPiece() {
     FillGrid fillGrid = {
         {Fill::Empty, Fill::Empty,          Fill::Empty,         Fill::Empty},
         {Fill::Empty, Fill::LowerRightHalf, Fill::LowerLeftHalf, Fill::Empty},
@@ -38,13 +31,7 @@ PyramidPiece::PyramidPiece(Pht::IEngine& engine, const CommonResources& commonRe
         {{0, 1}, BorderSegmentKind::UpperLeftTiltForPyramid},
     };
     
-    GhostPieceProducer ghostPieceProducer {engine, Pht::IVec2{2, 2}, commonResources};
-    auto renderables = ghostPieceProducer.DrawRenderables(border, GetColor());
-    SetDraggedPieceRenderable(std::move(renderables.mDraggedPiece));
-    SetHighlightedDraggedPieceRenderable(std::move(renderables.mHighlightedDraggedPiece));
-    SetShadowRenderable(std::move(renderables.mShadow));
-    SetGhostPieceRenderable(std::move(renderables.mGhostPiece));
-    SetHighlightedGhostPieceRenderable(std::move(renderables.mHighlightedGhostPiece));
+    SetGhostPieceBorder(border, Pht::IVec2{2, 2});
 }
 
 bool PyramidPiece::NeedsDownAdjustmentInHud() const {
@@ -4,16 +4,10 @@
 // Game includes.
 #include "Piece.hpp"
 
-namespace Pht {
-    class IEngine;
-}
-
 namespace RowBlast {
-    class CommonResources;
-    
     class PyramidPiece: public Piece {
     public:
-        PyramidPiece(Pht::IEngine& engine, const CommonResources& commonResources);
+        PyramidPiece();
         
         bool NeedsDownAdjustmentInHud() const override;
     };
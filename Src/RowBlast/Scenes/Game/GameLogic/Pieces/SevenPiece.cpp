@@ -1,15 +1,8 @@
 #include "SevenPiece.hpp"
 
-// Engine includes.
-#include "IEngine.hpp"
-
-// Game includes.
-#include "CommonResources.hpp"
-#include "GhostPieceProducer.hpp"
-
 using namespace RowBlast;
 
-SevenPiece::SevenPiece(Pht::IEngine& engine, const CommonResources& commonResources) {
+SevenPiece::SevenPiece() {
     FillGrid fillGrid = {
         {Fill::Full,  Fill::Empty, Fill::Empty},
         {Fill::Empty, Fill::Full,  Fill::Empty},
@@ -42,13 +35,7 @@ SevenPiece::SevenPiece(Pht::IEngine& engine, const CommonResources& commonResour
         {{1, 2}, BorderSegmentKind::ConnectionForSeven}
     };
     
-    GhostPieceProducer ghostPieceProducer {engine, Pht::IVec2{3, 3}, commonResources};
-    auto renderables = ghostPieceProducer.DrawRenderables(border, GetColor());
-    SetDraggedPieceRenderable(std::move(renderables.mDraggedPiece));
-    SetHighlightedDraggedPieceRenderable(std::move(renderables.mHighlightedDraggedPiece));
-    SetShadowRenderable(std::move(renderables.mShadow));
-    SetGhostPieceRenderable(std::move(renderables.mGhostPiece));
-    SetHighlightedGhostPieceRenderable(std::move(renderables.mHighlightedGhostPiece));
+    SetGhostPieceBorder(border, Pht::IVec2{3, 3});
 }
 
 int SevenPiece::GetSpawnYPositionAdjustment() const {
@@ -4,16 +4,10 @@
 // Game includes.
 #include "Piece.hpp"
 
-namespace Pht {
-    class IEngine;
-}
-
 namespace RowBlast {
-    class CommonResources;
-    
     class SevenPiece: public Piece {
     public:
-        SevenPiece(Pht::IEngine& engine, const CommonResources& commonResources);
+        SevenPiece();
         
         int GetSpawnYPositionAdjustment() const override;
         bool NeedsRightAdjustmentInHud() const override;
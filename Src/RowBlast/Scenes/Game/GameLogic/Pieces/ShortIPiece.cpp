@@ -1,15 +1,8 @@
 #include "ShortIPiece.hpp"
 
-// Engine includes.
-#include "IEngine.hpp"
-
-// Game includes.
-#include "CommonResources.hpp"
-#include "GhostPieceProducer.hpp"
-
 using namespace RowBlast;
 
-ShortIPiece::ShortIPiece(Pht::IEngine& engine, const CommonResources& commonResources) {
+ShortIPiece::ShortIPiece() {
     FillGrid fillGrid = {
         {Fill::Empty, Fill::Empty, Fill::Empty, Fill::Empty},
         {Fill::Empty, Fill::Empty, Fill::Full,  Fill::Empty},
@@ -45,13 +38,7 @@ ShortIPiece::ShortIPiece(Pht::IEngine& engine, const CommonResources& commonReso
         {{1, 0}, BorderSegmentKind::Left}
     };
     
-    GhostPieceProducer ghostPieceProducer {engine, Pht::IVec2{2, 2}, commonResources};
-    auto renderables = ghostPieceProducer.DrawRenderables(border, GetColor());
-    SetDraggedPieceRenderable(std::move(renderables.mDraggedPiece));
-    SetHighlightedDraggedPieceRenderable(std::move(renderables.mHighlightedDraggedPiece));
-    SetShadowRenderable(std::move(renderables.mShadow));
-    SetGhostPieceRenderable(std::move(renderables.mGhostPiece));
-    SetHighlightedGhostPieceRenderable(std::move(renderables.mHighlightedGhostPiece));
+    SetGhostPieceBorder(border, Pht::IVec2{2, 2});
 }
 
 bool ShortIPiece::NeedsLeftAdjustmentInHud() const {
@@ -4,16 +4,10 @@
 // Game includes.
 #include "Piece.hpp"
 
-namespace Pht {
-    class IEngine;
-}
-
 namespace RowBlast {
-    class CommonResources;
-    
     class ShortIPiece: public Piece {
     public:
-        ShortIPiece(Pht::IEngine& engine, const CommonResources& commonResources);
+        ShortIPiece();
         
         bool NeedsLeftAdjustmentInHud() const override;
         Rotation GetSpawnRotation() const override;
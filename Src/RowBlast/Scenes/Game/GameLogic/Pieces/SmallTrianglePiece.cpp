@@ -1,16 +1,8 @@
 #include "SmallTrianglePiece.hpp"
 
-// Engine includes.
-#include "IEngine.hpp"
-
-// Game includes.
-#include "CommonResources.hpp"
-#include "GhostPieceProducer.hpp"
-
 using namespace RowBlast;
 
-SmallTrianglePiece::SmallTrianglePiece(Pht::IEngine& engine,
-                                       const CommonResources& commonResources) {
+SmallTrianglePiece::SmallTrianglePiece() {
     FillGrid fillGrid = {
         {Fill::Empty, Fill::Empty,          Fill::Empty},
         {Fill::Empty, Fill::LowerRightHalf, Fill::Empty},
@@ -36,13 +28,7 @@ SmallTrianglePiece::SmallTrianglePiece(Pht::IEngine& engine,
         {{0, 0}, BorderSegmentKind::UpperLeftTiltForTriangle},
     };
     
-    GhostPieceProducer ghostPieceProducer {engine, Pht::IVec2{1, 1}, commonResources};
-    auto renderables = ghostPieceProducer.DrawRenderables(border, GetColor());
-    SetDraggedPieceRenderable(std::move(renderables.mDraggedPiece));
-    SetHighlightedDraggedPieceRenderable(std::move(renderables.mHighlightedDraggedPiece));
-    SetShadowRenderable(std::move(renderables.mShadow));
-    SetGhostPieceRenderable(std::move(renderables.mGhostPiece));
-    SetHighlightedGhostPieceRenderable(std::move(renderables.mHighlightedGhostPiece));
+    SetGhostPieceBorder(border, Pht::IVec2{1, 1});
 }
 
 bool SmallTrianglePiece::PositionCanBeAdjusteInMovesSearch() const {
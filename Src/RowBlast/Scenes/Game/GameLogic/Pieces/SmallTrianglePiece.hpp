@@ -4,16 +4,10 @@
 // Game includes.
 #include "Piece.hpp"
 
-namespace Pht {
-    class IEngine;
-}
-
 namespace RowBlast {
-    class CommonResources;
-    
     class SmallTrianglePiece: public Piece {
     public:
-        SmallTrianglePiece(Pht::IEngine& engine, const CommonResources& commonResources);
+        SmallTrianglePiece();
         
         bool PositionCanBeAdjusteInMovesSearch() const override;
     };
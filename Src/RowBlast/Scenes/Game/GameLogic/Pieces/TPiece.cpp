@@ -1,15 +1,8 @@
 #include "TPiece.hpp"
 
-// Engine includes.
-#include "IEngine.hpp"
-
-// Game includes.
-#include "CommonResources.hpp"
-#include "GhostPieceProducer.hpp"
-
 using namespace RowBlast;
 
-TPiece::TPiece(Pht::IEngine& engine, const CommonResources& commonResources) {
+TPiece::TPiece() {
     FillGrid fillGrid = {
         {Fill::Empty, Fill::Full, Fill::Empty},
         {Fill::Empty, Fill::Full, Fill::Empty},
@@ -42,11 +35,5 @@ TPiece::TPiece(Pht::IEngine& engine, const CommonResources& commonResources) {
         {{0, 0}, BorderSegmentKind::Left}
     };
     
-    GhostPieceProducer ghostPieceProducer {engine, Pht::IVec2{3, 3}, commonResources};
-    auto renderables = ghostPieceProducer.DrawRenderables(border, GetColor());
-    SetDraggedPieceRenderable(std::move(renderables.mDraggedPiece));
-    SetHighlightedDraggedPieceRenderable(std::move(renderables.mHighlightedDraggedPiece));
-    SetShadowRenderable(std::move(renderables.mShadow));
-    SetGhostPieceRenderable(std::move(renderables.mGhostPiece));
-    SetHighlightedGhostPieceRenderable(std::move(renderables.mHighlightedGhostPiece));
+    SetGhostPieceBorder(border, Pht::IVec2{3, 3});
 }
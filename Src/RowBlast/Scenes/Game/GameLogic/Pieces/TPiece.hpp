@@ -4,16 +4,10 @@
 // Game includes.
 #include "Piece.hpp"
 
-namespace Pht {
-    class IEngine;
-}
-
 namespace RowBlast {
-    class CommonResources;
-    
     class TPiece: public Piece {
     public:
-        TPiece(Pht::IEngine& engine, const CommonResources& commonResources);
+        TPiece();
     };
 }
 
@@ -1,15 +1,8 @@
 #include "TrianglePiece.hpp"
 
-// Engine includes.
-#include "IEngine.hpp"
-
-// Game includes.
-#include "CommonResources.hpp"
-#include "GhostPieceProducer.hpp"
-
 using namespace RowBlast;
 
-TrianglePiece::TrianglePiece(Pht::IEngine& engine, const CommonResources& commonResources) {
+TrianglePiece::TrianglePiece() {
     FillGrid fillGrid = {
         {Fill::Empty,          Fill::LowerRightHalf},
         {Fill::LowerRightHalf, Fill::Full}
@@ -32,11 +25,5 @@ TrianglePiece::TrianglePiece(Pht::IEngine& engine, const CommonResources& common
         {{0, 0}, BorderSegmentKind::UpperLeftTiltForTriangle},
     };
     
-    GhostPieceProducer ghostPieceProducer {engine, Pht::IVec2{2, 2}, commonResources};
-    auto renderables = ghostPieceProducer.DrawRenderables(border, GetColor());
-    SetDraggedPieceRenderable(std::move(renderables.mDraggedPiece));
-    SetHighlightedDraggedPieceRenderable(std::move(renderables.mHighlightedDraggedPiece));
-    SetShadowRenderable(std::move(renderables.mShadow));
-    SetGhostPieceRenderable(std::move(renderables.mGhostPiece));
-    SetHighlightedGhostPieceRenderable(std::move(renderables.mHighlightedGhostPiece));
+    SetGhostPieceBorder(border, Pht::IVec2{2, 2});
 }
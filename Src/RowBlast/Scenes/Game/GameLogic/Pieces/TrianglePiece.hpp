@@ -4,16 +4,10 @@
 // Game includes.
 #include "Piece.hpp"
 
-namespace Pht {
-    class IEngine;
-}
-
 namespace RowBlast {
-    class CommonResources;
-    
     class TrianglePiece: public Piece {
     public:
-        TrianglePiece(Pht::IEngine& engine, const CommonResources& commonResources);
+        TrianglePiece();
     };
 }
 
@@ -1,15 +1,8 @@
 #include "ZPiece.hpp"
 
-// Engine includes.
-#include "IEngine.hpp"
-
-// Game includes.
-#include "CommonResources.hpp"
-#include "GhostPieceProducer.hpp"
-
 using namespace RowBlast;
 
-ZPiece::ZPiece(Pht::IEngine& engine, const CommonResources& commonResources) {
+ZPiece::ZPiece() {
     FillGrid fillGrid = {
         {Fill::Full,  Fill::Full, Fill::Empty},
         {Fill::Empty, Fill::Full, Fill::Empty},
@@ -43,11 +36,5 @@ ZPiece::ZPiece(Pht::IEngine& engine, const CommonResources& commonResources) {
         {{1, 0}, BorderSegmentKind::Left}
     };
     
-    GhostPieceProducer ghostPieceProducer {engine, Pht::IVec2{3, 3}, commonResources};
-    auto renderables = ghostPieceProducer.DrawRenderables(border, GetColor());
-    SetDraggedPieceRenderable(std::move(renderables.mDraggedPiece));
-    SetHighlightedDraggedPieceRenderable(std::move(renderables.mHighlightedDraggedPiece));
-    SetShadowRenderable(std::move(renderables.mShadow));
-    SetGhostPieceRenderable(std::move(renderables.mGhostPiece));
-    SetHighlightedGhostPieceRenderable(std::move(renderables.mHighlightedGhostPiece));
+    SetGhostPieceBorder(border, Pht::IVec2{3, 3});
 }
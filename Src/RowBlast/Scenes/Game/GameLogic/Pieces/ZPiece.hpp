@@ -4,16 +4,10 @@
 // Game includes.
 #include "Piece.hpp"
 
-namespace Pht {
-    class IEngine;
-}
-
 namespace RowBlast {
-    class CommonResources;
-    
     class ZPiece: public Piece {
     public:
-        ZPiece(Pht::IEngine& engine, const CommonResources& commonResources);
+        ZPiece();
     };
 }
 
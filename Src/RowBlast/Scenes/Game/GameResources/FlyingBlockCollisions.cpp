@@ -0,0 +1,156 @@
+#include "FlyingBlockCollisions.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace RowBlast;
+
+namespace {
+    int CalculateBucket(const Pht::IVec2& cell, int numBuckets) {
+        auto hash = static_cast<unsigned int>(cell.x) * 73856093u ^
+                    static_cast<unsigned int>(cell.y) * 19349663u;
+
+        return static_cast<int>(hash & static_cast<unsigned int>(numBuckets - 1));
+    }
+}
+
+FlyingBlockCollisions::FlyingBlockCollisions(float intersectionDistance) :
+    mCellSize {intersectionDistance},
+    mIntersectionDistanceSquared {intersectionDistance * intersectionDistance} {}
+
+void FlyingBlockCollisions::Handle(Blocks& blocks, float dt) {
+    SortBlocksIntoBuckets(blocks);
+
+    auto numBlocks = blocks.Size();
+
+    for (auto i = 0; i < numBlocks; ++i) {
+        FindCandidates(i);
+
+        for (auto j: mCandidates) {
+            HandlePair(blocks.At(i), blocks.At(j), dt);
+        }
+    }
+}
+
+void FlyingBlockCollisions::HandleAllPairs(Blocks& blocks, float dt) const {
+    auto numBlocks = blocks.Size();
+
+    for (auto i = 0; i < numBlocks; ++i) {
+        for (auto j = i + 1; j < numBlocks; ++j) {
+            HandlePair(blocks.At(i), blocks.At(j), dt);
+        }
+    }
+}
+
+void FlyingBlockCollisions::SortBlocksIntoBuckets(const Blocks& blocks) {
+    mBlockCells.Clear();
+    mBucketStarts.fill(0);
+    mBucketVisitStamps.fill(0);
+    mVisitStamp = 0;
+
+    for (auto& block: blocks) {
+        Pht::IVec2 cell {
+            static_cast<int>(std::floor(block.mPosition.x / mCellSize)),
+            static_cast<int>(std::floor(block.mPosition.y / mCellSize))
+        };
+
+        mBlockCells.PushBack(cell);
+        ++mBucketStarts[CalculateBucket(cell, numBuckets) + 1];
+    }
+
+    for (auto bucket = 0; bucket < numBuckets; ++bucket) {
+        mBucketStarts[bucket + 1] += mBucketStarts[bucket];
+    }
+
+    // Counting sort, which keeps the blocks in each bucket in index order.
+    std::array<int, numBuckets> bucketEnds;
+    std::copy(mBucketStarts.begin(), mBucketStarts.end() - 1, bucketEnds.begin());
+
+    mBlocksSortedByBucket.Clear();
+    for (auto i = 0; i < blocks.Size(); ++i) {
+        mBlocksSortedByBucket.PushBack(0);
+    }
+
+    for (auto i = 0; i < blocks.Size(); ++i) {
+        auto bucket = CalculateBucket(mBlockCells.At(i), numBuckets);
+        mBlocksSortedByBucket.At(bucketEnds[bucket]++) = i;
+    }
+}
+
+void FlyingBlockCollisions::FindCandidates(int blockIndex) {
+    mCandidates.Clear();
+    ++mVisitStamp;
+    
+    auto& blockCell = mBlockCells.At(blockIndex);
+
+    for (auto dy = -1; dy <= 1; ++dy) {
+        for (auto dx = -1; dx <= 1; ++dx) {
+            auto bucket = CalculateBucket(blockCell + Pht::IVec2 {dx, dy}, numBuckets);
+
+            // Neighbouring grid cells can hash to the same bucket and each pair must only be
+            // handled once.
+            if (mBucketVisitStamps[bucket] == mVisitStamp) {
+                continue;
+            }
+            
+            mBucketVisitStamps[bucket] = mVisitStamp;
+            
+            // The blocks in a bucket are in index order, so the scan stops at the first block
+            // that has already been handled as the first block of its pairs.
+            for (auto k = mBucketStarts[bucket + 1] - 1; k >= mBucketStarts[bucket]; --k) {
+                auto otherBlockIndex = mBlocksSortedByBucket.At(k);
+                if (otherBlockIndex <= blockIndex) {
+                    break;
+                }
+                
+                InsertCandidate(otherBlockIndex);
+            }
+        }
+    }
+}
+
+void FlyingBlockCollisions::InsertCandidate(int blockIndex) {
+    // The velocities are updated pair by pair, so the pairs are handled in index order.
+    mCandidates.PushBack(blockIndex);
+    
+    auto i = mCandidates.Size() - 1;
+    while (i > 0 && mCandidates.At(i - 1) > blockIndex) {
+        mCandidates.At(i) = mCandidates.At(i - 1);
+        --i;
+    }
+    
+    mCandidates.At(i) = blockIndex;
+}
+
+void FlyingBlockCollisions::HandlePair(Block& block1, Block& block2, float dt) const {
+    auto& block1Position = block1.mPosition;
+    auto& block2Position = block2.mPosition;
+
+    Pht::Vec3 pos1MinusPos2 {block1Position - block2Position};
+    auto distSquared = pos1MinusPos2.LengthSquared();
+    if (distSquared > mIntersectionDistanceSquared) {
+        return;
+    }
+
+    if (distSquared == 0.0f) {
+        distSquared = 0.01f;
+    }
+
+    auto v1MinusV2 = block1.mVelocity - block2.mVelocity;
+
+    // Equations from wikipedia: https://en.wikipedia.org/wiki/Elastic_collision
+    // section "Two-dimensional collision with two moving objects". Used in 3d space here. The
+    // masses are equal, so the change in velocity of the second block is the negated change of the
+    // first.
+    auto dv1 = -pos1MinusPos2 * v1MinusV2.Dot(pos1MinusPos2) / distSquared;
+    auto dv2 = -dv1;
+
+    auto newPos1 = block1Position + (block1.mVelocity + dv1) * dt;
+    auto newPos2 = block2Position + (block2.mVelocity + dv2) * dt;
+    auto newDistSquared = (newPos1 - newPos2).LengthSquared();
+
+    if (newDistSquared > distSquared) {
+        block1.mVelocity += dv1;
+        block2.mVelocity += dv2;
+    }
+}
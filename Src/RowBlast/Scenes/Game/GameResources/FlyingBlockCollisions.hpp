@@ -0,0 +1,53 @@
+#ifndef FlyingBlockCollisions_hpp
+#define FlyingBlockCollisions_hpp
+
+#include <array>
+
+// Engine includes.
+#include "Vector.hpp"
+#include "StaticVector.hpp"
+
+// Game includes.
+#include "Field.hpp"
+
+namespace RowBlast {
+    // Elastic collisions between flying blocks. The blocks are bucketed in a uniform grid in the xy
+    // plane with cells the size of the intersection distance, so that a block is only tested
+    // against the blocks in the neighbouring grid cells. The pairs are processed in the same order
+    // as in HandleAllPairs, which gives the same result.
+    class FlyingBlockCollisions {
+    public:
+        struct Block {
+            Pht::Vec3 mPosition;
+            Pht::Vec3 mVelocity;
+        };
+
+        static constexpr int maxNumBlocks {Field::maxNumRows * Field::maxNumColumns};
+
+        using Blocks = Pht::StaticVector<Block, maxNumBlocks>;
+
+        explicit FlyingBlockCollisions(float intersectionDistance);
+
+        void Handle(Blocks& blocks, float dt);
+        void HandleAllPairs(Blocks& blocks, float dt) const;
+
+    private:
+        void SortBlocksIntoBuckets(const Blocks& blocks);
+        void FindCandidates(int blockIndex);
+        void InsertCandidate(int blockIndex);
+        void HandlePair(Block& block1, Block& block2, float dt) const;
+
+        static constexpr int numBuckets {256};
+
+        float mCellSize {0.0f};
+        float mIntersectionDistanceSquared {0.0f};
+        Pht::StaticVector<Pht::IVec2, maxNumBlocks> mBlockCells;
+        Pht::StaticVector<int, maxNumBlocks> mBlocksSortedByBucket;
+        std::array<int, numBuckets + 1> mBucketStarts;
+        std::array<int, numBuckets> mBucketVisitStamps;
+        int mVisitStamp {0};
+        Pht::StaticVector<int, maxNumBlocks> mCandidates;
+    };
+}
+
+#endif
@@ -29,16 +29,14 @@ FlyingBlocksSystem::FlyingBlocksSystem(GameScene& scene,
     mScene {scene},
     mLevelResources {levelResources},
     mPieceResources {pieceResources},
-    mBombsAnimation {bombsAnimation} {
+    mBombsAnimation {bombsAnimation},
+    mCollisions {scene.GetCellSize()} {
     
     mSceneObjects.resize(maxNumBlockSceneObjects);
     
     for (auto& sceneObject: mSceneObjects) {
         sceneObject = std::make_unique<Pht::SceneObject>();
     }
-    
-    auto blockSize = scene.GetCellSize();
-    mIntersectionDistanceSquared = blockSize * blockSize;
 }
 
 void FlyingBlocksSystem::Init() {
@@ -265,8 +263,11 @@ void FlyingBlocksSystem::UpdateBlocks(float dt) {
         }
         
         if (shouldErase) {
+            // The order of the blocks does not matter, so the last block is moved into the slot
+            // instead of shifting all the blocks after it.
             ReleaseSceneObject(*flyingBlock.mSceneObject);
-            mFlyingBlocks.Erase(i);
+            flyingBlock = mFlyingBlocks.Back();
+            mFlyingBlocks.PopBack();
         } else {
             ++i;
         }
@@ -313,43 +314,19 @@ bool FlyingBlocksSystem::UpdateShrinkingBlock(FlyingBlock& flyingBlock, float dt
 }
 
 void FlyingBlocksSystem::HandleCollisions(float dt) {
-    auto numBlocks = mFlyingBlocks.Size();
+    mCollisionBlocks.Clear();
     
-    for (auto i = 0; i < numBlocks; ++i) {
-        for (auto j = i + 1; j < numBlocks; ++j) {
-            auto& block1 = mFlyingBlocks.At(i);
-            auto& block2 = mFlyingBlocks.At(j);
-            auto& block1Position = block1.mSceneObject->GetTransform().GetPosition();
-            auto& block2Position = block2.mSceneObject->GetTransform().GetPosition();
-            
-            Pht::Vec3 pos1MinusPos2 {block1Position - block2Position};
-            auto distSquared = pos1MinusPos2.LengthSquared();
-            if (distSquared > mIntersectionDistanceSquared) {
-                continue;
-            }
-            
-            if (distSquared == 0.0f) {
-                distSquared = 0.01f;
-            }
-            
-            Pht::Vec3 pos2MinusPos1 {block2Position - block1Position};
-            auto v1MinusV2 = block1.mVelocity - block2.mVelocity;
-            auto v2MinusV1 = block2.mVelocity - block1.mVelocity;
-            
-            // Equations from wikipedia: https://en.wikipedia.org/wiki/Elastic_collision
-            // section "Two-dimensional collision with two moving objects". Used in 3d space here.
-            auto dv1 = -pos1MinusPos2 * v1MinusV2.Dot(pos1MinusPos2) / distSquared;
-            auto dv2 = -pos2MinusPos1 * v2MinusV1.Dot(pos2MinusPos1) / distSquared;
-
-            auto newPos1 = block1Position + (block1.mVelocity + dv1) * dt;
-            auto newPos2 = block2Position + (block2.mVelocity + dv2) * dt;
-            auto newDistSquared = (newPos1 - newPos2).LengthSquared();
-            
-            if (newDistSquared > distSquared) {
-                block1.mVelocity += dv1;
-                block2.mVelocity += dv2;
-            }
-        }
+    for (auto& flyingBlock: mFlyingBlocks) {
+        mCollisionBlocks.PushBack({
+            flyingBlock.mSceneObject->GetTransform().GetPosition(),
+            flyingBlock.mVelocity
+        });
+    }
+    
+    mCollisions.Handle(mCollisionBlocks, dt);
+    
+    for (auto i = 0; i < mFlyingBlocks.Size(); ++i) {
+        mFlyingBlocks.At(i).mVelocity = mCollisionBlocks.At(i).mVelocity;
     }
 }
 
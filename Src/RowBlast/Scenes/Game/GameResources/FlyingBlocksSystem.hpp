@@ -11,6 +11,7 @@
 
 // Game includes.
 #include "Field.hpp"
+#include "FlyingBlockCollisions.hpp"
 
 namespace RowBlast {
     class GameScene;
@@ -81,7 +82,8 @@ namespace RowBlast {
         FlyingBlocks mFlyingBlocks;
         std::vector<std::unique_ptr<Pht::SceneObject>> mSceneObjects;
         FreeSceneObjects mFreeSceneObjects;
-        float mIntersectionDistanceSquared {0.0f};
+        FlyingBlockCollisions mCollisions;
+        FlyingBlockCollisions::Blocks mCollisionBlocks;
     };
 }
 
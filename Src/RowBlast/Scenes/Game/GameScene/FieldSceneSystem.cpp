@@ -20,6 +20,7 @@ using namespace RowBlast;
 namespace {
     constexpr auto dz = 0.025f;
     constexpr auto numVisibleGridRows = 17;
+    const SubCellAnimations pieceBlockAnimations {};
     
     float GhostPieceTriangleBlockRotationToDeg(BlockKind blockKind, Rotation rotation) {
         auto baseRotation = 0.0f;
@@ -88,32 +89,25 @@ void FieldSceneSystem::Update() {
 
 void FieldSceneSystem::UpdateFieldGrid() {
     auto& gridSegments = mScene.GetFieldGrid().GetSegments();
-    for (auto& gridSegment: gridSegments) {
-        gridSegment.mSceneObject.SetIsVisible(false);
-    }
-    
     auto lowestVisibleRow = static_cast<int>(mScrollController.GetLowestVisibleRow());
     auto pastHighestVisibleRow = lowestVisibleRow + numVisibleGridRows;
     auto numSegments = static_cast<int>(gridSegments.size());
+    auto lowestVisibleSegmentIndex = numSegments;
     
     for (auto i = numSegments - 1; i >= 0; --i) {
-        auto& gridSegment = gridSegments[i];
-        if (gridSegment.mRow <= lowestVisibleRow) {
-            for (auto visibleSegmentIndex = i;
-                 visibleSegmentIndex < numSegments;
-                 ++visibleSegmentIndex) {
-
-                auto& visibleGridSegment = gridSegments[visibleSegmentIndex];
-                if (visibleGridSegment.mRow >= pastHighestVisibleRow) {
-                    break;
-                }
-                
-                visibleGridSegment.mSceneObject.SetIsVisible(true);
-            }
-            
+        if (gridSegments[i].mRow <= lowestVisibleRow) {
+            lowestVisibleSegmentIndex = i;
             break;
         }
     }
+    
+    // The segments are not hidden and shown again on every update, since changing the visibility
+    // makes the renderer collect the scene objects again.
+    for (auto i = 0; i < numSegments; ++i) {
+        auto& gridSegment = gridSegments[i];
+        gridSegment.mSceneObject.SetIsVisible(i >= lowestVisibleSegmentIndex &&
+                                              gridSegment.mRow < pastHighestVisibleRow);
+    }
 }
 
 void FieldSceneSystem::UpdateBlueprintSlots() {
@@ -163,13 +157,16 @@ void FieldSceneSystem::UpdateFieldBlocks() {
     for (auto row = lowestVisibleRow; row < pastHighestVisibleRow; row++) {
         for (auto column = 0; column < mField.GetNumColumns(); column++) {
             auto& cell = mField.GetCell(row, column);
-            UpdateFieldBlock(cell.mFirstSubCell, false);
-            UpdateFieldBlock(cell.mSecondSubCell, true);
+            auto& cellAnimations = mField.GetCellAnimations(row, column);
+            UpdateFieldBlock(cell.mFirstSubCell, cellAnimations.mFirstSubCell, false);
+            UpdateFieldBlock(cell.mSecondSubCell, cellAnimations.mSecondSubCell, true);
         }
     }
 }
 
-void FieldSceneSystem::UpdateFieldBlock(const SubCell& subCell, bool isSecondSubCell) {
+void FieldSceneSystem::UpdateFieldBlock(const SubCell& subCell,
+                                        const SubCellAnimations& animations,
+                                        bool isSecondSubCell) {
     auto blockKind = subCell.mBlockKind;
     switch (blockKind) {
         case BlockKind::None:
@@ -183,11 +180,13 @@ void FieldSceneSystem::UpdateFieldBlock(const SubCell& subCell, bool isSecondSub
     auto& sceneObject = mScene.GetFieldBlocks().AccuireSceneObject();
     const auto cellSize = mScene.GetCellSize();
     
+    auto isBouncing =
+        animations.mFallingBlockAnimation.mState == FallingBlockAnimationComponent::State::Bouncing;
+    
     Pht::Vec3 blockPosition {
         subCell.mPosition.x * cellSize + cellSize / 2.0f,
         subCell.mPosition.y * cellSize + cellSize / 2.0f,
-        subCell.mFallingBlockAnimation.mState == FallingBlockAnimationComponent::State::Bouncing ?
-        mScene.GetBouncingBlockZ() : 0.0f
+        isBouncing ? mScene.GetBouncingBlockZ() : 0.0f
     };
 
     auto& transform = sceneObject.GetTransform();
@@ -222,22 +221,28 @@ void FieldSceneSystem::UpdateFieldBlock(const SubCell& subCell, bool isSecondSub
                 sceneObject.SetRenderable(&mLevelResources.GetLevelBlockRenderable(blockKind));
             } else {
                 auto color = subCell.mColor;
-                auto brightness = subCell.mFlashingBlockAnimation.mBrightness;
+                auto brightness = animations.mFlashingBlockAnimation.mBrightness;
                 auto& renderableObject =
                     mPieceResources.GetBlockRenderableObject(blockKind, color, brightness);
                 sceneObject.SetRenderable(&renderableObject);
-                UpdateBlockBonds(subCell, blockPosition, mScene.GetFieldBlocks(), isSecondSubCell);
+                UpdateBlockBonds(subCell,
+                                 animations,
+                                 blockPosition,
+                                 mScene.GetFieldBlocks(),
+                                 isSecondSubCell);
             }
             break;
     }
 }
 
 void FieldSceneSystem::UpdateBlockBonds(const SubCell& subCell,
+                                        const SubCellAnimations& animations,
                                         const Pht::Vec3& blockPos,
                                         SceneObjectPool& pool,
                                         bool isSecondSubCell) {
     auto& bonds = subCell.mBonds;
-    auto& bondAnimations = subCell.mBondAnimations;
+    auto& bondAnimations = animations.mBondAnimations;
+    auto flashingBrightness = animations.mFlashingBlockAnimation.mBrightness;
     const auto cellSize = mScene.GetCellSize();
     auto bondZ = blockPos.z + cellSize / 2.0f;
     
@@ -245,7 +250,10 @@ void FieldSceneSystem::UpdateBlockBonds(const SubCell& subCell,
         UpdateBlockBond({blockPos.x - cellSize / 2.0f, blockPos.y + cellSize / 2.0f, bondZ},
                         45.0f,
                         bondAnimations.mUpLeft.mScale,
-                        GetBondRenderable(BondRenderableKind::Aslope, subCell, bondAnimations.mUpLeft),
+                        GetBondRenderable(BondRenderableKind::Aslope,
+                                          subCell.mColor,
+                                          flashingBrightness,
+                                          bondAnimations.mUpLeft),
                         pool);
     }
     
@@ -253,7 +261,10 @@ void FieldSceneSystem::UpdateBlockBonds(const SubCell& subCell,
         UpdateBlockBond({blockPos.x, blockPos.y + cellSize / 2.0f, bondZ},
                         -90.0f,
                         bondAnimations.mUp.mScale,
-                        GetBondRenderable(BondRenderableKind::Normal, subCell, bondAnimations.mUp),
+                        GetBondRenderable(BondRenderableKind::Normal,
+                                          subCell.mColor,
+                                          flashingBrightness,
+                                          bondAnimations.mUp),
                         pool);
     }
     
@@ -261,7 +272,10 @@ void FieldSceneSystem::UpdateBlockBonds(const SubCell& subCell,
         UpdateBlockBond({blockPos.x + cellSize / 2.0f, blockPos.y + cellSize / 2.0f, bondZ},
                         -45.0f,
                         bondAnimations.mUpRight.mScale,
-                        GetBondRenderable(BondRenderableKind::Aslope, subCell, bondAnimations.mUpRight),
+                        GetBondRenderable(BondRenderableKind::Aslope,
+                                          subCell.mColor,
+                                          flashingBrightness,
+                                          bondAnimations.mUpRight),
                         pool);
     }
 
@@ -269,7 +283,10 @@ void FieldSceneSystem::UpdateBlockBonds(const SubCell& subCell,
         UpdateBlockBond({blockPos.x + cellSize / 2.0f, blockPos.y, bondZ},
                         0.0f,
                         bondAnimations.mRight.mScale,
-                        GetBondRenderable(BondRenderableKind::Normal, subCell, bondAnimations.mRight),
+                        GetBondRenderable(BondRenderableKind::Normal,
+                                          subCell.mColor,
+                                          flashingBrightness,
+                                          bondAnimations.mRight),
                         pool);
     }
 
@@ -279,7 +296,7 @@ void FieldSceneSystem::UpdateBlockBonds(const SubCell& subCell,
         
         auto brightness =
             diagonalAnimation.IsSemiFlashing() ?
-            BlockBrightness::SemiFlashing : subCell.mFlashingBlockAnimation.mBrightness;
+            BlockBrightness::SemiFlashing : flashingBrightness;
         
         auto& diagonalBondRenderable =
             mPieceResources.GetBondRenderableObject(BondRenderableKind::Diagonal, color, brightness);
@@ -310,13 +327,11 @@ void FieldSceneSystem::UpdateBlockBonds(const SubCell& subCell,
 }
 
 Pht::RenderableObject& FieldSceneSystem::GetBondRenderable(BondRenderableKind renderableKind,
-                                                           const SubCell& subCell,
+                                                           BlockColor color,
+                                                           BlockBrightness flashingBrightness,
                                                            const BondAnimation& bondAnimation) {
-    auto color = subCell.mColor;
-    
     auto brightness =
-        bondAnimation.IsSemiFlashing() ?
-        BlockBrightness::SemiFlashing : subCell.mFlashingBlockAnimation.mBrightness;
+        bondAnimation.IsSemiFlashing() ? BlockBrightness::SemiFlashing : flashingBrightness;
     
     return mPieceResources.GetBondRenderableObject(renderableKind, color, brightness);
 }
@@ -504,7 +519,7 @@ void FieldSceneSystem::UpdatePieceBlocks(const Piece& pieceType,
                 
                 sceneObject.SetRenderable(&blockRenderableObject);
 
-                UpdateBlockBonds(subCell, blockPosition, pool, false);
+                UpdateBlockBonds(subCell, pieceBlockAnimations, blockPosition, pool, false);
             }
         }
     }
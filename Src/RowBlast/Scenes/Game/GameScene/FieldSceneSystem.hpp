@@ -49,13 +49,17 @@ namespace RowBlast {
         void UpdateFieldGrid();
         void UpdateBlueprintSlots();
         void UpdateFieldBlocks();
-        void UpdateFieldBlock(const SubCell& subCell, bool isSecondSubCell);
+        void UpdateFieldBlock(const SubCell& subCell,
+                              const SubCellAnimations& animations,
+                              bool isSecondSubCell);
         void UpdateBlockBonds(const SubCell& subCell,
+                              const SubCellAnimations& animations,
                               const Pht::Vec3& blockPos,
                               SceneObjectPool& pool,
                               bool isSecondSubCell);
         Pht::RenderableObject& GetBondRenderable(BondRenderableKind renderableKind,
-                                                 const SubCell& subCell,
+                                                 BlockColor color,
+                                                 BlockBrightness flashingBrightness,
                                                  const BondAnimation& bondAnimation);
         void UpdateFallingPiece();
         Pht::Vec2 CalculateFallingPieceGridPosition(const FallingPiece& fallingPiece);
@@ -148,7 +148,7 @@ GameController::GameController(Pht::IEngine& engine,
     } {}
 
 void GameController::Init(int levelId) {
-    mLevel = LevelLoader::Load(levelId, mLevelResources);
+    mLevel = LevelLoader::Load(levelId, mLevelResources.GetPieceTypes());
 
     mField.Init(*mLevel);
     mScrollController.Init(mLevel->GetObjective());
@@ -896,7 +896,7 @@ void GameController::GoToPausedStateLevelInfoDialog() {
     mPausedState = PausedState::LevelInfoDialog;
     mGameViewControllers.SetActiveController(GameViewControllers::LevelGoalDialog);
     
-    auto levelInfo = LevelLoader::LoadInfo(mLevel->GetId(), mLevelResources);
+    auto levelInfo = LevelLoader::LoadInfo(mLevel->GetId(), mLevelResources.GetPieceTypes());
     mGameViewControllers.GetLevelGoalDialogController().SetUp(*levelInfo);
 }
 
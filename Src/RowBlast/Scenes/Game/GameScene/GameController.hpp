@@ -76,6 +76,10 @@ namespace RowBlast {
         PieceResources& GetPieceResources() {
             return mPieceResources;
         }
+        
+        const GameLogic& GetGameLogic() const {
+            return mGameLogic;
+        }
     
     private:
         Command UpdateGame();
@@ -10,6 +10,7 @@
 
 // Game includes.
 #include "Cell.hpp"
+#include "GhostPieceBorder.hpp"
 
 namespace Pht {
     class IEngine;
@@ -19,37 +20,6 @@ namespace Pht {
 namespace RowBlast {
     class CommonResources;
     
-    enum class BorderSegmentKind {
-        Start,
-        Upper,
-        Right,
-        RightForTriangle,
-        Lower,
-        LowerForTriangle,
-        LowerForPyramid,
-        Left,
-        UpperLeftConcaveCorner,
-        LowerLeftConcaveCorner,
-        UpperRightConcaveCorner,
-        LowerRightConcaveCorner,
-        ConnectionForSeven,
-        ConnectionForMirroredSeven,
-        UpperLeftTiltForTriangle,
-        UpperLeftTiltForPyramid,
-        UpperRightTiltForPyramid,
-        LowerRightTiltForDiamond,
-        UpperRightTiltForDiamond,
-        UpperLeftTiltForDiamond,
-        LowerLeftTiltForDiamond
-    };
-    
-    struct GhostPieceBorderSegment {
-        Pht::IVec2 mPosition;
-        BorderSegmentKind mKind;
-    };
-    
-    using GhostPieceBorder = std::vector<GhostPieceBorderSegment>;
-    
     class GhostPieceProducer {
     public:
         struct GhostPieceRenderables {
@@ -1,5 +1,6 @@
 #include "SceneObjectPool.hpp"
 
+#include <algorithm>
 #include <assert.h>
 
 // Game includes.
@@ -43,26 +44,30 @@ SceneObjectPool::SceneObjectPool(SceneObjectPoolKind poolKind,
     
     for (auto& sceneObject: mSceneObjects) {
         sceneObject = std::make_unique<Pht::SceneObject>();
+        sceneObject->SetIsStatic(true);
         mContainerSceneObject->AddChild(*sceneObject);
     }
-    
-    ReclaimAll();
 }
 
 void SceneObjectPool::ReclaimAll() {
-    mNextAvailableIndex = 0;
-
-    for (auto& sceneObject: mSceneObjects) {
-        sceneObject->SetIsVisible(false);
-        sceneObject->SetIsStatic(true);
+    // The scene objects stay visible and only lose their renderables, since hiding and showing
+    // them would make the renderer collect the scene objects again every time the pool is redrawn.
+    auto numAccuiredSceneObjects =
+        std::min(mNextAvailableIndex, static_cast<int>(mSceneObjects.size()));
+    
+    for (auto i = 0; i < numAccuiredSceneObjects; ++i) {
+        auto& sceneObject = *mSceneObjects[i];
+        sceneObject.SetRenderable(nullptr);
+        sceneObject.SetIsStatic(true);
     }
+    
+    mNextAvailableIndex = 0;
 }
 
 Pht::SceneObject& SceneObjectPool::AccuireSceneObject() {
     assert(mNextAvailableIndex < mSceneObjects.size());
     
     auto& sceneObject = *mSceneObjects[mNextAvailableIndex % mSceneObjects.size()];
-    sceneObject.SetIsVisible(true);
     sceneObject.SetIsStatic(false);
     sceneObject.GetTransform().Reset();
     ++mNextAvailableIndex;
@@ -150,8 +150,8 @@ void OutOfMovesContinueDialogView::CreateGlowEffect(Pht::SceneObject& parentObje
         .mZAngularVelocityRandomPart = 10.0f,
         .mSize = Pht::Vec2{11.25f, 11.25f},
         .mSizeRandomPart = 0.0f,
-        .mShrinkDuration = 0.0f,
-        .mGrowDuration = 0.5f
+        .mGrowDuration = 0.5f,
+        .mShrinkDuration = 0.0f
     };
     
     auto& particleSystem = mEngine.GetParticleSystem();
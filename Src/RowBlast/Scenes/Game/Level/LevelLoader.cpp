@@ -3,9 +3,6 @@
 // Engine includes.
 #include "JsonUtil.hpp"
 
-// Game includes.
-#include "LevelResources.hpp"
-
 using namespace RowBlast;
 
 namespace {
@@ -384,14 +381,13 @@ namespace {
     }
 }
 
-std::unique_ptr<Level> LevelLoader::Load(int levelId, const LevelResources& levelResources) {
+std::unique_ptr<Level> LevelLoader::Load(int levelId, const PieceTypes& pieceTypes) {
     rapidjson::Document document;
     Pht::Json::ParseFile(document, "level" + std::to_string(levelId) + ".json");
 
     auto speed = Pht::Json::ReadFloat(document, "speed");
     auto moves = Pht::Json::ReadInt(document, "moves");
     auto starLimits = ReadStarLimits(document);
-    auto& pieceTypes = levelResources.GetPieceTypes();
     auto musicTrack = Pht::Json::ReadInt(document, "musicTrack");
     auto backgroundTextureFilename = Pht::Json::ReadString(document, "background");
     auto floatingBlocksSet = ReadFloatingBlocksSet(document);
@@ -460,12 +456,11 @@ std::unique_ptr<Level> LevelLoader::Load(int levelId, const LevelResources& leve
     return level;
 }
 
-std::unique_ptr<LevelInfo> LevelLoader::LoadInfo(int levelId,
-                                                 const LevelResources& levelResources) {
+std::unique_ptr<LevelInfo> LevelLoader::LoadInfo(int levelId, const PieceTypes& pieceTypes) {
     rapidjson::Document document;
     Pht::Json::ParseFile(document, "level" + std::to_string(levelId) + ".json");
 
-    auto levelPieces = ReadPieceTypes(document, "pieces", levelResources.GetPieceTypes());
+    auto levelPieces = ReadPieceTypes(document, "pieces", pieceTypes);
     
     Level::Objective objective;
     if (document.HasMember("clearGrid")) {
@@ -3,13 +3,12 @@
 
 // Game includes.
 #include "Level.hpp"
+#include "PieceFactory.hpp"
 
 namespace RowBlast {
-    class LevelResources;
-    
     namespace LevelLoader {
-        std::unique_ptr<Level> Load(int levelId, const LevelResources& levelResources);
-        std::unique_ptr<LevelInfo> LoadInfo(int levelId, const LevelResources& levelResources);
+        std::unique_ptr<Level> Load(int levelId, const PieceTypes& pieceTypes);
+        std::unique_ptr<LevelInfo> LoadInfo(int levelId, const PieceTypes& pieceTypes);
     }
 }
 
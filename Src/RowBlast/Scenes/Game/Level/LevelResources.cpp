@@ -12,28 +12,6 @@
 
 // Game includes.
 #include "CommonResources.hpp"
-#include "SmallTrianglePiece.hpp"
-#include "TrianglePiece.hpp"
-#include "BigTrianglePiece.hpp"
-#include "DiamondPiece.hpp"
-#include "PyramidPiece.hpp"
-#include "LongIPiece.hpp"
-#include "MiddleIPiece.hpp"
-#include "ShortIPiece.hpp"
-#include "LPiece.hpp"
-#include "BPiece.hpp"
-#include "DPiece.hpp"
-#include "SevenPiece.hpp"
-#include "MirroredSevenPiece.hpp"
-#include "FPiece.hpp"
-#include "MirroredFPiece.hpp"
-#include "BigLPiece.hpp"
-#include "ZPiece.hpp"
-#include "MirroredZPiece.hpp"
-#include "TPiece.hpp"
-#include "PlusPiece.hpp"
-#include "Bomb.hpp"
-#include "RowBomb.hpp"
 
 using namespace RowBlast;
 
@@ -49,28 +27,34 @@ LevelResources::LevelResources(Pht::IEngine& engine, const CommonResources& comm
 
 void LevelResources::CreatePieceTypes(Pht::IEngine& engine,
                                       const CommonResources& commonResources) {
-    mPieceTypes["LongI"] = std::make_unique<LongIPiece>(engine, commonResources);
-    mPieceTypes["I"] = std::make_unique<MiddleIPiece>(engine, commonResources);
-    mPieceTypes["ShortI"] = std::make_unique<ShortIPiece>(engine, commonResources);
-    mPieceTypes["L"] = std::make_unique<LPiece>(engine, commonResources);
-    mPieceTypes["B"] = std::make_unique<BPiece>(engine, commonResources);
-    mPieceTypes["D"] = std::make_unique<DPiece>(engine, commonResources);
-    mPieceTypes["Seven"] = std::make_unique<SevenPiece>(engine, commonResources);
-    mPieceTypes["MirroredSeven"] = std::make_unique<MirroredSevenPiece>(engine, commonResources);
-    mPieceTypes["F"] = std::make_unique<FPiece>(engine, commonResources);
-    mPieceTypes["MirroredF"] = std::make_unique<MirroredFPiece>(engine, commonResources);
-    mPieceTypes["BigL"] = std::make_unique<BigLPiece>(engine, commonResources);
-    mPieceTypes["Z"] = std::make_unique<ZPiece>(engine, commonResources);
-    mPieceTypes["MirroredZ"] = std::make_unique<MirroredZPiece>(engine, commonResources);
-    mPieceTypes["T"] = std::make_unique<TPiece>(engine, commonResources);
-    mPieceTypes["Plus"] = std::make_unique<PlusPiece>(engine, commonResources);
-    mPieceTypes["SmallTriangle"] = std::make_unique<SmallTrianglePiece>(engine, commonResources);
-    mPieceTypes["Triangle"] = std::make_unique<TrianglePiece>(engine, commonResources);
-    mPieceTypes["BigTriangle"] = std::make_unique<BigTrianglePiece>(engine, commonResources);
-    mPieceTypes["Diamond"] = std::make_unique<DiamondPiece>(engine, commonResources);
-    mPieceTypes["Pyramid"] = std::make_unique<PyramidPiece>(engine, commonResources);
-    mPieceTypes["Bomb"] = std::make_unique<Bomb>();
-    mPieceTypes["RowBomb"] = std::make_unique<RowBomb>();
+    for (auto& pieceName: PieceFactory::GetPieceNames()) {
+        auto piece = PieceFactory::CreatePiece(pieceName);
+        CreatePieceRenderables(*piece, engine, commonResources);
+        mPieceTypes[pieceName] = std::move(piece);
+    }
+}
+
+void LevelResources::CreatePieceRenderables(Piece& piece,
+                                            Pht::IEngine& engine,
+                                            const CommonResources& commonResources) {
+    auto& border = piece.GetGhostPieceBorder();
+    if (border.empty()) {
+        return;
+    }
+    
+    GhostPieceProducer ghostPieceProducer {engine, piece.GetGhostPieceGridSize(), commonResources};
+    auto renderables = ghostPieceProducer.DrawRenderables(border, piece.GetColor());
+    
+    Piece::Renderables pieceRenderables {
+        renderables.mDraggedPiece.get(),
+        renderables.mHighlightedDraggedPiece.get(),
+        renderables.mShadow.get(),
+        renderables.mGhostPiece.get(),
+        renderables.mHighlightedGhostPiece.get()
+    };
+    
+    piece.SetRenderables(pieceRenderables);
+    mPieceRenderables.push_back(std::move(renderables));
 }
 
 void LevelResources::CreateGreyBlockRenderables(Pht::ISceneManager& sceneManager,
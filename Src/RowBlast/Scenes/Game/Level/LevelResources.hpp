@@ -1,10 +1,11 @@
 #ifndef LevelResources_hpp
 #define LevelResources_hpp
 
-#include <map>
+#include <vector>
 
 // Game includes.
-#include "Piece.hpp"
+#include "PieceFactory.hpp"
+#include "GhostPieceProducer.hpp"
 
 namespace Pht {
     class IEngine;
@@ -14,8 +15,6 @@ namespace Pht {
 namespace RowBlast {
     class CommonResources;
     
-    using PieceTypes = std::map<std::string, std::unique_ptr<const Piece>>;
-    
     class LevelResources {
     public:
         LevelResources(Pht::IEngine& engine, const CommonResources& commonResources);
@@ -60,6 +59,9 @@ namespace RowBlast {
 
     private:
         void CreatePieceTypes(Pht::IEngine& engine, const CommonResources& commonResources);
+        void CreatePieceRenderables(Piece& piece,
+                                    Pht::IEngine& engine,
+                                    const CommonResources& commonResources);
         void CreateGreyBlockRenderables(Pht::ISceneManager& sceneManager,
                                         const CommonResources& commonResources);
         void CreateBlueprintRenderables(Pht::IEngine& engine,
@@ -70,6 +72,7 @@ namespace RowBlast {
         void CreateAsteroidFragmentRenderable(Pht::IEngine& engine);
         
         PieceTypes mPieceTypes;
+        std::vector<GhostPieceProducer::GhostPieceRenderables> mPieceRenderables;
         std::unique_ptr<Pht::RenderableObject> mGrayCube;
         std::unique_ptr<Pht::RenderableObject> mGrayTriangle;
         std::unique_ptr<Pht::RenderableObject> mBlueprintSquare;
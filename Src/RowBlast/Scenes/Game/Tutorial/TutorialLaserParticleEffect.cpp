@@ -126,9 +126,9 @@ void TutorialLaserParticleEffect::CreateParticles(Pht::IEngine& engine) {
     Pht::EmitterSettings particleEmitterSettings {
         .mPosition = Pht::Vec3{0.0f, 0.0f, 0.0f},
         .mSize = Pht::Vec3{7.0f, 1.0f, 0.0f},
-        .mBurst = 15,
         .mTimeToLive = 0.4f,
-        .mFrequency = 10.0f
+        .mFrequency = 10.0f,
+        .mBurst = 15
     };
     
     Pht::ParticleSettings particleSettings {
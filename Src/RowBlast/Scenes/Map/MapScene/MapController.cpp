@@ -18,6 +18,7 @@
 #include "NoLivesDialogController.hpp"
 #include "UserServices.hpp"
 #include "LevelLoader.hpp"
+#include "LevelResources.hpp"
 #include "Universe.hpp"
 #include "AudioResources.hpp"
 
@@ -659,7 +660,7 @@ void MapController::GoToStartLevelStateLevelGoalDialog(int levelToStart) {
     mLevelToStart = levelToStart;
     mMapViewControllers.SetActiveController(MapViewControllers::LevelGoalDialog);
 
-    auto levelInfo = LevelLoader::LoadInfo(levelToStart, mLevelResources);
+    auto levelInfo = LevelLoader::LoadInfo(levelToStart, mLevelResources.GetPieceTypes());
     mMapViewControllers.GetLevelGoalDialogController().SetUp(*levelInfo);
 }
 
@@ -1,5 +1,7 @@
 #include "MapHud.hpp"
 
+#include <cstring>
+
 // Engine includes.
 #include "IEngine.hpp"
 #include "Scene.hpp"
@@ -60,7 +60,11 @@ MapScene::MapScene(Pht::IEngine& engine,
     mUserServices {userServices},
     mCommonResources {commonResources},
     mUniverse {universe},
-    mFont {"ethnocentric_rg_it.ttf", engine.GetRenderer().GetAdjustedNumPixels(46)} {
+    mFont {
+        "ethnocentric_rg_it.ttf",
+        engine.GetRenderer().GetAdjustedNumPixels(46),
+        Pht::DistanceField::Yes
+    } {
 
     CreateRenderables();
 }
@@ -1,5 +1,6 @@
 #include "NextLevelParticleEffect.hpp"
 
+#include <limits>
 #include <assert.h>
 
 // Engine includes.
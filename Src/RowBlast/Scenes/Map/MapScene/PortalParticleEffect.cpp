@@ -1,5 +1,7 @@
 #include "PortalParticleEffect.hpp"
 
+#include <limits>
+
 // Engine includes.
 #include "IEngine.hpp"
 #include "Scene.hpp"
@@ -1,5 +1,7 @@
 #include "SunParticleEffect.hpp"
 
+#include <limits>
+
 // Engine includes.
 #include "IEngine.hpp"
 #include "Scene.hpp"
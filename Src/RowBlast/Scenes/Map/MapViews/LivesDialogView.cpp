@@ -1,5 +1,7 @@
 #include "LivesDialogView.hpp"
 
+#include <cstring>
+
 // Engine includes.
 #include "IEngine.hpp"
 #include "TextComponent.hpp"
@@ -118,8 +120,8 @@ void LivesDialogView::CreateGlowEffect(const Pht::Vec3& position,
         .mZAngularVelocityRandomPart = 10.0f,
         .mSize = Pht::Vec2{11.25f, 11.25f},
         .mSizeRandomPart = 0.0f,
-        .mShrinkDuration = 0.0f,
-        .mGrowDuration = 0.5f
+        .mGrowDuration = 0.5f,
+        .mShrinkDuration = 0.0f
     };
     
     auto& particleSystem = mEngine.GetParticleSystem();
@@ -37,7 +37,11 @@ namespace {
 
 TitleAnimation::TitleAnimation(Pht::IEngine& engine) :
     mEngine {engine},
-    mFont {"ethnocentric_rg_it.ttf", engine.GetRenderer().GetAdjustedNumPixels(100)},
+    mFont {
+        "ethnocentric_rg_it.ttf",
+        engine.GetRenderer().GetAdjustedNumPixels(100),
+        Pht::DistanceField::Yes
+    },
     mTextPosition {0.0f, 0.0f, 0.0f} {
     
     CreateText();
@@ -0,0 +1,182 @@
+#include "BenchmarkBaseline.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+// Engine includes.
+#include "JsonUtil.hpp"
+
+using namespace RowBlast;
+
+namespace {
+    // Differences below this are timer noise even if they exceed the relative threshold.
+    constexpr auto minRegressionMs = 0.002;
+    
+    const LevelBenchmark* FindLevel(const std::vector<LevelBenchmark>& levelBenchmarks,
+                                    int levelId) {
+        for (auto& levelBenchmark: levelBenchmarks) {
+            if (levelBenchmark.mLevelId == levelId) {
+                return &levelBenchmark;
+            }
+        }
+        
+        return nullptr;
+    }
+    
+    bool IsRegression(double latency, double baselineLatency, double thresholdPercent) {
+        return latency > baselineLatency * (1.0 + thresholdPercent / 100.0) &&
+               latency - baselineLatency > minRegressionMs;
+    }
+    
+    int CompareLatency(int levelId,
+                       const char* name,
+                       double latency,
+                       double baselineLatency,
+                       double thresholdPercent) {
+        if (!IsRegression(latency, baselineLatency, thresholdPercent)) {
+            return 0;
+        }
+        
+        std::printf("Level %d: %s p50 %.4f ms, baseline %.4f ms (%+.1f%%)\n",
+                    levelId,
+                    name,
+                    latency,
+                    baselineLatency,
+                    (latency / baselineLatency - 1.0) * 100.0);
+        return 1;
+    }
+    
+    int CompareCount(int levelId, const char* name, int count, int baselineCount) {
+        if (count == baselineCount) {
+            return 0;
+        }
+        
+        std::printf("Level %d: %d %s, baseline %d\n", levelId, count, name, baselineCount);
+        return 1;
+    }
+}
+
+bool BenchmarkBaseline::Write(const std::string& filename,
+                              const std::vector<LevelBenchmark>& levelBenchmarks,
+                              int numIterations) {
+    rapidjson::Document document;
+    auto& allocator = document.GetAllocator();
+    document.SetObject();
+    
+    Pht::Json::AddInt(document, "iterations", numIterations, allocator);
+    
+    rapidjson::Value levels {rapidjson::kArrayType};
+    
+    for (auto& levelBenchmark: levelBenchmarks) {
+        rapidjson::Value level {rapidjson::kObjectType};
+        Pht::Json::AddInt(level, "id", levelBenchmark.mLevelId, allocator);
+        Pht::Json::AddString(level, "objective", levelBenchmark.mObjective, allocator);
+        Pht::Json::AddInt(level, "pieceTypes", levelBenchmark.mNumPieceTypes, allocator);
+        Pht::Json::AddInt(level, "moves", levelBenchmark.mNumMoves, allocator);
+        Pht::Json::AddInt(level, "movements", levelBenchmark.mNumMovements, allocator);
+        Pht::Json::AddDouble(level,
+                             "findValidMovesP50Ms",
+                             levelBenchmark.mFindValidMovesP50,
+                             allocator);
+        Pht::Json::AddDouble(level,
+                             "findValidMovesP99Ms",
+                             levelBenchmark.mFindValidMovesP99,
+                             allocator);
+        Pht::Json::AddDouble(level,
+                             "calculateMovesP50Ms",
+                             levelBenchmark.mCalculateMovesP50,
+                             allocator);
+        Pht::Json::AddDouble(level,
+                             "calculateMovesP99Ms",
+                             levelBenchmark.mCalculateMovesP99,
+                             allocator);
+        levels.PushBack(level, allocator);
+    }
+    
+    Pht::Json::AddValue(document, "levels", levels, allocator);
+    
+    std::string jsonString;
+    Pht::Json::EncodeDocument(document, jsonString);
+    
+    std::ofstream file {filename};
+    if (!file.is_open()) {
+        return false;
+    }
+    
+    file << jsonString << "\n";
+    return file.good();
+}
+
+bool BenchmarkBaseline::Read(const std::string& filename,
+                             std::vector<LevelBenchmark>& levelBenchmarks) {
+    std::ifstream file {filename};
+    if (!file.is_open()) {
+        return false;
+    }
+    
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    
+    rapidjson::Document document;
+    Pht::Json::ParseDocument(document, buffer.str());
+    
+    if (document.HasParseError() || !document.IsObject() || !document.HasMember("levels") ||
+        !document["levels"].IsArray()) {
+        
+        return false;
+    }
+    
+    levelBenchmarks.clear();
+    
+    for (const auto& level: document["levels"].GetArray()) {
+        LevelBenchmark levelBenchmark;
+        levelBenchmark.mLevelId = Pht::Json::ReadInt(level, "id");
+        levelBenchmark.mObjective = Pht::Json::ReadString(level, "objective");
+        levelBenchmark.mNumPieceTypes = Pht::Json::ReadInt(level, "pieceTypes");
+        levelBenchmark.mNumMoves = Pht::Json::ReadInt(level, "moves");
+        levelBenchmark.mNumMovements = Pht::Json::ReadInt(level, "movements");
+        levelBenchmark.mFindValidMovesP50 = Pht::Json::ReadDouble(level, "findValidMovesP50Ms");
+        levelBenchmark.mFindValidMovesP99 = Pht::Json::ReadDouble(level, "findValidMovesP99Ms");
+        levelBenchmark.mCalculateMovesP50 = Pht::Json::ReadDouble(level, "calculateMovesP50Ms");
+        levelBenchmark.mCalculateMovesP99 = Pht::Json::ReadDouble(level, "calculateMovesP99Ms");
+        levelBenchmarks.push_back(levelBenchmark);
+    }
+    
+    return true;
+}
+
+int BenchmarkBaseline::Compare(const std::vector<LevelBenchmark>& levelBenchmarks,
+                               const std::vector<LevelBenchmark>& baseline,
+                               double thresholdPercent) {
+    auto numRegressions = 0;
+    
+    for (auto& levelBenchmark: levelBenchmarks) {
+        auto levelId = levelBenchmark.mLevelId;
+        auto* baselineLevel = FindLevel(baseline, levelId);
+        if (baselineLevel == nullptr) {
+            continue;
+        }
+        
+        numRegressions += CompareLatency(levelId,
+                                         "FindValidMoves",
+                                         levelBenchmark.mFindValidMovesP50,
+                                         baselineLevel->mFindValidMovesP50,
+                                         thresholdPercent);
+        numRegressions += CompareLatency(levelId,
+                                         "CalculateMoves",
+                                         levelBenchmark.mCalculateMovesP50,
+                                         baselineLevel->mCalculateMovesP50,
+                                         thresholdPercent);
+        numRegressions += CompareCount(levelId,
+                                       "moves",
+                                       levelBenchmark.mNumMoves,
+                                       baselineLevel->mNumMoves);
+        numRegressions += CompareCount(levelId,
+                                       "movements",
+                                       levelBenchmark.mNumMovements,
+                                       baselineLevel->mNumMovements);
+    }
+    
+    return numRegressions;
+}
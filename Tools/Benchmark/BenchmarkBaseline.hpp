@@ -0,0 +1,26 @@
+#ifndef BenchmarkBaseline_hpp
+#define BenchmarkBaseline_hpp
+
+#include <string>
+#include <vector>
+
+// Game includes.
+#include "MovesBenchmark.hpp"
+
+namespace RowBlast {
+    namespace BenchmarkBaseline {
+        bool Write(const std::string& filename,
+                   const std::vector<LevelBenchmark>& levelBenchmarks,
+                   int numIterations);
+        bool Read(const std::string& filename, std::vector<LevelBenchmark>& levelBenchmarks);
+        
+        // Prints the levels where a p50 latency is more than thresholdPercent slower than in the
+        // baseline or where the number of moves or movements differs. Returns the number of
+        // regressions.
+        int Compare(const std::vector<LevelBenchmark>& levelBenchmarks,
+                    const std::vector<LevelBenchmark>& baseline,
+                    double thresholdPercent);
+    }
+}
+
+#endif
@@ -0,0 +1,113 @@
+#include "CollisionsBenchmark.hpp"
+
+#include <chrono>
+#include <random>
+
+// Game includes.
+#include "LatencyStatistics.hpp"
+
+using namespace RowBlast;
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+    
+    // The same values as in GameScene and FlyingBlocksSystem.
+    constexpr auto cellSize = 1.25f;
+    constexpr auto explosionForceMagnitude = 12.0f;
+    const Pht::Vec3 gravitationalAcceleration {0.0f, -65.0f, 0.0f};
+    constexpr auto frameDuration = 1.0f / 60.0f;
+    constexpr auto numFrames = 60;
+    
+    bool IsSameVelocities(const FlyingBlockCollisions::Blocks& a,
+                          const FlyingBlockCollisions::Blocks& b) {
+        for (auto i = 0; i < a.Size(); ++i) {
+            if (a.At(i).mVelocity != b.At(i).mVelocity) {
+                return false;
+            }
+        }
+        
+        return a.Size() == b.Size();
+    }
+}
+
+CollisionsBenchmark::CollisionsBenchmark() :
+    mCollisions {cellSize} {}
+
+CollisionsBenchmarkResult CollisionsBenchmark::Run(int numIterations) {
+    CollisionsBenchmarkResult result;
+    result.mIsSameResult = true;
+    
+    LatencyStatistics allPairsLatencies;
+    LatencyStatistics broadphaseLatencies;
+    FlyingBlockCollisions::Blocks allPairsBlocks;
+    FlyingBlockCollisions::Blocks broadphaseBlocks;
+    
+    for (auto iteration = 0; iteration < numIterations; ++iteration) {
+        SetUpBurst(allPairsBlocks, iteration);
+        SetUpBurst(broadphaseBlocks, iteration);
+        
+        for (auto frame = 0; frame < numFrames; ++frame) {
+            MoveBlocks(allPairsBlocks, frameDuration);
+            MoveBlocks(broadphaseBlocks, frameDuration);
+            
+            auto startTime = Clock::now();
+            mCollisions.HandleAllPairs(allPairsBlocks, frameDuration);
+            allPairsLatencies.AddSample(Milliseconds {Clock::now() - startTime}.count());
+            
+            startTime = Clock::now();
+            mCollisions.Handle(broadphaseBlocks, frameDuration);
+            broadphaseLatencies.AddSample(Milliseconds {Clock::now() - startTime}.count());
+            
+            if (!IsSameVelocities(allPairsBlocks, broadphaseBlocks)) {
+                result.mIsSameResult = false;
+            }
+        }
+    }
+    
+    result.mNumBlocks = broadphaseBlocks.Size();
+    result.mNumFrames = numFrames * numIterations;
+    result.mAllPairsP50 = allPairsLatencies.CalculatePercentile(50.0);
+    result.mAllPairsP99 = allPairsLatencies.CalculatePercentile(99.0);
+    result.mBroadphaseP50 = broadphaseLatencies.CalculatePercentile(50.0);
+    result.mBroadphaseP99 = broadphaseLatencies.CalculatePercentile(99.0);
+    return result;
+}
+
+void CollisionsBenchmark::SetUpBurst(FlyingBlockCollisions::Blocks& blocks,
+                                     unsigned int seed) const {
+    std::mt19937 randomEngine {seed};
+    std::uniform_real_distribution<float> distribution {0.0f, 1.0f};
+    
+    blocks.Clear();
+    
+    for (auto row = 0; row < Field::maxNumRows; ++row) {
+        for (auto column = 0; column < Field::maxNumColumns; ++column) {
+            Pht::Vec3 forceDirection {
+                distribution(randomEngine) - 0.5f,
+                distribution(randomEngine) - 0.5f,
+                1.0f
+            };
+            
+            forceDirection.Normalize();
+            
+            FlyingBlockCollisions::Block block {
+                Pht::Vec3 {
+                    static_cast<float>(column) * cellSize + cellSize / 2.0f,
+                    static_cast<float>(row) * cellSize + cellSize / 2.0f,
+                    0.0f
+                },
+                forceDirection * explosionForceMagnitude
+            };
+            
+            blocks.PushBack(block);
+        }
+    }
+}
+
+void CollisionsBenchmark::MoveBlocks(FlyingBlockCollisions::Blocks& blocks, float dt) const {
+    for (auto& block: blocks) {
+        block.mVelocity += gravitationalAcceleration * dt;
+        block.mPosition += block.mVelocity * dt;
+    }
+}
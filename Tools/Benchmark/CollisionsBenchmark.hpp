@@ -0,0 +1,34 @@
+#ifndef CollisionsBenchmark_hpp
+#define CollisionsBenchmark_hpp
+
+// Game includes.
+#include "FlyingBlockCollisions.hpp"
+
+namespace RowBlast {
+    struct CollisionsBenchmarkResult {
+        int mNumBlocks {0};
+        int mNumFrames {0};
+        double mAllPairsP50 {0.0};
+        double mAllPairsP99 {0.0};
+        double mBroadphaseP50 {0.0};
+        double mBroadphaseP99 {0.0};
+        bool mIsSameResult {false};
+    };
+    
+    // Simulates the burst of flying blocks from clearing a whole field and times the collision
+    // handling of each frame with and without the broadphase.
+    class CollisionsBenchmark {
+    public:
+        CollisionsBenchmark();
+        
+        CollisionsBenchmarkResult Run(int numIterations);
+        
+    private:
+        void SetUpBurst(FlyingBlockCollisions::Blocks& blocks, unsigned int seed) const;
+        void MoveBlocks(FlyingBlockCollisions::Blocks& blocks, float dt) const;
+        
+        FlyingBlockCollisions mCollisions;
+    };
+}
+
+#endif
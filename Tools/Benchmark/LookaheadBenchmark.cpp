@@ -0,0 +1,135 @@
+#include "LookaheadBenchmark.hpp"
+
+#include <chrono>
+
+// Game includes.
+#include "Level.hpp"
+#include "LowestVisibleRow.hpp"
+#include "SpawnPosition.hpp"
+
+using namespace RowBlast;
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+    
+    constexpr auto halfColumn = 0.5f;
+}
+
+LookaheadBenchmark::LookaheadBenchmark() :
+    mFieldGravity {mField},
+    mAi {mField},
+    mLookaheadSearch {mField} {}
+
+void LookaheadBenchmark::SetEvaluationMode(Ai::EvaluationMode evaluationMode) {
+    mAi.SetEvaluationMode(evaluationMode);
+}
+
+LookaheadLevelBenchmark LookaheadBenchmark::Run(int levelId,
+                                                const Level& level,
+                                                int numIterations,
+                                                LatencyStatistics& allSearchLatencies) {
+    LatencyStatistics searchLatencies;
+    
+    for (auto iteration = 0; iteration < numIterations; ++iteration) {
+        Init(level);
+        Play(level, searchLatencies);
+    }
+    
+    LookaheadLevelBenchmark result;
+    result.mLevelId = levelId;
+    result.mNumSearches = searchLatencies.GetNumSamples();
+    result.mNumSearchesOverBudget = searchLatencies.CountSamplesAbove(GetTimeBudgetMs());
+    result.mSearchP50 = searchLatencies.CalculatePercentile(50.0);
+    result.mSearchMax = searchLatencies.CalculateMax();
+    
+    allSearchLatencies.Merge(searchLatencies);
+    return result;
+}
+
+void LookaheadBenchmark::Init(const Level& level) {
+    mField.Init(level);
+    mFieldGravity.Init();
+    mAi.Init(level);
+    mLookaheadSearch.Init(level);
+    mFallingPiece.ResetBetweenGames();
+    mNextPieceGenerator.Init(level.GetPieceTypes(), level.GetPieceSequence());
+    
+    mMovesLeft = level.GetNumMoves();
+    mMovesUsed = 0;
+    mPieceType = mNextPieceGenerator.GetNext(mMovesLeft);
+    mSelectablePieces[0] = mNextPieceGenerator.GetNext(mMovesLeft);
+    mSelectablePieces[1] = mNextPieceGenerator.GetNext(mMovesLeft);
+    
+    UpdateLowestVisibleRow(level);
+}
+
+void LookaheadBenchmark::Play(const Level& level, LatencyStatistics& searchLatencies) {
+    while (mMovesLeft > 0 && mPieceType && SpawnFallingPiece(level)) {
+        mSortedMoves = mAi.CalculateMoves(mFallingPiece, mMovesUsed);
+        if (mSortedMoves.IsEmpty()) {
+            return;
+        }
+        
+        auto startTime = Clock::now();
+        mLookaheadSearch.ReorderMoves(mSortedMoves, mFallingPiece, mSelectablePieces);
+        Milliseconds searchLatency {Clock::now() - startTime};
+        searchLatencies.AddSample(searchLatency.count());
+        
+        LandFallingPiece(level, *mSortedMoves.Front());
+        
+        --mMovesLeft;
+        ++mMovesUsed;
+        mPieceType = mSelectablePieces[0];
+        mSelectablePieces[0] = mSelectablePieces[1];
+        mSelectablePieces[1] = mNextPieceGenerator.GetNext(mMovesLeft);
+    }
+}
+
+bool LookaheadBenchmark::SpawnFallingPiece(const Level& level) {
+    auto& pieceType = *mPieceType;
+    
+    mFallingPiece.UpdateId();
+    mFallingPiece.Spawn(pieceType,
+                        SpawnPosition::Calculate(mField, level, pieceType),
+                        pieceType.GetSpawnRotation(),
+                        level.GetSpeed());
+    
+    auto rotation = mFallingPiece.GetRotation();
+    
+    PieceBlocks pieceBlocks {
+        pieceType.GetGrid(rotation),
+        pieceType.GetGridNumRows(),
+        pieceType.GetGridNumColumns(),
+        &pieceType.GetBitmask(rotation)
+    };
+    
+    auto ghostPieceRow = mField.DetectCollisionDown(pieceBlocks, mFallingPiece.GetIntPosition());
+    return ghostPieceRow <= mFallingPiece.GetPosition().y;
+}
+
+void LookaheadBenchmark::LandFallingPiece(const Level& level, const Move& move) {
+    // Bombs are not landed since the searches only need a field that fills up and clears the way
+    // it does in a game.
+    if (mPieceType->IsBomb() || mPieceType->IsRowBomb()) {
+        return;
+    }
+    
+    mFallingPiece.SetX(move.mPosition.x + halfColumn);
+    mFallingPiece.SetY(static_cast<float>(move.mPosition.y));
+    mFallingPiece.SetRotation(move.mRotation);
+    mField.LandFallingPiece(mFallingPiece, false);
+    
+    if (level.GetObjective() != Level::Objective::Build) {
+        while (mField.RemoveFilledRowsWithoutAnimation() > 0) {
+            mFieldGravity.PullDownLoosePieces();
+        }
+    }
+    
+    mField.ManageBonds();
+    UpdateLowestVisibleRow(level);
+}
+
+void LookaheadBenchmark::UpdateLowestVisibleRow(const Level& level) {
+    mField.SetLowestVisibleRow(LowestVisibleRow::CalculatePreferred(mField, level.GetObjective()));
+}
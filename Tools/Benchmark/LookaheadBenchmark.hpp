@@ -0,0 +1,62 @@
+#ifndef LookaheadBenchmark_hpp
+#define LookaheadBenchmark_hpp
+
+// Game includes.
+#include "Field.hpp"
+#include "FieldGravitySystem.hpp"
+#include "FallingPiece.hpp"
+#include "NextPieceGenerator.hpp"
+#include "LookaheadSearch.hpp"
+#include "Ai.hpp"
+#include "LatencyStatistics.hpp"
+
+namespace RowBlast {
+    class Level;
+    
+    struct LookaheadLevelBenchmark {
+        int mLevelId {0};
+        int mNumSearches {0};
+        int mNumSearchesOverBudget {0};
+        double mSearchP50 {0.0};
+        double mSearchMax {0.0};
+    };
+    
+    // Plays a level with the AI and times LookaheadSearch::ReorderMoves for every piece. The best
+    // move is landed without animations after each search, so the searches see the fields of a
+    // game in progress and not only the initial field.
+    class LookaheadBenchmark {
+    public:
+        LookaheadBenchmark();
+        
+        void SetEvaluationMode(Ai::EvaluationMode evaluationMode);
+        LookaheadLevelBenchmark Run(int levelId,
+                                    const Level& level,
+                                    int numIterations,
+                                    LatencyStatistics& allSearchLatencies);
+        
+        float GetTimeBudgetMs() const {
+            return mLookaheadSearch.GetSettings().mTimeBudgetMs;
+        }
+    
+    private:
+        void Init(const Level& level);
+        void Play(const Level& level, LatencyStatistics& searchLatencies);
+        bool SpawnFallingPiece(const Level& level);
+        void LandFallingPiece(const Level& level, const Move& move);
+        void UpdateLowestVisibleRow(const Level& level);
+        
+        Field mField;
+        FieldGravitySystem mFieldGravity;
+        Ai mAi;
+        LookaheadSearch mLookaheadSearch;
+        FallingPiece mFallingPiece;
+        NextPieceGenerator mNextPieceGenerator;
+        const Piece* mPieceType {nullptr};
+        TwoPieces mSelectablePieces;
+        MovePtrs mSortedMoves;
+        int mMovesLeft {0};
+        int mMovesUsed {0};
+    };
+}
+
+#endif
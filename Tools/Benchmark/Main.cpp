@@ -0,0 +1,222 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Game includes.
+#include "MovesBenchmark.hpp"
+#include "CollisionsBenchmark.hpp"
+#include "LookaheadBenchmark.hpp"
+#include "BenchmarkBaseline.hpp"
+#include "LevelFiles.hpp"
+#include "PieceFactory.hpp"
+
+using namespace RowBlast;
+
+namespace {
+    struct Options {
+        std::string mLevelsDirectory {"Assets/Levels"};
+        std::string mOutputFilename;
+        std::string mBaselineFilename;
+        double mThresholdPercent {20.0};
+        int mNumIterations {10};
+        bool mSerial {false};
+        bool mCollisions {false};
+        bool mLookahead {false};
+    };
+    
+    void PrintUsage(const char* programName) {
+        std::printf("Usage: %s [--iterations <n>] [--serial] [--collisions] [--lookahead] "
+                    "[--output <file>] [--baseline <file>] [--threshold <percent>] "
+                    "[levels directory]\n",
+                    programName);
+    }
+    
+    bool ParseOptions(int argc, char* argv[], Options& options) {
+        for (auto i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+                options.mNumIterations = std::atoi(argv[++i]);
+            } else if (std::strcmp(argv[i], "--serial") == 0) {
+                options.mSerial = true;
+            } else if (std::strcmp(argv[i], "--collisions") == 0) {
+                options.mCollisions = true;
+            } else if (std::strcmp(argv[i], "--lookahead") == 0) {
+                options.mLookahead = true;
+            } else if (std::strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+                options.mOutputFilename = argv[++i];
+            } else if (std::strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+                options.mBaselineFilename = argv[++i];
+            } else if (std::strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) {
+                options.mThresholdPercent = std::atof(argv[++i]);
+            } else if (argv[i][0] == '-') {
+                return false;
+            } else {
+                options.mLevelsDirectory = argv[i];
+            }
+        }
+        
+        return options.mNumIterations > 0;
+    }
+    
+    int RunCollisionsBenchmark(const Options& options) {
+        CollisionsBenchmark benchmark;
+        benchmark.Run(1);
+        
+        auto result = benchmark.Run(options.mNumIterations);
+        
+        std::printf("%-12s %12s %12s\n", "collisions", "p50", "p99");
+        std::printf("%-12s %12.4f %12.4f\n", "all pairs", result.mAllPairsP50, result.mAllPairsP99);
+        std::printf("%-12s %12.4f %12.4f\n",
+                    "broadphase",
+                    result.mBroadphaseP50,
+                    result.mBroadphaseP99);
+        std::printf("\n%d blocks, %d frames\n", result.mNumBlocks, result.mNumFrames);
+        
+        if (!result.mIsSameResult) {
+            std::printf("The broadphase gave different velocities than all pairs\n");
+            return 1;
+        }
+        
+        return 0;
+    }
+    
+    int RunLookaheadBenchmark(const Options& options,
+                              const std::vector<LevelFile>& levelFiles,
+                              const PieceTypes& pieceTypes) {
+        LookaheadBenchmark benchmark;
+        benchmark.SetEvaluationMode(options.mSerial ? Ai::EvaluationMode::Serial :
+                                                      Ai::EvaluationMode::Parallel);
+        
+        LatencyStatistics allSearchLatencies;
+        
+        std::printf("%-6s %8s %12s %12s %12s\n",
+                    "level", "searches", "search p50", "search max", "over budget");
+        
+        for (auto& levelFile: levelFiles) {
+            auto level = LevelFiles::Load(levelFile, pieceTypes);
+            auto levelBenchmark =
+                benchmark.Run(levelFile.mId, *level, options.mNumIterations, allSearchLatencies);
+            
+            std::printf("%-6d %8d %12.4f %12.4f %12d\n",
+                        levelBenchmark.mLevelId,
+                        levelBenchmark.mNumSearches,
+                        levelBenchmark.mSearchP50,
+                        levelBenchmark.mSearchMax,
+                        levelBenchmark.mNumSearchesOverBudget);
+        }
+        
+        auto timeBudget = benchmark.GetTimeBudgetMs();
+        auto numSearches = allSearchLatencies.GetNumSamples();
+        auto numSearchesOverBudget = allSearchLatencies.CountSamplesAbove(timeBudget);
+        
+        std::printf("\n%d searches, p50 %.4f ms, max %.4f ms, "
+                    "%d over the %.1f ms budget (%.2f%%)\n",
+                    numSearches,
+                    allSearchLatencies.CalculatePercentile(50.0),
+                    allSearchLatencies.CalculateMax(),
+                    numSearchesOverBudget,
+                    timeBudget,
+                    numSearches > 0 ? 100.0 * numSearchesOverBudget / numSearches : 0.0);
+        
+        return 0;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+    
+    if (options.mCollisions) {
+        return RunCollisionsBenchmark(options);
+    }
+    
+    std::vector<LevelBenchmark> baseline;
+    if (!options.mBaselineFilename.empty() &&
+        !BenchmarkBaseline::Read(options.mBaselineFilename, baseline)) {
+        
+        std::fprintf(stderr, "Could not read baseline %s\n", options.mBaselineFilename.c_str());
+        return 1;
+    }
+    
+    auto levelFiles = LevelFiles::Find(options.mLevelsDirectory);
+    if (levelFiles.empty()) {
+        std::fprintf(stderr, "No level files found in %s\n", options.mLevelsDirectory.c_str());
+        return 1;
+    }
+    
+    auto pieceTypes = PieceFactory::CreatePieceTypes();
+    
+    if (options.mLookahead) {
+        return RunLookaheadBenchmark(options, levelFiles, pieceTypes);
+    }
+    
+    MovesBenchmark benchmark;
+    benchmark.SetEvaluationMode(options.mSerial ? Ai::EvaluationMode::Serial :
+                                                  Ai::EvaluationMode::Parallel);
+    
+    // Warm up the caches and the allocator so that the first level is not penalized.
+    auto warmUpLevel = LevelFiles::Load(levelFiles.front(), pieceTypes);
+    benchmark.Run(levelFiles.front().mId, *warmUpLevel, pieceTypes, 1);
+    
+    std::vector<LevelBenchmark> levelBenchmarks;
+    auto totalMoves = 0;
+    auto totalMovements = 0;
+    
+    std::printf("%-6s %-21s %6s %6s %9s %12s %12s %12s %12s\n",
+                "level", "objective", "pieces", "moves", "movements",
+                "search p50", "search p99", "ai p50", "ai p99");
+    
+    for (auto& levelFile: levelFiles) {
+        auto level = LevelFiles::Load(levelFile, pieceTypes);
+        auto levelBenchmark =
+            benchmark.Run(levelFile.mId, *level, pieceTypes, options.mNumIterations);
+        
+        std::printf("%-6d %-21s %6d %6d %9d %12.4f %12.4f %12.4f %12.4f\n",
+                    levelBenchmark.mLevelId,
+                    levelBenchmark.mObjective.c_str(),
+                    levelBenchmark.mNumPieceTypes,
+                    levelBenchmark.mNumMoves,
+                    levelBenchmark.mNumMovements,
+                    levelBenchmark.mFindValidMovesP50,
+                    levelBenchmark.mFindValidMovesP99,
+                    levelBenchmark.mCalculateMovesP50,
+                    levelBenchmark.mCalculateMovesP99);
+        
+        totalMoves += levelBenchmark.mNumMoves;
+        totalMovements += levelBenchmark.mNumMovements;
+        levelBenchmarks.push_back(levelBenchmark);
+    }
+    
+    std::printf("\n%d levels, %d moves, %d movements, %d iterations\n",
+                static_cast<int>(levelBenchmarks.size()),
+                totalMoves,
+                totalMovements,
+                options.mNumIterations);
+    
+    if (!options.mOutputFilename.empty() &&
+        !BenchmarkBaseline::Write(options.mOutputFilename, levelBenchmarks, options.mNumIterations)) {
+        
+        std::fprintf(stderr, "Could not write %s\n", options.mOutputFilename.c_str());
+        return 1;
+    }
+    
+    if (!baseline.empty()) {
+        auto numRegressions =
+            BenchmarkBaseline::Compare(levelBenchmarks, baseline, options.mThresholdPercent);
+        
+        if (numRegressions > 0) {
+            std::printf("%d regressions compared to %s\n",
+                        numRegressions,
+                        options.mBaselineFilename.c_str());
+            return 1;
+        }
+        
+        std::printf("No regressions compared to %s\n", options.mBaselineFilename.c_str());
+    }
+    
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include "MovesBenchmark.hpp"
+
+#include <chrono>
+
+// Game includes.
+#include "Level.hpp"
+#include "LowestVisibleRow.hpp"
+#include "SpawnPosition.hpp"
+#include "LevelFiles.hpp"
+#include "LatencyStatistics.hpp"
+
+using namespace RowBlast;
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+}
+
+MovesBenchmark::MovesBenchmark() :
+    mValidMovesSearch {mField, ValidMovesSearch::UseCache::Yes},
+    mAi {mField} {}
+
+void MovesBenchmark::SetEvaluationMode(Ai::EvaluationMode evaluationMode) {
+    mAi.SetEvaluationMode(evaluationMode);
+}
+
+LevelBenchmark MovesBenchmark::Run(int levelId,
+                                   const Level& level,
+                                   const PieceTypes& pieceTypes,
+                                   int numIterations) {
+    mField.Init(level);
+    mField.SetLowestVisibleRow(LowestVisibleRow::CalculatePreferred(mField, level.GetObjective()));
+    mFallingPiece.ResetBetweenGames();
+    
+    LevelBenchmark result;
+    result.mLevelId = levelId;
+    result.mObjective = LevelFiles::ToString(level.GetObjective());
+    
+    LatencyStatistics findValidMovesLatencies;
+    LatencyStatistics calculateMovesLatencies;
+    
+    for (auto& pieceTypeEntry: pieceTypes) {
+        auto& pieceType = *pieceTypeEntry.second;
+        if (!SpawnFallingPiece(level, pieceType)) {
+            continue;
+        }
+        
+        ++result.mNumPieceTypes;
+        
+        MovingPiece piece {
+            mFallingPiece.GetIntPosition(),
+            mFallingPiece.GetRotation(),
+            mFallingPiece.GetPieceType()
+        };
+        
+        for (auto iteration = 0; iteration < numIterations; ++iteration) {
+            mValidMovesSearch.Init();
+            mValidMoves.Clear();
+            
+            auto startTime = Clock::now();
+            mValidMovesSearch.FindValidMoves(mValidMoves, piece, nullptr, nullptr);
+            Milliseconds findValidMovesLatency {Clock::now() - startTime};
+            findValidMovesLatencies.AddSample(findValidMovesLatency.count());
+            
+            if (iteration == 0) {
+                result.mNumMoves += mValidMoves.mMoves.Size();
+                result.mNumMovements += mValidMoves.mMovements.Size();
+            }
+            
+            mAi.Init(level);
+            
+            startTime = Clock::now();
+            mAi.CalculateMoves(mFallingPiece, 0);
+            Milliseconds calculateMovesLatency {Clock::now() - startTime};
+            calculateMovesLatencies.AddSample(calculateMovesLatency.count());
+        }
+    }
+    
+    result.mFindValidMovesP50 = findValidMovesLatencies.CalculatePercentile(50.0);
+    result.mFindValidMovesP99 = findValidMovesLatencies.CalculatePercentile(99.0);
+    result.mCalculateMovesP50 = calculateMovesLatencies.CalculatePercentile(50.0);
+    result.mCalculateMovesP99 = calculateMovesLatencies.CalculatePercentile(99.0);
+    
+    return result;
+}
+
+bool MovesBenchmark::SpawnFallingPiece(const Level& level, const Piece& pieceType) {
+    mFallingPiece.UpdateId();
+    mFallingPiece.Spawn(pieceType,
+                        SpawnPosition::Calculate(mField, level, pieceType),
+                        pieceType.GetSpawnRotation(),
+                        level.GetSpeed());
+    
+    auto rotation = mFallingPiece.GetRotation();
+    
+    PieceBlocks pieceBlocks {
+        pieceType.GetGrid(rotation),
+        pieceType.GetGridNumRows(),
+        pieceType.GetGridNumColumns(),
+        &pieceType.GetBitmask(rotation)
+    };
+    
+    auto ghostPieceRow = mField.DetectCollisionDown(pieceBlocks, mFallingPiece.GetIntPosition());
+    return ghostPieceRow <= mFallingPiece.GetPosition().y;
+}
@@ -0,0 +1,52 @@
+#ifndef MovesBenchmark_hpp
+#define MovesBenchmark_hpp
+
+#include <string>
+
+// Game includes.
+#include "Field.hpp"
+#include "FallingPiece.hpp"
+#include "ValidMovesSearch.hpp"
+#include "Ai.hpp"
+#include "PieceFactory.hpp"
+
+namespace RowBlast {
+    class Level;
+    
+    struct LevelBenchmark {
+        int mLevelId {0};
+        std::string mObjective;
+        int mNumPieceTypes {0};
+        int mNumMoves {0};
+        int mNumMovements {0};
+        double mFindValidMovesP50 {0.0};
+        double mFindValidMovesP99 {0.0};
+        double mCalculateMovesP50 {0.0};
+        double mCalculateMovesP99 {0.0};
+    };
+    
+    // Spawns every piece type at the spawn position in the initial field of a level and times
+    // ValidMovesSearch::FindValidMoves and Ai::CalculateMoves. The searches are cleared before each
+    // sample so that every sample is a cache miss, which is what the game sees for a new field.
+    class MovesBenchmark {
+    public:
+        MovesBenchmark();
+        
+        void SetEvaluationMode(Ai::EvaluationMode evaluationMode);
+        LevelBenchmark Run(int levelId,
+                           const Level& level,
+                           const PieceTypes& pieceTypes,
+                           int numIterations);
+        
+    private:
+        bool SpawnFallingPiece(const Level& level, const Piece& pieceType);
+        
+        Field mField;
+        ValidMovesSearch mValidMovesSearch;
+        Ai mAi;
+        FallingPiece mFallingPiece;
+        ValidMoves mValidMoves;
+    };
+}
+
+#endif
@@ -0,0 +1,51 @@
+#include "LatencyStatistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace RowBlast;
+
+void LatencyStatistics::Clear() {
+    mSamples.clear();
+    mTotal = 0.0;
+}
+
+void LatencyStatistics::AddSample(double milliseconds) {
+    mSamples.push_back(milliseconds);
+    mTotal += milliseconds;
+}
+
+void LatencyStatistics::Merge(const LatencyStatistics& other) {
+    mSamples.insert(mSamples.end(), other.mSamples.begin(), other.mSamples.end());
+    mTotal += other.mTotal;
+}
+
+double LatencyStatistics::CalculatePercentile(double percentile) const {
+    if (mSamples.empty()) {
+        return 0.0;
+    }
+    
+    // Nearest-rank percentile.
+    auto rank = static_cast<int>(std::ceil(percentile / 100.0 * mSamples.size()));
+    auto index = std::min(std::max(rank - 1, 0), static_cast<int>(mSamples.size()) - 1);
+    
+    auto samples = mSamples;
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+double LatencyStatistics::CalculateMean() const {
+    return mSamples.empty() ? 0.0 : mTotal / mSamples.size();
+}
+
+double LatencyStatistics::CalculateMax() const {
+    return mSamples.empty() ? 0.0 : *std::max_element(mSamples.begin(), mSamples.end());
+}
+
+int LatencyStatistics::CountSamplesAbove(double milliseconds) const {
+    return static_cast<int>(std::count_if(mSamples.begin(),
+                                          mSamples.end(),
+                                          [milliseconds] (double sample) {
+                                              return sample > milliseconds;
+                                          }));
+}
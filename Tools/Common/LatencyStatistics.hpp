@@ -0,0 +1,31 @@
+#ifndef LatencyStatistics_hpp
+#define LatencyStatistics_hpp
+
+#include <vector>
+
+namespace RowBlast {
+    class LatencyStatistics {
+    public:
+        void Clear();
+        void AddSample(double milliseconds);
+        void Merge(const LatencyStatistics& other);
+        double CalculatePercentile(double percentile) const;
+        double CalculateMean() const;
+        double CalculateMax() const;
+        int CountSamplesAbove(double milliseconds) const;
+        
+        int GetNumSamples() const {
+            return static_cast<int>(mSamples.size());
+        }
+        
+        double GetTotal() const {
+            return mTotal;
+        }
+        
+    private:
+        std::vector<double> mSamples;
+        double mTotal {0.0};
+    };
+}
+
+#endif
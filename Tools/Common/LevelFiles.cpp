@@ -0,0 +1,96 @@
+#include "LevelFiles.hpp"
+
+#include <algorithm>
+#include <dirent.h>
+
+// Engine includes.
+#include "FileSystemLinux.hpp"
+
+// Game includes.
+#include "LevelLoader.hpp"
+
+using namespace RowBlast;
+
+namespace {
+    bool StartsWith(const std::string& str, const std::string& prefix) {
+        return str.compare(0, prefix.size(), prefix) == 0;
+    }
+    
+    std::vector<std::string> ListDirectory(const std::string& directory) {
+        std::vector<std::string> entries;
+        
+        auto* dir = opendir(directory.c_str());
+        if (dir == nullptr) {
+            return entries;
+        }
+        
+        while (auto* entry = readdir(dir)) {
+            entries.push_back(entry->d_name);
+        }
+        
+        closedir(dir);
+        return entries;
+    }
+    
+    Pht::Optional<int> ParseLevelId(const std::string& filename) {
+        const std::string prefix {"level"};
+        const std::string suffix {".json"};
+        
+        if (!StartsWith(filename, prefix) || filename.size() <= prefix.size() + suffix.size() ||
+            filename.compare(filename.size() - suffix.size(), suffix.size(), suffix) != 0) {
+
+            return {};
+        }
+        
+        auto idString = filename.substr(prefix.size(),
+                                        filename.size() - prefix.size() - suffix.size());
+        if (!std::all_of(idString.begin(), idString.end(), ::isdigit)) {
+            return {};
+        }
+        
+        return std::stoi(idString);
+    }
+}
+
+std::vector<LevelFile> LevelFiles::Find(const std::string& levelsDirectory) {
+    std::vector<LevelFile> levelFiles;
+    
+    for (auto& worldName: ListDirectory(levelsDirectory)) {
+        if (!StartsWith(worldName, "World")) {
+            continue;
+        }
+        
+        auto worldDirectory = levelsDirectory + "/" + worldName;
+        
+        for (auto& filename: ListDirectory(worldDirectory)) {
+            auto levelId = ParseLevelId(filename);
+            if (levelId.HasValue()) {
+                levelFiles.push_back(LevelFile {levelId.GetValue(), worldDirectory});
+            }
+        }
+    }
+    
+    std::sort(levelFiles.begin(), levelFiles.end(), [] (const LevelFile& a, const LevelFile& b) {
+        return a.mId < b.mId;
+    });
+    
+    return levelFiles;
+}
+
+std::unique_ptr<Level> LevelFiles::Load(const LevelFile& levelFile, const PieceTypes& pieceTypes) {
+    Pht::FileSystem::SetResourceDirectory(levelFile.mDirectory);
+    return LevelLoader::Load(levelFile.mId, pieceTypes);
+}
+
+std::string LevelFiles::ToString(Level::Objective objective) {
+    switch (objective) {
+        case Level::Objective::Clear:
+            return "Clear";
+        case Level::Objective::Build:
+            return "Build";
+        case Level::Objective::BringDownTheAsteroid:
+            return "BringDownTheAsteroid";
+    }
+    
+    return "";
+}
@@ -0,0 +1,27 @@
+#ifndef LevelFiles_hpp
+#define LevelFiles_hpp
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// Game includes.
+#include "Level.hpp"
+#include "PieceFactory.hpp"
+
+namespace RowBlast {
+    struct LevelFile {
+        int mId {0};
+        std::string mDirectory;
+    };
+    
+    namespace LevelFiles {
+        // Finds the level<id>.json files in the World* subdirectories of levelsDirectory, sorted by
+        // level id.
+        std::vector<LevelFile> Find(const std::string& levelsDirectory);
+        std::unique_ptr<Level> Load(const LevelFile& levelFile, const PieceTypes& pieceTypes);
+        std::string ToString(Level::Objective objective);
+    }
+}
+
+#endif
@@ -0,0 +1,30 @@
+#include "SpawnPosition.hpp"
+
+// Game includes.
+#include "Field.hpp"
+#include "Level.hpp"
+#include "Piece.hpp"
+
+using namespace RowBlast;
+
+namespace {
+    constexpr auto halfColumn = 0.5f;
+}
+
+Pht::Vec2 SpawnPosition::Calculate(const Field& field, const Level& level, const Piece& pieceType) {
+    auto rotation = pieceType.GetSpawnRotation();
+    auto startXPos = field.GetNumColumns() / 2 - pieceType.GetGridNumColumns() / 2;
+    auto topRowInScreen = field.GetLowestVisibleRow() + field.GetNumRowsInOneScreen() - 1;
+    
+    auto& pieceDimensions = pieceType.GetDimensions(rotation);
+    auto pieceNumEmptyTopRows = pieceType.GetGridNumRows() - pieceDimensions.mYmax - 1;
+    auto desiredUpperPos =
+        topRowInScreen - 3 + pieceNumEmptyTopRows + pieceType.GetSpawnYPositionAdjustment();
+    
+    if (level.GetSpeed() > 0.0f) {
+        ++desiredUpperPos;
+    }
+    
+    auto startYPos = desiredUpperPos - pieceType.GetGridNumRows() + 1;
+    return {startXPos + halfColumn, static_cast<float>(startYPos)};
+}
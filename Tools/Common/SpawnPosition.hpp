@@ -0,0 +1,19 @@
+#ifndef SpawnPosition_hpp
+#define SpawnPosition_hpp
+
+// Engine includes.
+#include "Vector.hpp"
+
+namespace RowBlast {
+    class Field;
+    class Level;
+    class Piece;
+    
+    namespace SpawnPosition {
+        // Same position as GameLogic::CalculateFallingPieceSpawnPos when there is no ongoing
+        // scrolling or dragging.
+        Pht::Vec2 Calculate(const Field& field, const Level& level, const Piece& pieceType);
+    }
+}
+
+#endif
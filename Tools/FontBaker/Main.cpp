@@ -0,0 +1,383 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Engine includes.
+#include "FontBaker.hpp"
+#include "IImage.hpp"
+
+// Game includes.
+#include "LatencyStatistics.hpp"
+
+using namespace RowBlast;
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+    
+    struct Options {
+        std::string mFontPath;
+        std::string mOutputDirectory;
+        std::vector<int> mSizes;
+        int mNumIterations {10};
+        bool mBenchmark {false};
+        bool mDistanceField {false};
+    };
+    
+    struct GlyphImage {
+        const unsigned char* mTopLeft {nullptr};
+        int mStride {0};
+        Pht::IVec2 mSize;
+    };
+    
+    void PrintUsage(const char* programName) {
+        std::printf("Usage: %s [--output <directory>] [--benchmark] [--iterations <n>] "
+                    "[--distance-field] <font file> <pixel size>...\n",
+                    programName);
+    }
+    
+    bool ParseOptions(int argc, char* argv[], Options& options) {
+        for (auto i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+                options.mOutputDirectory = argv[++i];
+            } else if (std::strcmp(argv[i], "--benchmark") == 0) {
+                options.mBenchmark = true;
+            } else if (std::strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+                options.mNumIterations = std::atoi(argv[++i]);
+            } else if (std::strcmp(argv[i], "--distance-field") == 0) {
+                options.mDistanceField = true;
+            } else if (argv[i][0] == '-') {
+                return false;
+            } else if (options.mFontPath.empty()) {
+                options.mFontPath = argv[i];
+            } else {
+                auto size = std::atoi(argv[i]);
+                if (size <= 0) {
+                    return false;
+                }
+                
+                options.mSizes.push_back(size);
+            }
+        }
+        
+        if (options.mOutputDirectory.empty()) {
+            auto separatorIndex = options.mFontPath.find_last_of('/');
+            options.mOutputDirectory = separatorIndex == std::string::npos ?
+                                       "." : options.mFontPath.substr(0, separatorIndex);
+        }
+        
+        return !options.mFontPath.empty() && (!options.mSizes.empty() || options.mDistanceField) &&
+               options.mNumIterations > 0;
+    }
+    
+    std::string ToFontFilename(const Options& options) {
+        return options.mFontPath.substr(options.mFontPath.find_last_of('/') + 1);
+    }
+    
+    std::string ToBakedPath(const Options& options, int size) {
+        return options.mOutputDirectory + "/" +
+               Pht::FontBaker::ToBakedFilename(ToFontFilename(options), size);
+    }
+    
+    std::string ToBakedDistanceFieldPath(const Options& options) {
+        return options.mOutputDirectory + "/" +
+               Pht::FontBaker::ToBakedDistanceFieldFilename(ToFontFilename(options));
+    }
+    
+    int CalcAtlasNumBytes(const Pht::BakedFont& bakedFont) {
+        auto atlasSize = bakedFont.mAtlasImage->GetSize();
+        return atlasSize.x * atlasSize.y;
+    }
+    
+    GlyphImage GetGlyphImage(const Pht::BakedFont& bakedFont,
+                             const Pht::Font::Glyph& glyph,
+                             int downscale) {
+        auto atlasSize = bakedFont.mAtlasImage->GetSize();
+        auto* uv = bakedFont.mTextureAtlas->GetSubTextureUV(glyph.mSubTextureIndex.GetValue());
+        Pht::IVec2 size {glyph.mSize.x / downscale, glyph.mSize.y / downscale};
+        auto x = static_cast<int>(std::lround(uv->mBottomLeft.x * atlasSize.x));
+        auto y = static_cast<int>(std::lround(uv->mBottomLeft.y * atlasSize.y)) - size.y;
+        auto* atlasData = static_cast<const unsigned char*>(bakedFont.mAtlasImage->GetImageData());
+        return {atlasData + y * atlasSize.x + x, atlasSize.x, size};
+    }
+    
+    float SampleBilinear(const GlyphImage& image, float x, float y) {
+        auto clampedX = std::fmin(std::fmax(x, 0.0f), image.mSize.x - 1.0f);
+        auto clampedY = std::fmin(std::fmax(y, 0.0f), image.mSize.y - 1.0f);
+        auto x0 = static_cast<int>(clampedX);
+        auto y0 = static_cast<int>(clampedY);
+        auto x1 = std::min(x0 + 1, image.mSize.x - 1);
+        auto y1 = std::min(y0 + 1, image.mSize.y - 1);
+        auto fractionX = clampedX - x0;
+        auto fractionY = clampedY - y0;
+        
+        auto texel = [&image] (int texelX, int texelY) {
+            return image.mTopLeft[texelY * image.mStride + texelX] / 255.0f;
+        };
+        
+        auto top = texel(x0, y0) + (texel(x1, y0) - texel(x0, y0)) * fractionX;
+        auto bottom = texel(x0, y1) + (texel(x1, y1) - texel(x0, y1)) * fractionX;
+        return top + (bottom - top) * fractionY;
+    }
+    
+    // Compares the outlines given by the distance field font with the coverage of the glyphs
+    // rasterized at the same pixel size, the way the GPU samples the distance field. Returns the
+    // fraction of the glyph pixels that end up on the wrong side of the outline.
+    float CalcOutlineMismatch(const Pht::BakedFont& distanceFieldFont,
+                              const Pht::BakedFont& bitmapFont) {
+        auto downscale = Pht::FontBaker::GetDistanceFieldConfig().mDownscale;
+        auto numPixels = 0;
+        auto numMismatches = 0;
+        
+        for (auto i = 0; i < bitmapFont.mGlyphs.size(); ++i) {
+            auto& bitmapGlyph = bitmapFont.mGlyphs[i];
+            auto& distanceFieldGlyph = distanceFieldFont.mGlyphs[i];
+            if (!bitmapGlyph.mSubTextureIndex.HasValue() ||
+                !distanceFieldGlyph.mSubTextureIndex.HasValue()) {
+                
+                continue;
+            }
+            
+            auto coverage = GetGlyphImage(bitmapFont, bitmapGlyph, 1);
+            auto distanceField = GetGlyphImage(distanceFieldFont, distanceFieldGlyph, downscale);
+            
+            for (auto y = 0; y < coverage.mSize.y; ++y) {
+                for (auto x = 0; x < coverage.mSize.x; ++x) {
+                    auto isInside = coverage.mTopLeft[y * coverage.mStride + x] >= 128;
+                    
+                    // The centers of the pixels in the distance field texels.
+                    auto fieldX = (bitmapGlyph.mBearing.x - distanceFieldGlyph.mBearing.x +
+                                   x + 0.5f) / downscale - 0.5f;
+                    auto fieldY = (distanceFieldGlyph.mBearing.y - bitmapGlyph.mBearing.y +
+                                   y + 0.5f) / downscale - 0.5f;
+                    auto isInsideField = SampleBilinear(distanceField, fieldX, fieldY) >= 0.5f;
+                    
+                    if (isInside != isInsideField) {
+                        ++numMismatches;
+                    }
+                    ++numPixels;
+                }
+            }
+        }
+        
+        return numPixels > 0 ? static_cast<float>(numMismatches) / numPixels : 1.0f;
+    }
+    
+    bool IsSame(const Pht::BakedFont& a, const Pht::BakedFont& b) {
+        if (a.mPixelSize != b.mPixelSize || a.mDistanceFieldSpread != b.mDistanceFieldSpread ||
+            a.mGlyphs.size() != b.mGlyphs.size()) {
+            
+            return false;
+        }
+        
+        for (auto i = 0; i < a.mGlyphs.size(); ++i) {
+            auto& glyphA = a.mGlyphs[i];
+            auto& glyphB = b.mGlyphs[i];
+            if (glyphA.mSubTextureIndex.HasValue() != glyphB.mSubTextureIndex.HasValue() ||
+                (glyphA.mSubTextureIndex.HasValue() &&
+                 glyphA.mSubTextureIndex.GetValue() != glyphB.mSubTextureIndex.GetValue()) ||
+                glyphA.mSize != glyphB.mSize || glyphA.mBearing != glyphB.mBearing ||
+                glyphA.mAdvance != glyphB.mAdvance) {
+                
+                return false;
+            }
+        }
+        
+        auto numSubTextures = a.mTextureAtlas->GetNumSubTextures();
+        if (numSubTextures != b.mTextureAtlas->GetNumSubTextures()) {
+            return false;
+        }
+        
+        for (auto i = 0; i < numSubTextures; ++i) {
+            if (std::memcmp(a.mTextureAtlas->GetSubTextureUV(i),
+                            b.mTextureAtlas->GetSubTextureUV(i),
+                            sizeof(Pht::SubTextureUV)) != 0) {
+                
+                return false;
+            }
+        }
+        
+        auto atlasSize = a.mAtlasImage->GetSize();
+        return atlasSize == b.mAtlasImage->GetSize() &&
+               std::memcmp(a.mAtlasImage->GetImageData(),
+                           b.mAtlasImage->GetImageData(),
+                           atlasSize.x * atlasSize.y) == 0;
+    }
+    
+    int Bake(const Options& options) {
+        if (options.mDistanceField) {
+            Pht::BakedFont bakedFont;
+            if (!Pht::FontBaker::RasterizeDistanceField(options.mFontPath, bakedFont)) {
+                std::fprintf(stderr, "Could not rasterize %s\n", options.mFontPath.c_str());
+                return 1;
+            }
+            
+            auto bakedPath = ToBakedDistanceFieldPath(options);
+            if (!Pht::FontBaker::Write(bakedPath, bakedFont)) {
+                std::fprintf(stderr, "Could not write %s\n", bakedPath.c_str());
+                return 1;
+            }
+            
+            auto atlasSize = bakedFont.mAtlasImage->GetSize();
+            std::printf("%-40s %4d glyphs %5dx%-5d distance field atlas\n",
+                        bakedPath.c_str(),
+                        static_cast<int>(bakedFont.mGlyphs.size()),
+                        atlasSize.x,
+                        atlasSize.y);
+        }
+        
+        for (auto size: options.mSizes) {
+            Pht::BakedFont bakedFont;
+            if (!Pht::FontBaker::Rasterize(options.mFontPath, size, bakedFont)) {
+                std::fprintf(stderr, "Could not rasterize %s\n", options.mFontPath.c_str());
+                return 1;
+            }
+            
+            auto bakedPath = ToBakedPath(options, size);
+            if (!Pht::FontBaker::Write(bakedPath, bakedFont)) {
+                std::fprintf(stderr, "Could not write %s\n", bakedPath.c_str());
+                return 1;
+            }
+            
+            auto atlasSize = bakedFont.mAtlasImage->GetSize();
+            std::printf("%-40s %4d glyphs %5dx%-5d atlas\n",
+                        bakedPath.c_str(),
+                        static_cast<int>(bakedFont.mGlyphs.size()),
+                        atlasSize.x,
+                        atlasSize.y);
+        }
+        
+        return 0;
+    }
+    
+    // Times loading the distance field font against loading the bitmap fonts of all the sizes,
+    // checks the outlines of the distance field and compares the atlas memory.
+    bool BenchmarkDistanceField(const Options& options) {
+        LatencyStatistics rasterizeLatencies;
+        LatencyStatistics readLatencies;
+        Pht::BakedFont rasterizedFont;
+        Pht::BakedFont readFont;
+        auto isRead = true;
+        
+        for (auto i = 0; i < options.mNumIterations; ++i) {
+            auto startTime = Clock::now();
+            Pht::FontBaker::RasterizeDistanceField(options.mFontPath, rasterizedFont);
+            rasterizeLatencies.AddSample(Milliseconds {Clock::now() - startTime}.count());
+            
+            startTime = Clock::now();
+            isRead = Pht::FontBaker::Read(ToBakedDistanceFieldPath(options), readFont);
+            readLatencies.AddSample(Milliseconds {Clock::now() - startTime}.count());
+        }
+        
+        auto isSame = isRead && IsSame(rasterizedFont, readFont);
+        std::printf("\n%-6s %14.4f %12.4f %8.1fx%s\n",
+                    "sdf",
+                    rasterizeLatencies.CalculatePercentile(50.0),
+                    readLatencies.CalculatePercentile(50.0),
+                    rasterizeLatencies.CalculatePercentile(50.0) /
+                    readLatencies.CalculatePercentile(50.0),
+                    isSame ? "" : "  (different result or not baked)");
+        
+        Pht::BakedFont bitmapFont;
+        auto pixelSize = Pht::FontBaker::GetDistanceFieldConfig().mPixelSize;
+        if (!Pht::FontBaker::Rasterize(options.mFontPath, pixelSize, bitmapFont)) {
+            return false;
+        }
+        
+        std::printf("outline mismatch at %d pixels: %.3f%%\n",
+                    pixelSize,
+                    CalcOutlineMismatch(rasterizedFont, bitmapFont) * 100.0f);
+        
+        auto bitmapAtlasNumBytes = 0;
+        for (auto size: options.mSizes) {
+            if (Pht::FontBaker::Rasterize(options.mFontPath, size, bitmapFont)) {
+                bitmapAtlasNumBytes += CalcAtlasNumBytes(bitmapFont);
+            }
+        }
+        
+        auto atlasSize = rasterizedFont.mAtlasImage->GetSize();
+        std::printf("atlas memory: %d KB distance field (%dx%d) vs %d KB for %d bitmap sizes\n",
+                    CalcAtlasNumBytes(rasterizedFont) / 1024,
+                    atlasSize.x,
+                    atlasSize.y,
+                    bitmapAtlasNumBytes / 1024,
+                    static_cast<int>(options.mSizes.size()));
+        return isSame;
+    }
+    
+    int Benchmark(const Options& options) {
+        auto totalRasterizeMilliseconds = 0.0;
+        auto totalReadMilliseconds = 0.0;
+        auto numDifferentResults = 0;
+        
+        std::printf("%-6s %14s %12s %9s\n", "size", "rasterize p50", "read p50", "speedup");
+        
+        for (auto size: options.mSizes) {
+            LatencyStatistics rasterizeLatencies;
+            LatencyStatistics readLatencies;
+            Pht::BakedFont rasterizedFont;
+            Pht::BakedFont readFont;
+            auto isRead = true;
+            
+            for (auto i = 0; i < options.mNumIterations; ++i) {
+                auto startTime = Clock::now();
+                Pht::FontBaker::Rasterize(options.mFontPath, size, rasterizedFont);
+                rasterizeLatencies.AddSample(Milliseconds {Clock::now() - startTime}.count());
+                
+                startTime = Clock::now();
+                isRead = Pht::FontBaker::Read(ToBakedPath(options, size), readFont);
+                readLatencies.AddSample(Milliseconds {Clock::now() - startTime}.count());
+            }
+            
+            auto isSame = isRead && IsSame(rasterizedFont, readFont);
+            if (!isSame) {
+                ++numDifferentResults;
+            }
+            
+            auto rasterizeMilliseconds = rasterizeLatencies.CalculatePercentile(50.0);
+            auto readMilliseconds = readLatencies.CalculatePercentile(50.0);
+            totalRasterizeMilliseconds += rasterizeMilliseconds;
+            totalReadMilliseconds += readMilliseconds;
+            
+            std::printf("%-6d %14.4f %12.4f %8.1fx%s\n",
+                        size,
+                        rasterizeMilliseconds,
+                        readMilliseconds,
+                        rasterizeMilliseconds / readMilliseconds,
+                        isSame ? "" : "  (different result or not baked)");
+        }
+        
+        std::printf("%-6s %14.4f %12.4f %8.1fx\n",
+                    "total",
+                    totalRasterizeMilliseconds,
+                    totalReadMilliseconds,
+                    totalRasterizeMilliseconds / totalReadMilliseconds);
+        std::printf("\n%d sizes, %d iterations, times in ms\n",
+                    static_cast<int>(options.mSizes.size()),
+                    options.mNumIterations);
+        
+        if (options.mDistanceField && !BenchmarkDistanceField(options)) {
+            ++numDifferentResults;
+        }
+        
+        return numDifferentResults == 0 ? 0 : 1;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+    
+    if (options.mBenchmark) {
+        return Benchmark(options);
+    }
+    
+    return Bake(options);
+}
@@ -0,0 +1,97 @@
+#include "AppBundle.hpp"
+
+#include <cerrno>
+#include <cstdlib>
+#include <vector>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace RowBlast;
+
+namespace {
+    std::vector<std::string> ListDirectory(const std::string& directory) {
+        std::vector<std::string> entries;
+        
+        auto* dir = opendir(directory.c_str());
+        if (dir == nullptr) {
+            return entries;
+        }
+        
+        while (auto* entry = readdir(dir)) {
+            std::string name {entry->d_name};
+            if (name != "." && name != "..") {
+                entries.push_back(name);
+            }
+        }
+        
+        closedir(dir);
+        return entries;
+    }
+    
+    std::string CreateTemporaryDirectory() {
+        char directoryTemplate[] {"/tmp/RowBlastXXXXXX"};
+        auto* directory = mkdtemp(directoryTemplate);
+        return directory ? directory : "";
+    }
+    
+    void RemoveDirectory(const std::string& directory) {
+        if (directory.empty()) {
+            return;
+        }
+        
+        for (auto& name: ListDirectory(directory)) {
+            unlink((directory + "/" + name).c_str());
+        }
+        
+        rmdir(directory.c_str());
+    }
+}
+
+AppBundle::AppBundle(const std::string& assetsDirectory) {
+    char* absoluteAssetsDirectory = realpath(assetsDirectory.c_str(), nullptr);
+    if (absoluteAssetsDirectory == nullptr) {
+        return;
+    }
+    
+    mResourceDirectory = CreateTemporaryDirectory();
+    mUserDataDirectory = CreateTemporaryDirectory();
+    
+    if (IsValid() && !LinkFiles(absoluteAssetsDirectory)) {
+        RemoveDirectory(mResourceDirectory);
+        mResourceDirectory.clear();
+    }
+    
+    std::free(absoluteAssetsDirectory);
+}
+
+AppBundle::~AppBundle() {
+    RemoveDirectory(mResourceDirectory);
+    RemoveDirectory(mUserDataDirectory);
+}
+
+bool AppBundle::LinkFiles(const std::string& directory) {
+    for (auto& name: ListDirectory(directory)) {
+        auto path = directory + "/" + name;
+        
+        struct stat status;
+        if (stat(path.c_str(), &status) != 0) {
+            continue;
+        }
+        
+        if (S_ISDIR(status.st_mode)) {
+            if (!LinkFiles(path)) {
+                return false;
+            }
+        } else if (S_ISREG(status.st_mode)) {
+            // The bundle is flat, so a file with the same name as an already linked file is
+            // left out.
+            auto linkPath = mResourceDirectory + "/" + name;
+            if (symlink(path.c_str(), linkPath.c_str()) != 0 && errno != EEXIST) {
+                return false;
+            }
+        }
+    }
+    
+    return true;
+}
@@ -0,0 +1,36 @@
+#ifndef AppBundle_hpp
+#define AppBundle_hpp
+
+#include <string>
+
+namespace RowBlast {
+    // Links the files in the subdirectories of the assets directory into one temporary directory,
+    // the way they are copied into the resources of the app bundle, and creates an empty temporary
+    // directory for the user data, so that the game starts as at its first launch. Both directories
+    // are removed when the bundle is destroyed.
+    class AppBundle {
+    public:
+        explicit AppBundle(const std::string& assetsDirectory);
+        ~AppBundle();
+        
+        bool IsValid() const {
+            return !mResourceDirectory.empty() && !mUserDataDirectory.empty();
+        }
+        
+        const std::string& GetResourceDirectory() const {
+            return mResourceDirectory;
+        }
+        
+        const std::string& GetUserDataDirectory() const {
+            return mUserDataDirectory;
+        }
+    
+    private:
+        bool LinkFiles(const std::string& directory);
+        
+        std::string mResourceDirectory;
+        std::string mUserDataDirectory;
+    };
+}
+
+#endif
@@ -0,0 +1,139 @@
+#include "FrameProfiler.hpp"
+
+#include <chrono>
+
+// Engine includes.
+#include "SceneObject.hpp"
+#include "InputEvent.hpp"
+#include "Button.hpp"
+#include "IRenderer.hpp"
+
+using namespace RowBlast;
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+    
+    constexpr auto frameDuration = 1.0f / 60.0f;
+    constexpr auto maxNumWarmUpFrames = 60 * 60;
+    constexpr auto numLandingFrames = 5 * 60;
+    const Pht::Vec2 nativeScreenInputSize {375.0f, 812.0f};
+    
+    void AddStats(Pht::NullRenderer::FrameStats& total,
+                  const Pht::NullRenderer::FrameStats& stats) {
+        total.mNumRenderPasses += stats.mNumRenderPasses;
+        total.mNumDrawCalls += stats.mNumDrawCalls;
+        total.mNumBatchDrawCalls += stats.mNumBatchDrawCalls;
+        total.mNumTexts += stats.mNumTexts;
+        total.mNumTextDraws += stats.mNumTextDraws;
+        total.mNumShaderUses += stats.mNumShaderUses;
+        total.mNumMaterialUses += stats.mNumMaterialUses;
+        total.mNumTextureBinds += stats.mNumTextureBinds;
+        total.mNumVboUses += stats.mNumVboUses;
+        total.mNumDepthWriteChanges += stats.mNumDepthWriteChanges;
+        total.mNumTriangles += stats.mNumTriangles;
+        total.mNumPoints += stats.mNumPoints;
+        total.mNumUploads += stats.mNumUploads;
+        total.mNumUploadedBytes += stats.mNumUploadedBytes;
+    }
+}
+
+FrameProfiler::FrameProfiler() :
+    mEngine {false, nativeScreenInputSize} {
+    
+    mEngine.Init(false);
+}
+
+FrameProfile FrameProfiler::Run(const ProfiledScene& scene, int numWarmUpFrames, int numFrames) {
+    FrameProfile profile;
+    profile.mNumFrames = numFrames;
+    
+    GetProfiledApplication().Start(scene);
+    mTouchLocation.Reset();
+    
+    // The scene transition and the first frames of the scene are not profiled, and neither is the
+    // level intro of the game scene, which lasts until the first move has been clicked. If no more
+    // moves are clicked, the landing of the first piece and its effects are not profiled either.
+    auto isGame = scene.mKind == ProfiledScene::Kind::Game;
+    for (auto frame = 0; frame < maxNumWarmUpFrames; ++frame) {
+        if (frame >= numWarmUpFrames && (!isGame || profile.mNumMoveClicks > 0)) {
+            break;
+        }
+        
+        ClickMove(profile);
+        mEngine.Update(frameDuration);
+    }
+    
+    if (isGame && !scene.mClickMoves) {
+        for (auto frame = 0; frame < numLandingFrames; ++frame) {
+            mEngine.Update(frameDuration);
+        }
+    }
+    
+    profile.mNumMoveClicks = 0;
+    Pht::Profiler::Clear();
+    Pht::Profiler::SetIsEnabled(true);
+    
+    auto lastRenderListVersion = Pht::SceneObject::GetRenderListVersion();
+    
+    for (auto frame = 0; frame < numFrames; ++frame) {
+        Pht::NullRenderer::ResetFrameStats();
+        if (scene.mClickMoves) {
+            ClickMove(profile);
+        }
+        
+        auto startTime = Clock::now();
+        mEngine.Update(frameDuration);
+        profile.mFrameLatencies.AddSample(Milliseconds {Clock::now() - startTime}.count());
+        
+        auto renderListVersion = Pht::SceneObject::GetRenderListVersion();
+        if (renderListVersion != lastRenderListVersion) {
+            ++profile.mNumViewRebuilds;
+        }
+        lastRenderListVersion = renderListVersion;
+        
+        AddStats(profile.mTotalStats, Pht::NullRenderer::GetFrameStats());
+    }
+    
+    Pht::Profiler::SetIsEnabled(false);
+    profile.mZoneStatistics = Pht::Profiler::CalculateZoneStatistics();
+    
+    return profile;
+}
+
+void FrameProfiler::ClickMove(FrameProfile& profile) {
+    if (mTouchLocation.HasValue()) {
+        PushTouch(Pht::TouchState::End, mTouchLocation.GetValue());
+        mTouchLocation.Reset();
+        ++profile.mNumMoveClicks;
+        return;
+    }
+    
+    if (auto* button = GetProfiledApplication().GetMoveButtonToClick()) {
+        // The move buttons are hit tested in the orthographic projection of the field, which is
+        // the renderer state when ClickInputHandler passes the touches to them.
+        auto& renderer = mEngine.GetRenderer();
+        renderer.SetHudMode(false);
+        renderer.SetProjectionMode(Pht::ProjectionMode::Orthographic);
+        mTouchLocation = button->CalculateScreenPosition();
+        PushTouch(Pht::TouchState::Begin, mTouchLocation.GetValue());
+    }
+}
+
+void FrameProfiler::PushTouch(Pht::TouchState state, const Pht::Vec2& location) {
+    // The input handler expects native screen coordinates, like the touches of the iOS view.
+    auto& screenInputSize = mEngine.GetInput().GetScreenInputSize();
+    
+    Pht::TouchEvent touchEvent {
+        state,
+        Pht::Vec2 {
+            location.x * nativeScreenInputSize.x / screenInputSize.x,
+            location.y * nativeScreenInputSize.y / screenInputSize.y
+        },
+        {},
+        {}
+    };
+    
+    Pht::InputEvent inputEvent {touchEvent};
+    mEngine.GetInputHandler().PushToQueue(inputEvent);
+}
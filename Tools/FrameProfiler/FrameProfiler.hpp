@@ -0,0 +1,49 @@
+#ifndef FrameProfiler_hpp
+#define FrameProfiler_hpp
+
+#include <vector>
+
+// Engine includes.
+#include "Engine.hpp"
+#include "NullRenderer.hpp"
+#include "Profiler.hpp"
+#include "Optional.hpp"
+
+// Game includes.
+#include "LatencyStatistics.hpp"
+#include "ProfiledApplication.hpp"
+
+namespace RowBlast {
+    struct FrameProfile {
+        int mNumFrames {0};
+        
+        // The number of frames in which the render lists had changed since the previous frame,
+        // which makes the render queue collect the scene objects of its views again.
+        int mNumViewRebuilds {0};
+        int mNumMoveClicks {0};
+        LatencyStatistics mFrameLatencies;
+        std::vector<Pht::Profiler::ZoneStatistics> mZoneStatistics;
+        Pht::NullRenderer::FrameStats mTotalStats;
+    };
+    
+    // Runs Engine::Update with the null renderer and a fixed timestep over the scenes of the
+    // profiled application. The engine profiler is enabled during the profiled frames, so its zones
+    // break the frames down into the subsystems. In the game scene the moves are clicked through
+    // the input handler as soon as the game presents them, so that the pieces land and the rows
+    // are cleared like when the game is played.
+    class FrameProfiler {
+    public:
+        FrameProfiler();
+        
+        FrameProfile Run(const ProfiledScene& scene, int numWarmUpFrames, int numFrames);
+    
+    private:
+        void ClickMove(FrameProfile& profile);
+        void PushTouch(Pht::TouchState state, const Pht::Vec2& location);
+        
+        Pht::Engine mEngine;
+        Pht::Optional<Pht::Vec2> mTouchLocation;
+    };
+}
+
+#endif
@@ -0,0 +1,210 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Engine includes.
+#include "Profiler.hpp"
+#include "FileSystemLinux.hpp"
+
+// Game includes.
+#include "AppBundle.hpp"
+#include "FrameProfiler.hpp"
+
+using namespace RowBlast;
+
+namespace {
+    constexpr auto numWarmUpFrames = 60;
+    constexpr auto gameLevelId = 12;
+    
+    struct NamedScene {
+        const char* mName;
+        ProfiledScene mScene;
+        
+        // Steady scenes only move objects and keep their effects running, which must not make the
+        // render queue collect the scene objects of its views again.
+        bool mIsSteady;
+    };
+    
+    const std::vector<NamedScene> scenes {
+        {"game", {.mKind = ProfiledScene::Kind::Game, .mLevelId = gameLevelId}, false},
+        {
+            "game-idle",
+            {.mKind = ProfiledScene::Kind::Game, .mLevelId = gameLevelId, .mClickMoves = false},
+            true
+        },
+        {"map", {.mKind = ProfiledScene::Kind::Map}, false},
+        {
+            "mixed",
+            {
+                .mScriptedSceneSettings = {
+                    .mNumBlocks = 120,
+                    .mNumClouds = 24,
+                    .mNumParticleEffects = 8,
+                    .mNumHudButtons = 4,
+                    .mNumHudTexts = 8
+                }
+            },
+            false
+        },
+        {"blocks", {.mScriptedSceneSettings = {.mNumBlocks = 180}}, true},
+        {"clouds", {.mScriptedSceneSettings = {.mNumClouds = 64}}, true},
+        {"particles", {.mScriptedSceneSettings = {.mNumParticleEffects = 32}}, false},
+        {"emitters", {.mScriptedSceneSettings = {.mNumEmittingEffects = 32}}, true},
+        {"hud", {.mScriptedSceneSettings = {.mNumHudButtons = 24, .mNumHudTexts = 24}}, true}
+    };
+    
+    struct Options {
+        std::string mSceneName;
+        std::string mTraceFilename;
+        std::string mAssetsDirectory {"Assets"};
+        int mNumFrames {600};
+    };
+    
+    void PrintUsage(const char* programName) {
+        std::printf("Usage: %s [--frames <n>] "
+                    "[--scene game|game-idle|map|mixed|blocks|clouds|particles|emitters|hud] "
+                    "[--trace <file>] [--assets <directory>]\n",
+                    programName);
+    }
+    
+    bool ParseOptions(int argc, char* argv[], Options& options) {
+        for (auto i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+                options.mNumFrames = std::atoi(argv[++i]);
+            } else if (std::strcmp(argv[i], "--scene") == 0 && i + 1 < argc) {
+                options.mSceneName = argv[++i];
+            } else if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+                options.mTraceFilename = argv[++i];
+            } else if (std::strcmp(argv[i], "--assets") == 0 && i + 1 < argc) {
+                options.mAssetsDirectory = argv[++i];
+            } else {
+                return false;
+            }
+        }
+        
+        return options.mNumFrames > 0;
+    }
+    
+    // The trace of each scene is written next to the given file, with the name of the scene in
+    // front of the filename.
+    std::string ToSceneTraceFilename(const std::string& traceFilename, const char* sceneName) {
+        auto filenameStart = traceFilename.find_last_of('/');
+        filenameStart = filenameStart == std::string::npos ? 0 : filenameStart + 1;
+        
+        return traceFilename.substr(0, filenameStart) + sceneName + "-" +
+               traceFilename.substr(filenameStart);
+    }
+    
+    void PrintProfile(const char* sceneName, const FrameProfile& profile) {
+        std::printf("%-56s %8s %12s %12s %12s\n", sceneName, "samples", "p50", "p99", "mean");
+        
+        for (auto& zone: profile.mZoneStatistics) {
+            std::string name(zone.mDepth * 2, ' ');
+            name += zone.mName;
+            std::printf("%-56s %8d %12.4f %12.4f %12.4f\n",
+                        name.c_str(),
+                        zone.mNumSamples,
+                        zone.mP50,
+                        zone.mP99,
+                        zone.mMean);
+        }
+        
+        auto& frameLatencies = profile.mFrameLatencies;
+        std::printf("%-56s %8d %12.4f %12.4f %12.4f\n",
+                    "frame",
+                    profile.mNumFrames,
+                    frameLatencies.CalculatePercentile(50.0),
+                    frameLatencies.CalculatePercentile(99.0),
+                    frameLatencies.CalculateMean());
+        
+        auto& stats = profile.mTotalStats;
+        auto numFrames = static_cast<double>(profile.mNumFrames);
+        std::printf("per frame: %.1f draws (%.1f batches), %.1f shader uses, "
+                    "%.1f material uses, %.1f texture binds, %.1f vbo uses, "
+                    "%.1f depth write changes\n",
+                    stats.mNumDrawCalls / numFrames,
+                    stats.mNumBatchDrawCalls / numFrames,
+                    stats.mNumShaderUses / numFrames,
+                    stats.mNumMaterialUses / numFrames,
+                    stats.mNumTextureBinds / numFrames,
+                    stats.mNumVboUses / numFrames,
+                    stats.mNumDepthWriteChanges / numFrames);
+        std::printf("           %.1f triangles, %.1f points, %.1f uploads, %.1f KB uploaded\n",
+                    stats.mNumTriangles / numFrames,
+                    stats.mNumPoints / numFrames,
+                    stats.mNumUploads / numFrames,
+                    stats.mNumUploadedBytes / numFrames / 1024.0);
+        std::printf("           %.1f texts and text layers drawn in %.1f text draws\n",
+                    stats.mNumTexts / numFrames,
+                    stats.mNumTextDraws / numFrames);
+        
+        if (profile.mNumMoveClicks > 0) {
+            std::printf("moves clicked: %d\n", profile.mNumMoveClicks);
+        }
+        
+        std::printf("view rebuilds: %d\n\n", profile.mNumViewRebuilds);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+    
+    AppBundle appBundle {options.mAssetsDirectory};
+    if (!appBundle.IsValid()) {
+        std::fprintf(stderr,
+                     "Could not create the app bundle from %s\n",
+                     options.mAssetsDirectory.c_str());
+        return 1;
+    }
+    
+    Pht::FileSystem::SetResourceDirectory(appBundle.GetResourceDirectory());
+    Pht::FileSystem::SetSyncedAppHomeDirectory(appBundle.GetUserDataDirectory());
+    
+    FrameProfiler profiler;
+    auto numProfiledScenes = 0;
+    auto numScenesWithViewRebuilds = 0;
+    
+    for (auto& scene: scenes) {
+        if (!options.mSceneName.empty() && options.mSceneName != scene.mName) {
+            continue;
+        }
+        
+        auto profile = profiler.Run(scene.mScene, numWarmUpFrames, options.mNumFrames);
+        PrintProfile(scene.mName, profile);
+        ++numProfiledScenes;
+        
+        if (scene.mIsSteady && profile.mNumViewRebuilds > 0) {
+            ++numScenesWithViewRebuilds;
+        }
+        
+        if (!options.mTraceFilename.empty()) {
+            auto traceFilename = ToSceneTraceFilename(options.mTraceFilename, scene.mName);
+            if (!Pht::Profiler::WriteChromeTrace(traceFilename)) {
+                std::fprintf(stderr, "Could not write %s\n", traceFilename.c_str());
+                return 1;
+            }
+        }
+    }
+    
+    if (numProfiledScenes == 0) {
+        std::fprintf(stderr, "No scene named %s\n", options.mSceneName.c_str());
+        return 1;
+    }
+    
+    std::printf("%d frames per scene, %.4f ms timestep\n", options.mNumFrames, 1000.0 / 60.0);
+    
+    if (numScenesWithViewRebuilds > 0) {
+        std::fprintf(stderr,
+                     "%d steady scenes rebuilt their render queue views\n",
+                     numScenesWithViewRebuilds);
+        return 1;
+    }
+    
+    return 0;
+}
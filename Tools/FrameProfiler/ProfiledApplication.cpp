@@ -0,0 +1,105 @@
+#include "ProfiledApplication.hpp"
+
+#include <assert.h>
+
+// Engine includes.
+#include "IEngine.hpp"
+#include "IInput.hpp"
+#include "Button.hpp"
+#include "Profiler.hpp"
+
+using namespace RowBlast;
+
+namespace {
+    ProfiledApplication* profiledApplication {nullptr};
+}
+
+std::unique_ptr<Pht::IApplication> CreateApplication(Pht::IEngine& engine) {
+    auto application = std::make_unique<ProfiledApplication>(engine);
+    profiledApplication = application.get();
+    return application;
+}
+
+ProfiledApplication& RowBlast::GetProfiledApplication() {
+    assert(profiledApplication);
+    return *profiledApplication;
+}
+
+ProfiledApplication::ProfiledApplication(Pht::IEngine& engine) :
+    mEngine {engine},
+    mCommonResources {engine},
+    mUserServices {engine},
+    mUniverse {},
+    mGameController {engine, mCommonResources, mUserServices},
+    mMapController {
+        engine,
+        mCommonResources,
+        mUserServices,
+        mUniverse,
+        mGameController.GetLevelResources(),
+        mGameController.GetPieceResources()
+    } {
+    
+    engine.GetInput().SetUseGestureRecognizers(false);
+    
+    // The profiler plays the game by clicking on the moves that the game presents.
+    mUserServices.GetSettingsService().SetControlType(ControlType::Click);
+    
+    auto currentLevelId = mUserServices.GetProgressService().GetCurrentLevel();
+    mMapController.GetScene().SetWorldId(mUniverse.CalcWorldId(currentLevelId));
+}
+
+void ProfiledApplication::Start(const ProfiledScene& scene) {
+    mSceneKind = scene.mKind;
+    
+    switch (scene.mKind) {
+        case ProfiledScene::Kind::Game:
+            mGameController.Init(scene.mLevelId);
+            break;
+        case ProfiledScene::Kind::Map:
+            mMapController.Init();
+            break;
+        case ProfiledScene::Kind::Scripted:
+            mScriptedScene = std::make_unique<ScriptedScene>(mEngine, scene.mScriptedSceneSettings);
+            mScriptedSceneFrame = 0;
+            break;
+    }
+}
+
+void ProfiledApplication::OnUpdate() {
+    PHT_PROFILE_ZONE("ProfiledApplication::OnUpdate");
+    
+    switch (mSceneKind) {
+        case ProfiledScene::Kind::Game:
+            mGameController.Update();
+            break;
+        case ProfiledScene::Kind::Map:
+            mUserServices.Update();
+            mMapController.Update();
+            break;
+        case ProfiledScene::Kind::Scripted:
+            mScriptedScene->Step(mScriptedSceneFrame, mEngine.GetLastFrameSeconds());
+            ++mScriptedSceneFrame;
+            break;
+    }
+}
+
+Pht::Button* ProfiledApplication::GetMoveButtonToClick() const {
+    if (mSceneKind != ProfiledScene::Kind::Game) {
+        return nullptr;
+    }
+    
+    auto& clickInputHandler = mGameController.GetGameLogic().GetClickInputHandler();
+    auto* visibleMoves = clickInputHandler.GetVisibleMoves();
+    if (visibleMoves == nullptr) {
+        return nullptr;
+    }
+    
+    for (auto& move: *visibleMoves) {
+        if (move.mButton && !move.mIsHidden) {
+            return &move.mButton->GetButton();
+        }
+    }
+    
+    return nullptr;
+}
@@ -0,0 +1,71 @@
+#ifndef ProfiledApplication_hpp
+#define ProfiledApplication_hpp
+
+#include <memory>
+
+// Engine includes.
+#include "IApplication.hpp"
+
+// Game includes.
+#include "CommonResources.hpp"
+#include "UserServices.hpp"
+#include "Universe.hpp"
+#include "GameController.hpp"
+#include "MapController.hpp"
+#include "ScriptedScene.hpp"
+
+namespace Pht {
+    class IEngine;
+    class Button;
+}
+
+namespace RowBlast {
+    struct ProfiledScene {
+        enum class Kind {
+            Game,
+            Map,
+            Scripted
+        };
+        
+        Kind mKind {Kind::Scripted};
+        int mLevelId {0};
+        
+        // If false, only the first move of the game scene is clicked, during the warm-up, and the
+        // game then waits for the next move while it is profiled.
+        bool mClickMoves {true};
+        ScriptedSceneSettings mScriptedSceneSettings;
+    };
+    
+    // Runs the game and map scenes with their controllers like RowBlastApplication does, but starts
+    // the scene to profile directly instead of going through the title scene and the fades. The
+    // commands of the controllers are ignored, so a scene is kept until another one is started.
+    class ProfiledApplication: public Pht::IApplication {
+    public:
+        explicit ProfiledApplication(Pht::IEngine& engine);
+        
+        void OnInitialize() override {}
+        void OnUpdate() override;
+        
+        void Start(const ProfiledScene& scene);
+        
+        // The button of the first move that the game presents for the falling piece, if the game
+        // scene is waiting for the player to click on a move.
+        Pht::Button* GetMoveButtonToClick() const;
+    
+    private:
+        Pht::IEngine& mEngine;
+        CommonResources mCommonResources;
+        UserServices mUserServices;
+        Universe mUniverse;
+        GameController mGameController;
+        MapController mMapController;
+        std::unique_ptr<ScriptedScene> mScriptedScene;
+        ProfiledScene::Kind mSceneKind {ProfiledScene::Kind::Scripted};
+        int mScriptedSceneFrame {0};
+    };
+    
+    // The application that the engine created, since the engine owns it.
+    ProfiledApplication& GetProfiledApplication();
+}
+
+#endif
@@ -0,0 +1,333 @@
+#include "ScriptedScene.hpp"
+
+#include <cmath>
+#include <limits>
+#include <string>
+
+// Engine includes.
+#include "IEngine.hpp"
+#include "ISceneManager.hpp"
+#include "Scene.hpp"
+#include "SceneObject.hpp"
+#include "CameraComponent.hpp"
+#include "LightComponent.hpp"
+#include "IParticleSystem.hpp"
+#include "IRenderer.hpp"
+#include "ParticleEffect.hpp"
+#include "RenderableObject.hpp"
+#include "TextComponent.hpp"
+#include "BoxMesh.hpp"
+#include "QuadMesh.hpp"
+#include "Fnv1Hash.hpp"
+
+using namespace RowBlast;
+
+namespace {
+    enum class Layer {
+        Field,
+        Effects,
+        Hud
+    };
+    
+    // The same cell size and field width as in the game scene.
+    constexpr auto cellSize = 1.25f;
+    constexpr auto numFieldColumns = 9;
+    constexpr auto cloudsXLimit = 30.0f;
+    constexpr auto effectRestartPeriod = 45;
+    constexpr auto textCountPeriod = 30;
+    constexpr auto numTextStyles = 4;
+    
+    // The text styles of the game HUD and its score and medium texts, which are drawn with all the
+    // text shaders and with shadow, second shadow and specular layers.
+    Pht::TextProperties CreateTextProperties(const Pht::Font& font, int style) {
+        Pht::TextProperties textProperties {
+            font,
+            1.0f,
+            {1.0f, 0.95f, 0.85f, 1.0f},
+            Pht::TextShadow::Yes,
+            {0.05f, 0.05f},
+            {0.0f, 0.0f, 0.0f, 0.5f}
+        };
+        
+        switch (style) {
+            case 0:
+                break;
+            case 1:
+                textProperties.mTopGradientColorSubtraction = Pht::Vec3 {0.13f, 0.26f, 0.39f};
+                textProperties.mSpecular = Pht::TextSpecular::Yes;
+                textProperties.mSpecularOffset = {0.045f, 0.045f};
+                break;
+            case 2:
+                textProperties.mItalicSlant = 0.15f;
+                textProperties.mMidGradientColorSubtraction = Pht::Vec3 {0.0f, 0.3f, 0.2f};
+                textProperties.mSpecular = Pht::TextSpecular::Yes;
+                textProperties.mSpecularOffset = {0.03f, 0.03f};
+                textProperties.mSecondShadow = Pht::TextShadow::Yes;
+                textProperties.mSecondShadowColor = Pht::Vec4 {0.15f, 0.15f, 0.15f, 0.5f};
+                textProperties.mSecondShadowOffset = Pht::Vec2 {0.075f, 0.075f};
+                break;
+            default:
+                textProperties.mTopGradientColorSubtraction = Pht::Vec3 {0.1f, 0.2f, 0.3f};
+                textProperties.mMidGradientColorSubtraction = Pht::Vec3 {0.0f, 0.3f, 0.2f};
+                break;
+        }
+        
+        return textProperties;
+    }
+    
+    Pht::RenderPass CreateRenderPass(Layer layer) {
+        Pht::RenderPass renderPass {static_cast<int>(layer)};
+        
+        switch (layer) {
+            case Layer::Field:
+                break;
+            case Layer::Effects:
+                renderPass.SetRenderOrder(Pht::RenderOrder::BackToFront);
+                break;
+            case Layer::Hud:
+                renderPass.SetHudMode(true);
+                break;
+        }
+        
+        return renderPass;
+    }
+}
+
+ScriptedScene::ScriptedScene(Pht::IEngine& engine, const ScriptedSceneSettings& settings) :
+    mEngine {engine} {
+    
+    auto& sceneManager = engine.GetSceneManager();
+    auto scene = sceneManager.CreateScene(Pht::Hash::Fnv1a("scriptedScene"));
+    mScene = scene.get();
+    
+    auto& light = mScene->CreateGlobalLight();
+    light.SetDirection({1.0f, 1.0f, 1.0f});
+    mScene->GetRoot().AddChild(light.GetSceneObject());
+    
+    auto& camera = mScene->CreateCamera();
+    camera.GetSceneObject().GetTransform().SetPosition({0.0f, 0.0f, 20.5f});
+    camera.SetTarget({0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f});
+    mScene->GetRoot().AddChild(camera.GetSceneObject());
+    
+    mScene->AddRenderPass(CreateRenderPass(Layer::Field));
+    mScene->AddRenderPass(CreateRenderPass(Layer::Effects));
+    mScene->AddRenderPass(CreateRenderPass(Layer::Hud));
+    
+    CreateBlocks(settings.mNumBlocks);
+    CreateClouds(settings.mNumClouds);
+    CreateParticleEffects(settings.mNumParticleEffects, settings.mNumEmittingEffects);
+    CreateHud(settings.mNumHudButtons, settings.mNumHudTexts);
+    
+    sceneManager.SetLoadedScene(std::move(scene));
+}
+
+ScriptedScene::~ScriptedScene() {}
+
+void ScriptedScene::CreateBlocks(int numBlocks) {
+    mFieldContainer = &mScene->CreateSceneObject();
+    mFieldContainer->SetLayer(static_cast<int>(Layer::Field));
+    mFieldContainer->GetTransform().SetPosition({-numFieldColumns * cellSize / 2.0f, -12.0f, 0.0f});
+    mScene->GetRoot().AddChild(*mFieldContainer);
+    
+    Pht::Material blockMaterial {
+        Pht::Color {0.3f, 0.5f, 0.9f},
+        Pht::Color {0.3f, 0.5f, 0.9f},
+        Pht::Color {1.0f, 1.0f, 1.0f},
+        20.0f
+    };
+    
+    Pht::BoxMesh blockMesh {cellSize, cellSize, cellSize, std::string {"scriptedSceneBlock"}};
+    
+    for (auto i = 0; i < numBlocks; ++i) {
+        auto& block = mScene->CreateSceneObject(blockMesh, blockMaterial);
+        Pht::Vec3 position {
+            (i % numFieldColumns) * cellSize + cellSize / 2.0f,
+            (i / numFieldColumns) * cellSize + cellSize / 2.0f,
+            cellSize / 2.0f
+        };
+        block.GetTransform().SetPosition(position);
+        mFieldContainer->AddChild(block);
+        mBlocks.push_back(&block);
+    }
+}
+
+void ScriptedScene::CreateClouds(int numClouds) {
+    auto& container = mScene->CreateSceneObject();
+    container.SetLayer(static_cast<int>(Layer::Effects));
+    mScene->GetRoot().AddChild(container);
+    
+    Pht::Material cloudMaterial {"cloud.png"};
+    cloudMaterial.SetBlend(Pht::Blend::Yes);
+    cloudMaterial.SetOpacity(0.8f);
+    
+    Pht::QuadMesh cloudMesh {4.0f, 2.0f, std::string {"scriptedSceneCloud"}};
+    
+    for (auto i = 0; i < numClouds; ++i) {
+        auto renderable =
+            mEngine.GetSceneManager().CreateBatchableRenderableObject(cloudMesh, cloudMaterial);
+        auto& cloud = mScene->CreateSceneObject();
+        cloud.SetRenderable(renderable.get());
+        mScene->AddRenderableObject(std::move(renderable));
+        
+        Pht::Vec3 position {
+            std::fmod(i * 7.3f, 2.0f * cloudsXLimit) - cloudsXLimit,
+            std::fmod(i * 3.1f, 30.0f) - 15.0f,
+            -20.0f - (i % 5) * 2.0f
+        };
+        cloud.GetTransform().SetPosition(position);
+        container.AddChild(cloud);
+        mClouds.push_back(Cloud {&cloud, Pht::Vec3 {0.5f + (i % 3) * 0.25f, 0.0f, 0.0f}});
+    }
+}
+
+void ScriptedScene::CreateParticleEffects(int numEffects, int numEmittingEffects) {
+    auto& particleSystem = mEngine.GetParticleSystem();
+    mEffectsContainer = &mScene->CreateSceneObject();
+    mEffectsContainer->SetLayer(static_cast<int>(Layer::Effects));
+    mScene->GetRoot().AddChild(*mEffectsContainer);
+    
+    Pht::EmitterSettings emitterSettings {
+        .mPosition = Pht::Vec3{0.0f, 0.0f, 0.0f},
+        .mSize = Pht::Vec3{1.0f, 1.0f, 0.0f},
+        .mTimeToLive = 0.0f,
+        .mFrequency = 0.0f,
+        .mBurst = 40
+    };
+    
+    // The settings are assigned rather than designated since some of the members that are left
+    // at their defaults have no default member initializers.
+    Pht::ParticleSettings particleSettings;
+    particleSettings.mVelocity = Pht::Vec3{0.0f, 0.0f, 0.0f};
+    particleSettings.mVelocityRandomPart = Pht::Vec3{8.0f, 8.0f, 0.0f};
+    particleSettings.mColor = Pht::Vec4{1.0f, 1.0f, 1.0f, 1.0f};
+    particleSettings.mColorRandomPart = Pht::Vec4{0.0f, 0.0f, 0.0f, 0.0f};
+    particleSettings.mTextureFilename = "particle_sprite.png";
+    particleSettings.mTimeToLive = 0.5f;
+    particleSettings.mTimeToLiveRandomPart = 0.2f;
+    particleSettings.mFadeOutDuration = 0.3f;
+    particleSettings.mSize = Pht::Vec2{0.6f, 0.6f};
+    particleSettings.mSizeRandomPart = 0.2f;
+    
+    for (auto i = 0; i < numEffects; ++i) {
+        auto effectSceneObject =
+            particleSystem.CreateParticleEffectSceneObject(particleSettings,
+                                                           emitterSettings,
+                                                           Pht::RenderMode::Triangles);
+        auto* effect = effectSceneObject->GetComponent<Pht::ParticleEffect>();
+        particleSystem.AddParticleEffect(*effect);
+        mEffectsContainer->AddChild(*effectSceneObject);
+        mScene->AddSceneObject(std::move(effectSceneObject));
+        mParticleEffects.push_back(effect);
+    }
+    
+    Pht::EmitterSettings continuousEmitterSettings {
+        .mPosition = Pht::Vec3{0.0f, 0.0f, 0.0f},
+        .mSize = Pht::Vec3{1.0f, 1.0f, 0.0f},
+        .mTimeToLive = std::numeric_limits<float>::infinity(),
+        .mFrequency = 30.0f,
+        .mBurst = 0
+    };
+    
+    for (auto i = 0; i < numEmittingEffects; ++i) {
+        auto effectSceneObject =
+            particleSystem.CreateParticleEffectSceneObject(particleSettings,
+                                                           continuousEmitterSettings,
+                                                           Pht::RenderMode::Triangles);
+        auto* effect = effectSceneObject->GetComponent<Pht::ParticleEffect>();
+        particleSystem.AddParticleEffect(*effect);
+        effectSceneObject->GetTransform().SetPosition({
+            std::fmod(i * 2.3f, 10.0f) - 5.0f,
+            std::fmod(i * 1.7f, 20.0f) - 10.0f,
+            1.0f
+        });
+        mEffectsContainer->AddChild(*effectSceneObject);
+        mScene->AddSceneObject(std::move(effectSceneObject));
+        effect->Start();
+    }
+}
+
+void ScriptedScene::CreateHud(int numButtons, int numTexts) {
+    auto& container = mScene->CreateSceneObject();
+    container.SetLayer(static_cast<int>(Layer::Hud));
+    mScene->GetRoot().AddChild(container);
+    
+    Pht::Material buttonMaterial {Pht::Color {0.9f, 0.9f, 0.9f}};
+    buttonMaterial.SetBlend(Pht::Blend::Yes);
+    buttonMaterial.SetOpacity(0.9f);
+    
+    Pht::QuadMesh buttonMesh {2.5f, 1.0f, std::string {"scriptedSceneButton"}};
+    
+    for (auto i = 0; i < numButtons; ++i) {
+        auto& button = mScene->CreateSceneObject(buttonMesh, buttonMaterial);
+        button.GetTransform().SetPosition({-5.0f + (i % 4) * 3.0f, 11.0f - (i / 4) * 1.5f, 0.0f});
+        container.AddChild(button);
+    }
+    
+    if (numTexts == 0) {
+        return;
+    }
+    
+    mFont = std::make_unique<Pht::Font>("HussarBoldWeb.otf",
+                                        mEngine.GetRenderer().GetAdjustedNumPixels(20),
+                                        Pht::DistanceField::Yes);
+    
+    for (auto i = 0; i < numTexts; ++i) {
+        auto style = i % numTextStyles;
+        auto& text = mScene->CreateText(style == 0 ? "SCORE 0" : "MOVES LEFT",
+                                        CreateTextProperties(*mFont, style),
+                                        container);
+        text.GetSceneObject().GetTransform().SetPosition({
+            -5.0f + (i % numTextStyles) * 3.0f,
+            -6.0f - (i / numTextStyles) * 1.5f,
+            0.0f
+        });
+        
+        if (style == 0) {
+            mCounterTexts.push_back(&text);
+        }
+    }
+}
+
+void ScriptedScene::Step(int frame, float dt) {
+    auto time = frame * dt;
+    
+    // Every third block moves like the blocks of a falling piece or a shaking field.
+    for (auto i = 0; i < static_cast<int>(mBlocks.size()); i += 3) {
+        auto& transform = mBlocks[i]->GetTransform();
+        auto position = transform.GetPosition();
+        position.z = cellSize / 2.0f + 0.1f * std::sin(time * 10.0f + i);
+        transform.SetPosition(position);
+    }
+    
+    for (auto& cloud: mClouds) {
+        auto& transform = cloud.mSceneObject->GetTransform();
+        auto position = transform.GetPosition() + cloud.mVelocity * dt;
+        if (position.x > cloudsXLimit) {
+            position.x = -cloudsXLimit;
+        }
+        
+        transform.SetPosition(position);
+    }
+    
+    auto numEffects = static_cast<int>(mParticleEffects.size());
+    for (auto i = 0; i < numEffects; ++i) {
+        if ((frame + i * effectRestartPeriod / numEffects) % effectRestartPeriod == 0) {
+            auto* effect = mParticleEffects[i];
+            Pht::Vec3 position {
+                std::fmod(i * 2.3f + frame * 0.7f, 10.0f) - 5.0f,
+                std::fmod(i * 1.7f + frame * 0.3f, 20.0f) - 10.0f,
+                1.0f
+            };
+            effect->GetSceneObject().GetTransform().SetPosition(position);
+            effect->Start();
+        }
+    }
+    
+    // The counters change their strings like the score and moves texts of the game HUD, which
+    // makes the renderer lay them out again.
+    if (frame % textCountPeriod == 0) {
+        for (auto* counterText: mCounterTexts) {
+            counterText->GetText() = "SCORE " + std::to_string(frame / textCountPeriod);
+        }
+    }
+}
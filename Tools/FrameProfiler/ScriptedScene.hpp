@@ -0,0 +1,65 @@
+#ifndef ScriptedScene_hpp
+#define ScriptedScene_hpp
+
+#include <memory>
+#include <vector>
+
+// Engine includes.
+#include "Vector.hpp"
+
+namespace Pht {
+    class IEngine;
+    class Scene;
+    class SceneObject;
+    class ParticleEffect;
+    class TextComponent;
+    class Font;
+}
+
+namespace RowBlast {
+    struct ScriptedSceneSettings {
+        int mNumBlocks {0};
+        int mNumClouds {0};
+        int mNumParticleEffects {0};
+        int mNumEmittingEffects {0};
+        int mNumHudButtons {0};
+        int mNumHudTexts {0};
+    };
+    
+    // A synthetic scene with the kinds of objects that dominate the game scene: opaque blocks in a
+    // field, translucent clouds drawn with the same quad, bursts of particle effects, effects that
+    // emit particles all the time and a HUD with texts in the shadow, specular and gradient styles
+    // of the game. The script moves the objects, restarts the bursts and counts up some of the
+    // texts on a fixed schedule, so that every run performs the same work. The scene becomes the
+    // active scene of the scene manager when it is created.
+    class ScriptedScene {
+    public:
+        ScriptedScene(Pht::IEngine& engine, const ScriptedSceneSettings& settings);
+        ~ScriptedScene();
+        
+        void Step(int frame, float dt);
+    
+    private:
+        void CreateBlocks(int numBlocks);
+        void CreateClouds(int numClouds);
+        void CreateParticleEffects(int numEffects, int numEmittingEffects);
+        void CreateHud(int numButtons, int numTexts);
+        
+        struct Cloud {
+            Pht::SceneObject* mSceneObject {nullptr};
+            Pht::Vec3 mVelocity;
+        };
+        
+        Pht::IEngine& mEngine;
+        Pht::Scene* mScene {nullptr};
+        Pht::SceneObject* mFieldContainer {nullptr};
+        Pht::SceneObject* mEffectsContainer {nullptr};
+        std::vector<Pht::SceneObject*> mBlocks;
+        std::vector<Cloud> mClouds;
+        std::vector<Pht::ParticleEffect*> mParticleEffects;
+        std::unique_ptr<Pht::Font> mFont;
+        std::vector<Pht::TextComponent*> mCounterTexts;
+    };
+}
+
+#endif
@@ -0,0 +1,213 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <dirent.h>
+
+// Engine includes.
+#include "ObjMeshLoader.hpp"
+#include "MeshCache.hpp"
+
+// Game includes.
+#include "MeshLoadBenchmark.hpp"
+
+using namespace RowBlast;
+
+namespace {
+    struct Options {
+        std::string mModelsDirectory {"Assets/Models"};
+        std::string mOutputDirectory;
+        int mNumIterations {20};
+        bool mBenchmark {false};
+        bool mCheck {false};
+        bool mTextureCoords {false};
+    };
+    
+    void PrintUsage(const char* programName) {
+        std::printf("Usage: %s [--output <directory>] [--check] [--benchmark] [--iterations <n>] "
+                    "[--texture-coords] [models directory]\n",
+                    programName);
+    }
+    
+    bool ParseOptions(int argc, char* argv[], Options& options) {
+        for (auto i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+                options.mOutputDirectory = argv[++i];
+            } else if (std::strcmp(argv[i], "--check") == 0) {
+                options.mCheck = true;
+            } else if (std::strcmp(argv[i], "--benchmark") == 0) {
+                options.mBenchmark = true;
+            } else if (std::strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+                options.mNumIterations = std::atoi(argv[++i]);
+            } else if (std::strcmp(argv[i], "--texture-coords") == 0) {
+                options.mTextureCoords = true;
+            } else if (argv[i][0] == '-') {
+                return false;
+            } else {
+                options.mModelsDirectory = argv[i];
+            }
+        }
+        
+        if (options.mOutputDirectory.empty()) {
+            options.mOutputDirectory = options.mModelsDirectory;
+        }
+        
+        return options.mNumIterations > 0;
+    }
+    
+    std::vector<std::string> FindObjFiles(const std::string& directory) {
+        const std::string suffix {".obj"};
+        std::vector<std::string> filenames;
+        
+        auto* dir = opendir(directory.c_str());
+        if (dir == nullptr) {
+            return filenames;
+        }
+        
+        while (auto* entry = readdir(dir)) {
+            std::string filename {entry->d_name};
+            if (filename.size() > suffix.size() &&
+                filename.compare(filename.size() - suffix.size(), suffix.size(), suffix) == 0) {
+                
+                filenames.push_back(filename);
+            }
+        }
+        
+        closedir(dir);
+        std::sort(filenames.begin(), filenames.end());
+        return filenames;
+    }
+    
+    int Convert(const Options& options, const std::vector<std::string>& objFilenames) {
+        for (auto& objFilename: objFilenames) {
+            auto objPath = options.mModelsDirectory + "/" + objFilename;
+            auto cachePath = options.mOutputDirectory + "/" +
+                             Pht::MeshCache::ToCacheFilename(objFilename);
+            
+            auto vertexBuffer = Pht::ObjMeshLoader::LoadObjFile(objPath,
+                                                                Pht::MeshCache::GetVertexFlags(),
+                                                                1.0f,
+                                                                Pht::MoveMeshToOrigin::No);
+            auto meshCenter = Pht::ObjMeshLoader::CalculateMeshCenter(objPath);
+            auto sourceHash = Pht::MeshCache::CalcSourceHash(objPath);
+            
+            if (!sourceHash.HasValue() || !Pht::MeshCache::Write(cachePath,
+                                                                 *vertexBuffer,
+                                                                 meshCenter,
+                                                                 sourceHash.GetValue())) {
+                std::fprintf(stderr, "Could not write %s\n", cachePath.c_str());
+                return 1;
+            }
+            
+            std::printf("%-36s %6d vertices %6d indices\n",
+                        objFilename.c_str(),
+                        vertexBuffer->GetNumVertices(),
+                        vertexBuffer->GetNumIndices());
+        }
+        
+        std::printf("\n%d meshes converted\n", static_cast<int>(objFilenames.size()));
+        return 0;
+    }
+    
+    // The game does not check that the mesh cache files were converted from the current OBJ
+    // files, so the build runs this check instead.
+    int Check(const Options& options, const std::vector<std::string>& objFilenames) {
+        auto numOutdatedFiles = 0;
+        
+        for (auto& objFilename: objFilenames) {
+            auto objPath = options.mModelsDirectory + "/" + objFilename;
+            auto cachePath = options.mOutputDirectory + "/" +
+                             Pht::MeshCache::ToCacheFilename(objFilename);
+            
+            if (!Pht::MeshCache::IsUpToDate(cachePath, objPath)) {
+                std::fprintf(stderr, "%s is missing or out of date\n", cachePath.c_str());
+                ++numOutdatedFiles;
+            }
+        }
+        
+        if (numOutdatedFiles > 0) {
+            std::fprintf(stderr, "%d mesh cache files need to be converted\n", numOutdatedFiles);
+            return 1;
+        }
+        
+        std::printf("%d mesh cache files are up to date\n", static_cast<int>(objFilenames.size()));
+        return 0;
+    }
+    
+    int Benchmark(const Options& options, const std::vector<std::string>& objFilenames) {
+        Pht::VertexFlags attributeFlags {.mNormals = true, .mTextureCoords = options.mTextureCoords};
+        auto totalObjMilliseconds = 0.0;
+        auto totalCacheMilliseconds = 0.0;
+        auto numDifferentResults = 0;
+        
+        std::printf("%-36s %8s %8s %12s %12s %9s\n",
+                    "mesh", "vertices", "indices", "obj p50", "cache p50", "speedup");
+        
+        for (auto& objFilename: objFilenames) {
+            auto result = MeshLoadBenchmark::Run(options.mModelsDirectory + "/" + objFilename,
+                                                 attributeFlags,
+                                                 options.mNumIterations);
+            auto objMilliseconds = result.mObjLatencies.CalculatePercentile(50.0);
+            auto cacheMilliseconds = result.mCacheLatencies.CalculatePercentile(50.0);
+            totalObjMilliseconds += objMilliseconds;
+            totalCacheMilliseconds += cacheMilliseconds;
+            
+            std::printf("%-36s %8d %8d %12.4f %12.4f %8.1fx%s\n",
+                        result.mFilename.c_str(),
+                        result.mNumVertices,
+                        result.mNumIndices,
+                        objMilliseconds,
+                        cacheMilliseconds,
+                        objMilliseconds / cacheMilliseconds,
+                        result.mIsSameResult ? "" : "  (different result or not converted)");
+            
+            if (!result.mIsSameResult) {
+                ++numDifferentResults;
+            }
+        }
+        
+        std::printf("%-36s %8s %8s %12.4f %12.4f %8.1fx\n",
+                    "total", "", "",
+                    totalObjMilliseconds,
+                    totalCacheMilliseconds,
+                    totalObjMilliseconds / totalCacheMilliseconds);
+        std::printf("\n%d meshes, %d iterations, times in ms\n",
+                    static_cast<int>(objFilenames.size()),
+                    options.mNumIterations);
+        
+        if (numDifferentResults > 0) {
+            std::fprintf(stderr,
+                         "%d meshes gave a different result from the cache or were not converted\n",
+                         numDifferentResults);
+            return 1;
+        }
+        
+        return 0;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+    
+    auto objFilenames = FindObjFiles(options.mModelsDirectory);
+    if (objFilenames.empty()) {
+        std::fprintf(stderr, "No OBJ files found in %s\n", options.mModelsDirectory.c_str());
+        return 1;
+    }
+    
+    if (options.mCheck) {
+        return Check(options, objFilenames);
+    }
+    
+    if (options.mBenchmark) {
+        return Benchmark(options, objFilenames);
+    }
+    
+    return Convert(options, objFilenames);
+}
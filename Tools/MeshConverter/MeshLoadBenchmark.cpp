@@ -0,0 +1,68 @@
+#include "MeshLoadBenchmark.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+
+// Engine includes.
+#include "ObjMeshLoader.hpp"
+#include "MeshCache.hpp"
+
+using namespace RowBlast;
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+    
+    // The scale of most meshes in the game is not one, so the cache path does not just copy the
+    // vertices.
+    constexpr auto scale = 0.9f;
+    
+    bool IsSame(const Pht::VertexBuffer& a, const Pht::VertexBuffer& b) {
+        return a.GetAttributeFlags() == b.GetAttributeFlags() &&
+               a.GetNumVertices() == b.GetNumVertices() &&
+               a.GetNumIndices() == b.GetNumIndices() &&
+               std::memcmp(a.GetVertexBuffer(),
+                           b.GetVertexBuffer(),
+                           a.GetVertexBufferSize() * sizeof(float)) == 0 &&
+               std::memcmp(a.GetIndexBuffer(),
+                           b.GetIndexBuffer(),
+                           a.GetIndexBufferSize() * sizeof(uint16_t)) == 0;
+    }
+}
+
+MeshLoadBenchmarkResult MeshLoadBenchmark::Run(const std::string& objPath,
+                                               Pht::VertexFlags attributeFlags,
+                                               int numIterations) {
+    MeshLoadBenchmarkResult result;
+    result.mFilename = objPath.substr(objPath.find_last_of('/') + 1);
+    
+    auto cachePath = Pht::MeshCache::ToCacheFilename(objPath);
+    std::unique_ptr<Pht::VertexBuffer> objVertexBuffer;
+    std::unique_ptr<Pht::VertexBuffer> cacheVertexBuffer;
+    
+    for (auto i = 0; i < numIterations; ++i) {
+        auto startTime = Clock::now();
+        objVertexBuffer = Pht::ObjMeshLoader::LoadObjFile(objPath,
+                                                          attributeFlags,
+                                                          scale,
+                                                          Pht::MoveMeshToOrigin::No);
+        result.mObjLatencies.AddSample(Milliseconds {Clock::now() - startTime}.count());
+        
+        startTime = Clock::now();
+        cacheVertexBuffer = Pht::MeshCache::Load(cachePath,
+                                                 attributeFlags,
+                                                 scale,
+                                                 Pht::MoveMeshToOrigin::No);
+        result.mCacheLatencies.AddSample(Milliseconds {Clock::now() - startTime}.count());
+    }
+    
+    if (objVertexBuffer) {
+        result.mNumVertices = objVertexBuffer->GetNumVertices();
+        result.mNumIndices = objVertexBuffer->GetNumIndices();
+    }
+    
+    result.mIsSameResult = objVertexBuffer && cacheVertexBuffer &&
+                           IsSame(*objVertexBuffer, *cacheVertexBuffer);
+    return result;
+}
@@ -0,0 +1,31 @@
+#ifndef MeshLoadBenchmark_hpp
+#define MeshLoadBenchmark_hpp
+
+#include <string>
+
+// Engine includes.
+#include "VertexBuffer.hpp"
+
+// Game includes.
+#include "LatencyStatistics.hpp"
+
+namespace RowBlast {
+    struct MeshLoadBenchmarkResult {
+        std::string mFilename;
+        int mNumVertices {0};
+        int mNumIndices {0};
+        LatencyStatistics mObjLatencies;
+        LatencyStatistics mCacheLatencies;
+        bool mIsSameResult {false};
+    };
+    
+    // Times loading a mesh from its OBJ file and from its converted mesh cache file, and checks
+    // that both give the same vertex buffer.
+    namespace MeshLoadBenchmark {
+        MeshLoadBenchmarkResult Run(const std::string& objPath,
+                                    Pht::VertexFlags attributeFlags,
+                                    int numIterations);
+    }
+}
+
+#endif
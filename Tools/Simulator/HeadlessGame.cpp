@@ -0,0 +1,217 @@
+#include "HeadlessGame.hpp"
+
+#include <chrono>
+
+// Game includes.
+#include "Level.hpp"
+#include "LowestVisibleRow.hpp"
+#include "SpawnPosition.hpp"
+
+using namespace RowBlast;
+
+namespace {
+    constexpr auto halfColumn = 0.5f;
+    constexpr auto bombExplosionMaxReach = 2;
+    
+    PieceBlocks CreatePieceBlocks(const FallingPiece& fallingPiece) {
+        auto& pieceType = fallingPiece.GetPieceType();
+        
+        return {
+            pieceType.GetGrid(fallingPiece.GetRotation()),
+            pieceType.GetGridNumRows(),
+            pieceType.GetGridNumColumns(),
+            &pieceType.GetBitmask(fallingPiece.GetRotation())
+        };
+    }
+}
+
+HeadlessGame::HeadlessGame() :
+    mFieldGravity {mField},
+    mAi {mField} {}
+
+void HeadlessGame::SetUseLookahead(bool useLookahead) {
+    mUseLookahead = useLookahead;
+}
+
+void HeadlessGame::SetEvaluationMode(Ai::EvaluationMode evaluationMode) {
+    mAi.SetEvaluationMode(evaluationMode);
+}
+
+HeadlessGame::Result HeadlessGame::Play(const Level& level, LatencyStatistics& moveLatencies) {
+    Init(level);
+    
+    for (;;) {
+        if (CalculateNumObjectsLeftToClear() == 0) {
+            return Result::LevelCompleted;
+        }
+        
+        if (mMovesLeft == 0 || mPieceType == nullptr) {
+            return Result::OutOfMoves;
+        }
+        
+        if (!SpawnFallingPiece()) {
+            return Result::GameOver;
+        }
+        
+        auto* nextPieces = mUseLookahead ? &mSelectablePieces : nullptr;
+        
+        auto startTime = std::chrono::steady_clock::now();
+        auto& moves = mAi.CalculateMoves(mFallingPiece, mMovesUsed, nextPieces);
+        std::chrono::duration<double, std::milli> latency {std::chrono::steady_clock::now() - startTime};
+        moveLatencies.AddSample(latency.count());
+        
+        if (moves.IsEmpty()) {
+            return Result::GameOver;
+        }
+        
+        LandFallingPiece(*moves.Front());
+        
+        --mMovesLeft;
+        ++mMovesUsed;
+        NextPiece();
+    }
+}
+
+void HeadlessGame::Init(const Level& level) {
+    mLevel = &level;
+    mField.Init(level);
+    mFieldGravity.Init();
+    mAi.Init(level);
+    mFallingPiece.ResetBetweenGames();
+    mNextPieceGenerator.Init(level.GetPieceTypes(), level.GetPieceSequence());
+    
+    mMovesLeft = level.GetNumMoves();
+    mMovesUsed = 0;
+    mPieceType = mNextPieceGenerator.GetNext(mMovesLeft);
+    mSelectablePieces[0] = mNextPieceGenerator.GetNext(mMovesLeft);
+    mSelectablePieces[1] = mNextPieceGenerator.GetNext(mMovesLeft);
+    
+    UpdateLowestVisibleRow();
+}
+
+bool HeadlessGame::SpawnFallingPiece() {
+    auto& pieceType = *mPieceType;
+    auto spawnPosition = SpawnPosition::Calculate(mField, *mLevel, pieceType);
+    
+    mFallingPiece.UpdateId();
+    mFallingPiece.Spawn(pieceType,
+                        spawnPosition,
+                        pieceType.GetSpawnRotation(),
+                        mLevel->GetSpeed());
+    
+    auto ghostPieceRow = mField.DetectCollisionDown(CreatePieceBlocks(mFallingPiece),
+                                                    mFallingPiece.GetIntPosition());
+    return ghostPieceRow <= mFallingPiece.GetPosition().y;
+}
+
+void HeadlessGame::LandFallingPiece(const Move& move) {
+    mFallingPiece.SetX(move.mPosition.x + halfColumn);
+    mFallingPiece.SetY(static_cast<float>(move.mPosition.y));
+    mFallingPiece.SetRotation(move.mRotation);
+    
+    if (mPieceType->IsBomb() || mPieceType->IsRowBomb()) {
+        DetonateBomb();
+    } else {
+        mField.LandFallingPiece(mFallingPiece, false);
+        
+        if (mLevel->GetObjective() != Level::Objective::Build) {
+            ClearFilledRowsAndPullDownLoosePieces();
+        }
+    }
+    
+    mField.ManageBonds();
+    UpdateLowestVisibleRow();
+}
+
+void HeadlessGame::DetonateBomb() {
+    // The explosions are resolved at once instead of being animated by the FieldExplosionsSystem
+    // and impacted level bombs are not chain detonated.
+    auto detonationPosition = mFallingPiece.GetIntPosition() + Pht::IVec2{1, 1};
+    
+    if (mPieceType->IsRowBomb()) {
+        Pht::IVec2 areaPosition {0, detonationPosition.y};
+        Pht::IVec2 areaSize {mField.GetNumColumns(), 1};
+        mField.RemoveAreaOfSubCells(areaPosition, areaSize, true);
+    } else {
+        Pht::IVec2 areaPosition {
+            detonationPosition.x - bombExplosionMaxReach,
+            detonationPosition.y - bombExplosionMaxReach
+        };
+        
+        Pht::IVec2 areaSize {bombExplosionMaxReach * 2 + 1, bombExplosionMaxReach * 2 + 1};
+        mField.RemoveAreaOfSubCells(areaPosition, areaSize, false);
+    }
+    
+    if (mLevel->GetObjective() != Level::Objective::Build) {
+        PullDownLoosePieces();
+        ClearFilledRowsAndPullDownLoosePieces();
+    }
+}
+
+void HeadlessGame::ClearFilledRowsAndPullDownLoosePieces() {
+    for (;;) {
+        auto removedSubCells = mField.ClearFilledRows();
+        if (removedSubCells.IsEmpty()) {
+            break;
+        }
+        
+        mField.RemoveClearedRows();
+        mFieldGravity.ResetIsPulledDownFlags();
+        PullDownLoosePieces();
+    }
+}
+
+void HeadlessGame::PullDownLoosePieces() {
+    switch (mLevel->GetObjective()) {
+        case Level::Objective::Clear:
+            for (;;) {
+                UpdateLowestVisibleRow();
+                mFieldGravity.PullDownLoosePieces();
+                
+                if (!mFieldGravity.AnyPiecesPulledDown()) {
+                    break;
+                }
+            }
+            break;
+        case Level::Objective::BringDownTheAsteroid: {
+            mField.SaveInTempGrid();
+            mField.SetLowestVisibleRow(0);
+            mFieldGravity.PullDownLoosePieces();
+            
+            auto lowestVisibleRow =
+                LowestVisibleRow::CalculatePreferred(mField, mLevel->GetObjective());
+            
+            mField.RestoreFromTempGrid();
+            mField.SetLowestVisibleRow(lowestVisibleRow);
+            mFieldGravity.PullDownLoosePieces();
+            break;
+        }
+        case Level::Objective::Build:
+            break;
+    }
+}
+
+void HeadlessGame::UpdateLowestVisibleRow() {
+    mField.SetLowestVisibleRow(LowestVisibleRow::CalculatePreferred(mField, mLevel->GetObjective()));
+}
+
+int HeadlessGame::CalculateNumObjectsLeftToClear() const {
+    switch (mLevel->GetObjective()) {
+        case Level::Objective::Clear:
+            return mField.CalculateNumLevelBlocks();
+        case Level::Objective::BringDownTheAsteroid: {
+            auto asteroidRow = mField.CalculateAsteroidRow();
+            return asteroidRow.HasValue() && asteroidRow.GetValue() == 0 ? 0 : 1;
+        }
+        case Level::Objective::Build:
+            return mField.CalculateNumEmptyBlueprintSlots();
+    }
+    
+    return 0;
+}
+
+void HeadlessGame::NextPiece() {
+    mPieceType = mSelectablePieces[0];
+    mSelectablePieces[0] = mSelectablePieces[1];
+    mSelectablePieces[1] = mNextPieceGenerator.GetNext(mMovesLeft);
+}
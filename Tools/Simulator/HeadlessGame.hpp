@@ -0,0 +1,61 @@
+#ifndef HeadlessGame_hpp
+#define HeadlessGame_hpp
+
+// Game includes.
+#include "Field.hpp"
+#include "FieldGravitySystem.hpp"
+#include "FallingPiece.hpp"
+#include "NextPieceGenerator.hpp"
+#include "Ai.hpp"
+#include "LatencyStatistics.hpp"
+
+namespace RowBlast {
+    class Level;
+    
+    // Plays a level with the AI without any animations, rendering or input. Each move the AI picks
+    // the best move for the active piece, the piece is landed and filled rows, gravity and bombs are
+    // resolved immediately.
+    class HeadlessGame {
+    public:
+        enum class Result {
+            LevelCompleted,
+            OutOfMoves,
+            GameOver
+        };
+        
+        HeadlessGame();
+        
+        void SetUseLookahead(bool useLookahead);
+        void SetEvaluationMode(Ai::EvaluationMode evaluationMode);
+        Result Play(const Level& level, LatencyStatistics& moveLatencies);
+        
+        int GetMovesUsed() const {
+            return mMovesUsed;
+        }
+        
+    private:
+        void Init(const Level& level);
+        bool SpawnFallingPiece();
+        void LandFallingPiece(const Move& move);
+        void DetonateBomb();
+        void ClearFilledRowsAndPullDownLoosePieces();
+        void PullDownLoosePieces();
+        void UpdateLowestVisibleRow();
+        int CalculateNumObjectsLeftToClear() const;
+        void NextPiece();
+        
+        Field mField;
+        FieldGravitySystem mFieldGravity;
+        Ai mAi;
+        FallingPiece mFallingPiece;
+        NextPieceGenerator mNextPieceGenerator;
+        const Level* mLevel {nullptr};
+        const Piece* mPieceType {nullptr};
+        TwoPieces mSelectablePieces;
+        int mMovesLeft {0};
+        int mMovesUsed {0};
+        bool mUseLookahead {false};
+    };
+}
+
+#endif
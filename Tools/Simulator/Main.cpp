@@ -0,0 +1,131 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+// Game includes.
+#include "HeadlessGame.hpp"
+#include "LevelFiles.hpp"
+#include "PieceFactory.hpp"
+
+using namespace RowBlast;
+
+namespace {
+    struct Options {
+        std::string mLevelsDirectory {"Assets/Levels"};
+        bool mUseLookahead {false};
+        bool mSerial {false};
+        unsigned int mSeed {1};
+    };
+    
+    void PrintUsage(const char* programName) {
+        std::printf("Usage: %s [--lookahead] [--serial] [--seed <n>] [levels directory]\n",
+                    programName);
+    }
+    
+    bool ParseOptions(int argc, char* argv[], Options& options) {
+        for (auto i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], "--lookahead") == 0) {
+                options.mUseLookahead = true;
+            } else if (std::strcmp(argv[i], "--serial") == 0) {
+                options.mSerial = true;
+            } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+                options.mSeed = static_cast<unsigned int>(std::atoi(argv[++i]));
+            } else if (argv[i][0] == '-') {
+                return false;
+            } else {
+                options.mLevelsDirectory = argv[i];
+            }
+        }
+        
+        return true;
+    }
+    
+    const char* ToString(HeadlessGame::Result result) {
+        switch (result) {
+            case HeadlessGame::Result::LevelCompleted:
+                return "Completed";
+            case HeadlessGame::Result::OutOfMoves:
+                return "OutOfMoves";
+            case HeadlessGame::Result::GameOver:
+                return "GameOver";
+        }
+        
+        return "";
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+    
+    auto levelFiles = LevelFiles::Find(options.mLevelsDirectory);
+    if (levelFiles.empty()) {
+        std::fprintf(stderr, "No level files found in %s\n", options.mLevelsDirectory.c_str());
+        return 1;
+    }
+    
+    auto pieceTypes = PieceFactory::CreatePieceTypes();
+    
+    HeadlessGame game;
+    game.SetUseLookahead(options.mUseLookahead);
+    game.SetEvaluationMode(options.mSerial ? Ai::EvaluationMode::Serial : Ai::EvaluationMode::Parallel);
+    
+    LatencyStatistics allMoveLatencies;
+    auto totalSeconds = 0.0;
+    auto numCompletedLevels = 0;
+    
+    std::printf("%-6s %-21s %-10s %6s %10s %9s %9s %9s\n",
+                "level", "objective", "result", "moves", "moves/s", "mean ms", "p50 ms", "p99 ms");
+    
+    for (auto& levelFile: levelFiles) {
+        auto level = LevelFiles::Load(levelFile, pieceTypes);
+        
+        std::srand(options.mSeed);
+        
+        LatencyStatistics moveLatencies;
+        auto startTime = std::chrono::steady_clock::now();
+        auto result = game.Play(*level, moveLatencies);
+        std::chrono::duration<double> seconds {std::chrono::steady_clock::now() - startTime};
+        
+        auto movesUsed = game.GetMovesUsed();
+        auto movesPerSecond = seconds.count() > 0.0 ? movesUsed / seconds.count() : 0.0;
+        
+        std::printf("%-6d %-21s %-10s %6d %10.1f %9.3f %9.3f %9.3f\n",
+                    levelFile.mId,
+                    LevelFiles::ToString(level->GetObjective()).c_str(),
+                    ToString(result),
+                    movesUsed,
+                    movesPerSecond,
+                    moveLatencies.CalculateMean(),
+                    moveLatencies.CalculatePercentile(50.0),
+                    moveLatencies.CalculatePercentile(99.0));
+        
+        allMoveLatencies.Merge(moveLatencies);
+        totalSeconds += seconds.count();
+        
+        if (result == HeadlessGame::Result::LevelCompleted) {
+            ++numCompletedLevels;
+        }
+    }
+    
+    auto totalMoves = allMoveLatencies.GetNumSamples();
+    
+    std::printf("\n%d/%d levels completed, %d moves in %.2f s, %.1f moves/s\n",
+                numCompletedLevels,
+                static_cast<int>(levelFiles.size()),
+                totalMoves,
+                totalSeconds,
+                totalSeconds > 0.0 ? totalMoves / totalSeconds : 0.0);
+    std::printf("Move latency: mean %.3f ms, p50 %.3f ms, p99 %.3f ms, max %.3f ms\n",
+                allMoveLatencies.CalculateMean(),
+                allMoveLatencies.CalculatePercentile(50.0),
+                allMoveLatencies.CalculatePercentile(99.0),
+                allMoveLatencies.CalculateMax());
+    
+    return 0;
+}